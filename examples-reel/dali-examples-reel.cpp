@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include "shared/dali-demo-strings.h"
 #include "shared/dali-table-view.h"
+#include "shared/execute-process.h"
 
 using namespace Dali;
 
@@ -33,10 +34,14 @@ int DALI_EXPORT_API main(int argc, char** argv)
   setlocale(LC_ALL, DEMO_LANG);
 #endif
 
+  // The zygote is forked before the application is created, as a process that has started threads can't be forked safely
+  StartExampleZygote(argc, argv);
+
   Application app = Application::New(&argc, &argv, DEMO_STYLE_DIR "/examples-theme.json");
 
   // Create the demo launcher
   DaliTableView demo(app);
+  demo.ParseArguments(argc, argv);
 
   demo.AddExample(Example("animated-images.example", DALI_DEMO_STR_TITLE_ANIMATED_IMAGES));
   demo.AddExample(Example("animated-shapes.example", DALI_DEMO_STR_TITLE_ANIMATED_SHAPES));
@@ -106,5 +111,5 @@ int DALI_EXPORT_API main(int argc, char** argv)
   // Start the event loop
   app.MainLoop();
 
-  return 0;
+  return demo.GetExitCode();
 }
@@ -17,6 +17,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <cstring>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 
@@ -50,6 +52,8 @@ private:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // This creates an image view with one of 3 images, and one of 2 masks.
     // Clicking the screen will cycle through each combination of mask and image.
 
@@ -149,6 +153,7 @@ private:
   int mImageCombinationIndex;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
@@ -156,3 +161,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ImageViewAlphaBlendApp)
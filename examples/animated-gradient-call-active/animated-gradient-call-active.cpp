@@ -20,6 +20,8 @@
 #include <dali/dali.h>
 #include <dali/integration-api/debug.h>
 #include <iostream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -129,6 +131,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the main window
     mWindow = application.GetWindow();
     mWindow.KeyEventSignal().Connect(this, &CallController::OnKeyEvent);
@@ -402,6 +406,7 @@ private:
   float mButtonDelay;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
@@ -411,3 +416,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(CallController)
@@ -20,6 +20,8 @@
 #include <dali/dali.h>
 #include <dali/integration-api/debug.h>
 #include <iostream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -282,6 +284,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     mWindow = application.GetWindow();
     mWindow.KeyEventSignal().Connect(this, &CardController::OnKeyEvent);
@@ -827,6 +831,7 @@ private:
   bool mIsTouchedActor;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
@@ -837,3 +842,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(CardController)
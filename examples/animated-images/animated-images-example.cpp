@@ -19,6 +19,8 @@
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/visuals/animated-image-visual-actions-devel.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -102,6 +104,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Set the window background color and connect to the window's key signal to allow Back and Escape to exit.
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -371,6 +375,7 @@ private:
   ImageType mImageType; ///< The current Image type.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
@@ -381,3 +386,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(AnimatedImageController)
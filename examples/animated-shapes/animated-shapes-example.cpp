@@ -17,6 +17,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <sstream>
@@ -103,6 +105,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window        window     = application.GetWindow();
     const Vector2 windowSize = window.GetSize();
 
@@ -456,6 +460,7 @@ private:
   Application& mApplication;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv);
@@ -463,3 +468,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(AnimatedShapesExample)
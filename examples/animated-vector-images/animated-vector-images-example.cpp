@@ -23,6 +23,8 @@
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali/dali.h>
 #include <string>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -78,6 +80,8 @@ public:
 
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // The Init signal is received once (only) during the Application lifetime
 
     // Creates a default view with a default tool bar.
@@ -217,6 +221,7 @@ private:
   PushButton mStopButtons[NUMBER_OF_IMAGES];
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -224,3 +229,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(AnimatedVectorImageViewController)
@@ -21,6 +21,8 @@
 #include <dali-toolkit/devel-api/visuals/arc-visual-actions-devel.h>
 #include <dali-toolkit/devel-api/visuals/arc-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -85,6 +87,8 @@ private:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -233,6 +237,7 @@ private:
   Property::Index mSelectedPoperty;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application      application = Application::New(&argc, &argv);
@@ -240,3 +245,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ArcVisualExample)
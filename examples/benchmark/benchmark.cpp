@@ -19,6 +19,9 @@
 #include <dali-toolkit/dali-toolkit.h>
 
 // INTERNAL INCLUDES
+#include "shared/benchmark-harness.h"
+#include "shared/example-startup.h"
+#include "shared/texture-atlas.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -143,6 +146,8 @@ const unsigned int NUM_NINEPATCH_IMAGES = sizeof(NINEPATCH_IMAGE_PATH) / sizeof(
 
 const float ANIMATION_TIME(5.0f); // animation length in seconds
 
+const unsigned int ATLAS_IMAGE_SIZE(256u); // images are shrunk to fit this size in the atlas
+
 struct VertexWithTexture
 {
   Vector2 position;
@@ -164,6 +169,79 @@ const char* VERTEX_SHADER_TEXTURE = DALI_COMPOSE_SHADER(
     }\n
 );
 
+// Reads the image of the renderer from its rectangle in the atlas
+const char* VERTEX_SHADER_ATLAS = DALI_COMPOSE_SHADER(
+    attribute mediump vec2 aPosition;\n
+    attribute mediump vec2 aTexCoord;\n
+    uniform mediump mat4 uMvpMatrix;\n
+    uniform mediump vec3 uSize;\n
+    uniform mediump vec4 uTextureRect;\n
+    varying mediump vec2 vTexCoord;\n
+    void main()\n
+    {\n
+      vec4 position = vec4(aPosition,0.0,1.0)*vec4(uSize,1.0);\n
+      gl_Position = uMvpMatrix * position;\n
+      vTexCoord = uTextureRect.xy + aTexCoord * uTextureRect.zw;\n
+    }\n
+);
+
+// Draws every image of the grid from one geometry, each playing its part of the show and hide animations from its
+// index and the animation times of the actor
+const char* VERTEX_SHADER_INSTANCED = DALI_COMPOSE_SHADER(
+    attribute mediump vec2 aPosition;\n
+    attribute highp vec2 aInstancePosition;\n
+    attribute mediump vec4 aTextureRect;\n
+    attribute highp float aInstanceIndex;\n
+    uniform mediump mat4 uMvpMatrix;\n
+    uniform mediump vec3 uSize;\n
+    uniform mediump vec2 uInstanceSize;\n
+    uniform highp float uAnimatedInstanceCount;\n
+    uniform mediump float uInstanceDuration;\n
+    uniform highp vec3 uShowPosition;\n
+    uniform highp float uShowDelay;\n
+    uniform highp float uShowTime;\n
+    uniform highp float uHideDelay;\n
+    uniform highp float uHideTime;\n
+    uniform highp float uHideDistance;\n
+    varying mediump vec2 vTexCoord;\n
+
+    float Progress(float time, float start, float duration)\n
+    {\n
+      return duration > 0.0 ? clamp((time - start) / duration, 0.0, 1.0) : step(start, time);\n
+    }\n
+
+    float EaseOut(float progress)\n
+    {\n
+      progress -= 1.0;\n
+      return progress * progress * progress + 1.0;\n
+    }\n
+
+    float EaseOutBack(float progress)\n
+    {\n
+      progress -= 1.0;\n
+      return 1.0 + progress * progress * (2.70158 * progress + 1.70158);\n
+    }\n
+
+    void main()\n
+    {\n
+      bool  animated  = aInstanceIndex < uAnimatedInstanceCount;\n
+      float duration  = animated ? uInstanceDuration : 0.0;\n
+      float showStart = animated ? aInstanceIndex * uShowDelay : 0.0;\n
+      float hideStart = animated ? aInstanceIndex * uHideDelay : 0.0;\n
+
+      float show  = EaseOutBack(Progress(uShowTime, showStart, duration));\n
+      float angle = radians(70.0) * EaseOut(Progress(uHideTime, hideStart, duration));\n
+      float hideZ = uHideDistance * EaseOutBack(Progress(uHideTime, hideStart + uHideDelay * uAnimatedInstanceCount + duration, duration));\n
+
+      vec2 corner   = aPosition * uInstanceSize * show;\n
+      vec3 center   = mix(uShowPosition, vec3(aInstancePosition, 0.0), show) + vec3(0.0, 0.0, hideZ);\n
+      vec4 position = vec4(center + vec3(corner.x, corner.y * cos(angle), corner.y * sin(angle)), 1.0);\n
+      position.xy -= uSize.xy * 0.5;\n
+      gl_Position = uMvpMatrix * position;\n
+      vTexCoord = aTextureRect.xy + (aPosition + 0.5) * aTextureRect.zw;\n
+    }\n
+);
+
 const char* FRAGMENT_SHADER_TEXTURE = DALI_COMPOSE_SHADER(
     uniform lowp vec4 uColor;\n
     uniform sampler2D sTexture;\n
@@ -178,6 +256,8 @@ const char* FRAGMENT_SHADER_TEXTURE = DALI_COMPOSE_SHADER(
 
 bool         gUseMesh(false);
 bool         gNinePatch(false);
+bool         gUseAtlas(false);
+bool         gUseInstancing(false);
 unsigned int gRowsPerPage(25);
 unsigned int gColumnsPerPage(25);
 unsigned int gPageCount(13);
@@ -194,6 +274,15 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
   return renderer;
 }
 
+Renderer CreateAtlasRenderer(unsigned int index, Geometry geometry, Shader shader, const DemoHelper::TextureAtlas& atlas)
+{
+  Renderer renderer = Renderer::New(geometry, shader);
+  renderer.SetTextures(atlas.GetTextureSet(index));
+  renderer.RegisterProperty(DemoHelper::TextureAtlas::TEXTURE_RECT_UNIFORM_NAME, atlas.GetTextureRect(index));
+  renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::OFF);
+  return renderer;
+}
+
 } // namespace
 // Test application to compare performance between using a mesh and ImageView
 // By default, the application consist of 10 pages of 25x25 Image views, this can be modified using the following command line arguments:
@@ -202,13 +291,18 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 // -p NumberOfPages (Modifies the nimber of pages )
 // --use-mesh ( Use new renderer API (as ImageView) but shares renderers between actors when possible )
 // --nine-patch ( Use nine patch images )
+// --atlas ( Packs the images into a few atlas textures and draws them as mesh actors )
+// --instanced ( Draws the whole grid from one actor, the images animated by its shader )
+// --timing-output=Path ( Writes the frame time statistics of the show, scroll and hide phases as JSON to the file at Path )
+// --sweep=Name=Values ( Runs the benchmark once per value in a new process, see DemoHelper::BenchmarkHarness )
 
 //
 class Benchmark : public ConnectionTracker
 {
 public:
-  Benchmark(Application& application)
+  Benchmark(Application& application, DemoHelper::BenchmarkHarness& harness)
   : mApplication(application),
+    mHarness(harness),
     mRowsPerPage(gRowsPerPage),
     mColumnsPerPage(gColumnsPerPage),
     mPageCount(gPageCount)
@@ -222,6 +316,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -237,7 +333,11 @@ public:
     // Respond to key events
     window.KeyEventSignal().Connect(this, &Benchmark::OnKeyEvent);
 
-    if(gUseMesh)
+    if(gUseInstancing)
+    {
+      CreateInstancedActor();
+    }
+    else if(gUseMesh)
     {
       CreateMeshActors();
     }
@@ -246,6 +346,7 @@ public:
       CreateImageViews();
     }
 
+    mHarness.StartRecording(window.GetRootLayer());
     ShowAnimation();
   }
 
@@ -280,13 +381,18 @@ public:
   {
     unsigned int numImages = !gNinePatch ? NUM_IMAGES : NUM_NINEPATCH_IMAGES;
 
-    //Create all the renderers
-    std::vector<Renderer> renderers(numImages);
-    Shader                shader   = Shader::New(VERTEX_SHADER_TEXTURE, FRAGMENT_SHADER_TEXTURE);
-    Geometry              geometry = DemoHelper::CreateTexturedQuad();
+    //Create all the renderers; with the atlas they also share their texture set and only differ by a uniform
+    std::vector<Renderer>    renderers(numImages);
+    Shader                   shader   = Shader::New(gUseAtlas ? VERTEX_SHADER_ATLAS : VERTEX_SHADER_TEXTURE, FRAGMENT_SHADER_TEXTURE);
+    Geometry                 geometry = DemoHelper::CreateTexturedQuad();
+    DemoHelper::TextureAtlas atlas;
+    if(gUseAtlas)
+    {
+      atlas.Load(!gNinePatch ? IMAGE_PATH : NINEPATCH_IMAGE_PATH, numImages, ImageDimensions(ATLAS_IMAGE_SIZE, ATLAS_IMAGE_SIZE));
+    }
     for(unsigned int i(0); i < numImages; ++i)
     {
-      renderers[i] = CreateRenderer(i, geometry, shader);
+      renderers[i] = gUseAtlas ? CreateAtlasRenderer(i, geometry, shader, atlas) : CreateRenderer(i, geometry, shader);
     }
 
     //Create the actors
@@ -302,6 +408,90 @@ public:
     }
   }
 
+  void CreateInstancedActor()
+  {
+    unsigned int             numImages = !gNinePatch ? NUM_IMAGES : NUM_NINEPATCH_IMAGES;
+    DemoHelper::TextureAtlas atlas;
+    atlas.Load(!gNinePatch ? IMAGE_PATH : NINEPATCH_IMAGE_PATH, numImages, ImageDimensions(ATLAS_IMAGE_SIZE, ATLAS_IMAGE_SIZE));
+
+    // Without instanced draws, every image is two triangles repeating its instance data in their six vertices
+    struct Instance
+    {
+      Vector2 position;
+      Vector4 textureRect;
+      float   index;
+    };
+    static const Vector2 CORNERS[] = {Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(-0.5f, 0.5f), Vector2(-0.5f, 0.5f), Vector2(0.5f, -0.5f), Vector2(0.5f, 0.5f)};
+
+    // The images of each atlas are drawn by their own renderer
+    const unsigned int                 textureCount = std::max(atlas.GetTextureCount(), 1u);
+    std::vector<std::vector<Vector2>>  corners(textureCount);
+    std::vector<std::vector<Instance>> instances(textureCount);
+    std::vector<TextureSet>            textureSets(textureCount);
+    unsigned int                       actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
+    for(unsigned int i(0); i < actorCount; ++i)
+    {
+      // In the order of the show animation, column by column
+      const unsigned int image    = i % numImages;
+      const unsigned int texture  = atlas.GetTextureIndex(image);
+      const Instance     instance = {Vector2(mSize.x * (i / mRowsPerPage + 0.5f), mSize.y * (i % mRowsPerPage + 0.5f)), atlas.GetTextureRect(image), static_cast<float>(i)};
+      for(const Vector2& corner : CORNERS)
+      {
+        corners[texture].push_back(corner);
+        instances[texture].push_back(instance);
+      }
+      textureSets[texture] = atlas.GetTextureSet(image);
+    }
+
+    // The actor covers the grid, so that it isn't culled while any image is on screen
+    unsigned int totalColumns = mColumnsPerPage * mPageCount;
+    mInstancedActor           = Actor::New();
+    mInstancedActor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    mInstancedActor.SetProperty(Actor::Property::SIZE, Vector2(mSize.x * totalColumns, mSize.y * mRowsPerPage));
+    mInstancedActor.RegisterProperty("uInstanceSize", Vector2(mSize));
+    mInstancedActor.RegisterProperty("uAnimatedInstanceCount", static_cast<float>(mRowsPerPage * mColumnsPerPage));
+    mInstancedActor.RegisterProperty("uInstanceDuration", 0.0f);
+    mInstancedActor.RegisterProperty("uShowPosition", Vector3::ZERO);
+    mInstancedActor.RegisterProperty("uShowDelay", 0.0f);
+    mInstancedActor.RegisterProperty("uShowTime", 0.0f);
+    mInstancedActor.RegisterProperty("uHideDelay", 0.0f);
+    mInstancedActor.RegisterProperty("uHideTime", -1.0f); // nothing is hidden until the hide animation
+    mInstancedActor.RegisterProperty("uHideDistance", 0.0f);
+
+    Property::Map cornerFormat;
+    cornerFormat["aPosition"] = Property::VECTOR2;
+    Property::Map instanceFormat;
+    instanceFormat["aInstancePosition"] = Property::VECTOR2;
+    instanceFormat["aTextureRect"]      = Property::VECTOR4;
+    instanceFormat["aInstanceIndex"]    = Property::FLOAT;
+
+    Shader shader = Shader::New(VERTEX_SHADER_INSTANCED, FRAGMENT_SHADER_TEXTURE);
+    for(unsigned int texture(0); texture < textureCount; ++texture)
+    {
+      if(!textureSets[texture])
+      {
+        continue;
+      }
+
+      VertexBuffer cornerBuffer = VertexBuffer::New(cornerFormat);
+      cornerBuffer.SetData(corners[texture].data(), corners[texture].size());
+      VertexBuffer instanceBuffer = VertexBuffer::New(instanceFormat);
+      instanceBuffer.SetData(instances[texture].data(), instances[texture].size());
+
+      Geometry geometry = Geometry::New();
+      geometry.AddVertexBuffer(cornerBuffer);
+      geometry.AddVertexBuffer(instanceBuffer);
+      geometry.SetType(Geometry::TRIANGLES);
+
+      Renderer renderer = Renderer::New(geometry, shader);
+      renderer.SetTextures(textureSets[texture]);
+      renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::OFF);
+      mInstancedActor.AddRenderer(renderer);
+    }
+    Window window = mApplication.GetWindow();
+    window.Add(mInstancedActor);
+  }
+
   void OnAnimationEnd(Animation& source)
   {
     if(source == mShow)
@@ -314,6 +504,7 @@ public:
     }
     else
     {
+      mHarness.FinishRecording();
       mApplication.Quit();
     }
   }
@@ -333,40 +524,52 @@ public:
     float totalDuration(10.0f);
     float durationPerActor(0.5f);
     float delayBetweenActors = (totalDuration - durationPerActor) / (mRowsPerPage * mColumnsPerPage);
-    for(size_t i(0); i < totalColumns; ++i)
+    if(gUseInstancing)
     {
-      xpos = mSize.x * i;
-
-      for(size_t j(0); j < mRowsPerPage; ++j)
+      // The shader plays the animation of every image from the time of the show
+      mInstancedActor.RegisterProperty("uInstanceDuration", durationPerActor);
+      mInstancedActor.RegisterProperty("uShowPosition", initialPosition);
+      mInstancedActor.RegisterProperty("uShowDelay", delayBetweenActors);
+      mShow.AnimateTo(Property(mInstancedActor, mInstancedActor.GetPropertyIndex("uShowTime")), totalDuration, AlphaFunction::LINEAR, TimePeriod(0.0f, totalDuration));
+    }
+    else
+    {
+      for(size_t i(0); i < totalColumns; ++i)
       {
-        ypos = mSize.y * j;
+        xpos = mSize.x * i;
 
-        float delay    = 0.0f;
-        float duration = 0.0f;
-        if(count < (static_cast<size_t>(mRowsPerPage) * mColumnsPerPage))
-        {
-          duration = durationPerActor;
-          delay    = delayBetweenActors * count;
-        }
-        if(gUseMesh)
-        {
-          mActor[count].SetProperty(Actor::Property::POSITION, initialPosition);
-          mActor[count].SetProperty(Actor::Property::SIZE, Vector3(0.0f, 0.0f, 0.0f));
-          mActor[count].SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(0.0f), Vector3::XAXIS));
-          mShow.AnimateTo(Property(mActor[count], Actor::Property::POSITION), Vector3(xpos + mSize.x * 0.5f, ypos + mSize.y * 0.5f, 0.0f), AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
-          mShow.AnimateTo(Property(mActor[count], Actor::Property::SIZE), mSize, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
-        }
-        else
+        for(size_t j(0); j < mRowsPerPage; ++j)
         {
-          mImageView[count].SetProperty(Actor::Property::POSITION, initialPosition);
-          mImageView[count].SetProperty(Actor::Property::SIZE, Vector3(0.0f, 0.0f, 0.0f));
-          mImageView[count].SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(0.0f), Vector3::XAXIS));
-          mShow.AnimateTo(Property(mImageView[count], Actor::Property::POSITION), Vector3(xpos + mSize.x * 0.5f, ypos + mSize.y * 0.5f, 0.0f), AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
-          mShow.AnimateTo(Property(mImageView[count], Actor::Property::SIZE), mSize, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
+          ypos = mSize.y * j;
+
+          float delay    = 0.0f;
+          float duration = 0.0f;
+          if(count < (static_cast<size_t>(mRowsPerPage) * mColumnsPerPage))
+          {
+            duration = durationPerActor;
+            delay    = delayBetweenActors * count;
+          }
+          if(gUseMesh)
+          {
+            mActor[count].SetProperty(Actor::Property::POSITION, initialPosition);
+            mActor[count].SetProperty(Actor::Property::SIZE, Vector3(0.0f, 0.0f, 0.0f));
+            mActor[count].SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(0.0f), Vector3::XAXIS));
+            mShow.AnimateTo(Property(mActor[count], Actor::Property::POSITION), Vector3(xpos + mSize.x * 0.5f, ypos + mSize.y * 0.5f, 0.0f), AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
+            mShow.AnimateTo(Property(mActor[count], Actor::Property::SIZE), mSize, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
+          }
+          else
+          {
+            mImageView[count].SetProperty(Actor::Property::POSITION, initialPosition);
+            mImageView[count].SetProperty(Actor::Property::SIZE, Vector3(0.0f, 0.0f, 0.0f));
+            mImageView[count].SetProperty(Actor::Property::ORIENTATION, Quaternion(Radian(0.0f), Vector3::XAXIS));
+            mShow.AnimateTo(Property(mImageView[count], Actor::Property::POSITION), Vector3(xpos + mSize.x * 0.5f, ypos + mSize.y * 0.5f, 0.0f), AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
+            mShow.AnimateTo(Property(mImageView[count], Actor::Property::SIZE), mSize, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay, duration));
+          }
+          ++count;
         }
-        ++count;
       }
     }
+    mHarness.StartPhase("show");
     mShow.Play();
     mShow.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
   }
@@ -378,23 +581,35 @@ public:
 
     mScroll = Animation::New(10.0f);
     size_t actorCount(static_cast<size_t>(mRowsPerPage) * mColumnsPerPage * mPageCount);
-    for(size_t i(0); i < actorCount; ++i)
+    if(gUseInstancing)
     {
-      if(gUseMesh)
-      {
-        mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(0.0f, 3.0f));
-        mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(3.0f, 3.0f));
-        mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(6.0f, 2.0f));
-        mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(12.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(8.0f, 2.0f));
-      }
-      else
+      // The grid scrolls as one
+      mScroll.AnimateBy(Property(mInstancedActor, Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(0.0f, 3.0f));
+      mScroll.AnimateBy(Property(mInstancedActor, Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(3.0f, 3.0f));
+      mScroll.AnimateBy(Property(mInstancedActor, Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(6.0f, 2.0f));
+      mScroll.AnimateBy(Property(mInstancedActor, Actor::Property::POSITION), Vector3(12.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(8.0f, 2.0f));
+    }
+    else
+    {
+      for(size_t i(0); i < actorCount; ++i)
       {
-        mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(0.0f, 3.0f));
-        mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(3.0f, 3.0f));
-        mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(6.0f, 2.0f));
-        mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(12.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(8.0f, 2.0f));
+        if(gUseMesh)
+        {
+          mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(0.0f, 3.0f));
+          mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(3.0f, 3.0f));
+          mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(6.0f, 2.0f));
+          mScroll.AnimateBy(Property(mActor[i], Actor::Property::POSITION), Vector3(12.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(8.0f, 2.0f));
+        }
+        else
+        {
+          mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(0.0f, 3.0f));
+          mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(3.0f, 3.0f));
+          mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(-4.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(6.0f, 2.0f));
+          mScroll.AnimateBy(Property(mImageView[i], Actor::Property::POSITION), Vector3(12.0f * windowSize.x, 0.0f, 0.0f), AlphaFunction::EASE_OUT, TimePeriod(8.0f, 2.0f));
+        }
       }
     }
+    mHarness.StartPhase("scroll");
     mScroll.Play();
     mScroll.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
   }
@@ -411,32 +626,48 @@ public:
     float totalDuration(5.0f);
     float durationPerActor(0.5f);
     float delayBetweenActors = (totalDuration - durationPerActor) / (mRowsPerPage * mColumnsPerPage);
-    for(size_t i(0); i < mRowsPerPage; ++i)
+    if(gUseInstancing)
     {
-      for(size_t j(0); j < totalColumns; ++j)
+      // The hide time starts from -1, at which nothing is hidden, so it is animated from 0
+      const float hideDuration = delayBetweenActors * (2u * actorsPerPage - 1u) + 2.0f * durationPerActor;
+      KeyFrames   hideTimes    = KeyFrames::New();
+      hideTimes.Add(0.0f, 0.0f);
+      hideTimes.Add(1.0f, hideDuration);
+      mInstancedActor.RegisterProperty("uInstanceDuration", durationPerActor);
+      mInstancedActor.RegisterProperty("uHideDelay", delayBetweenActors);
+      mInstancedActor.RegisterProperty("uHideDistance", finalZ);
+      mHide.AnimateBetween(Property(mInstancedActor, mInstancedActor.GetPropertyIndex("uHideTime")), hideTimes, AlphaFunction::LINEAR, TimePeriod(0.0f, hideDuration));
+    }
+    else
+    {
+      for(size_t i(0); i < mRowsPerPage; ++i)
       {
-        float delay    = 0.0f;
-        float duration = 0.0f;
-        if(count < actorsPerPage)
-        {
-          duration = durationPerActor;
-          delay    = delayBetweenActors * count;
-        }
-
-        if(gUseMesh)
+        for(size_t j(0); j < totalColumns; ++j)
         {
-          mHide.AnimateTo(Property(mActor[count], Actor::Property::ORIENTATION), Quaternion(Radian(Degree(70.0f)), Vector3::XAXIS), AlphaFunction::EASE_OUT, TimePeriod(delay, duration));
-          mHide.AnimateBy(Property(mActor[count], Actor::Property::POSITION_Z), finalZ, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay + delayBetweenActors * actorsPerPage + duration, duration));
+          float delay    = 0.0f;
+          float duration = 0.0f;
+          if(count < actorsPerPage)
+          {
+            duration = durationPerActor;
+            delay    = delayBetweenActors * count;
+          }
+
+          if(gUseMesh)
+          {
+            mHide.AnimateTo(Property(mActor[count], Actor::Property::ORIENTATION), Quaternion(Radian(Degree(70.0f)), Vector3::XAXIS), AlphaFunction::EASE_OUT, TimePeriod(delay, duration));
+            mHide.AnimateBy(Property(mActor[count], Actor::Property::POSITION_Z), finalZ, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay + delayBetweenActors * actorsPerPage + duration, duration));
+          }
+          else
+          {
+            mHide.AnimateTo(Property(mImageView[count], Actor::Property::ORIENTATION), Quaternion(Radian(Degree(70.0f)), Vector3::XAXIS), AlphaFunction::EASE_OUT, TimePeriod(delay, duration));
+            mHide.AnimateBy(Property(mImageView[count], Actor::Property::POSITION_Z), finalZ, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay + delayBetweenActors * actorsPerPage + duration, duration));
+          }
+          ++count;
         }
-        else
-        {
-          mHide.AnimateTo(Property(mImageView[count], Actor::Property::ORIENTATION), Quaternion(Radian(Degree(70.0f)), Vector3::XAXIS), AlphaFunction::EASE_OUT, TimePeriod(delay, duration));
-          mHide.AnimateBy(Property(mImageView[count], Actor::Property::POSITION_Z), finalZ, AlphaFunction::EASE_OUT_BACK, TimePeriod(delay + delayBetweenActors * actorsPerPage + duration, duration));
-        }
-        ++count;
       }
     }
 
+    mHarness.StartPhase("hide");
     mHide.Play();
     mHide.FinishedSignal().Connect(this, &Benchmark::OnAnimationEnd);
   }
@@ -453,10 +684,12 @@ public:
   }
 
 private:
-  Application& mApplication;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness& mHarness;
 
   std::vector<Actor>     mActor;
   std::vector<ImageView> mImageView;
+  Actor                  mInstancedActor;
 
   Vector3      mSize;
   unsigned int mRowsPerPage;
@@ -470,34 +703,36 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  DemoHelper::BenchmarkHarness harness("benchmark", "benchmark.example");
+  harness.AddOption("rows", "-r", "Number of rows per page", gRowsPerPage);
+  harness.AddOption("columns", "-c", "Number of columns per page", gColumnsPerPage);
+  harness.AddOption("pages", "-p", "Number of pages", gPageCount);
+  harness.AddFlag("useMesh", "--use-mesh", "Shares renderers between actors", gUseMesh);
+  harness.AddFlag("ninePatch", "--nine-patch", "Uses nine patch images", gNinePatch);
+  harness.AddFlag("atlas", "--atlas", "Packs the images into atlas textures, implies --use-mesh", gUseAtlas);
+  harness.AddFlag("instanced", "--instanced", "Draws the grid from one actor, its images animated by the shader", gUseInstancing);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  // The atlas is drawn by the shared renderers of the mesh actors
+  gUseMesh = gUseMesh || gUseAtlas;
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
   Application application = Application::New(&argc, &argv);
 
-  for(int i(1); i < argc; ++i)
+  if(harness.IsHelpRequested())
   {
-    std::string arg(argv[i]);
-    if(arg.compare("--use-mesh") == 0)
-    {
-      gUseMesh = true;
-    }
-    else if(arg.compare("--nine-patch") == 0)
-    {
-      gNinePatch = true;
-    }
-    else if(arg.compare(0, 2, "-r") == 0)
-    {
-      gRowsPerPage = atoi(arg.substr(2, arg.size()).c_str());
-    }
-    else if(arg.compare(0, 2, "-c") == 0)
-    {
-      gColumnsPerPage = atoi(arg.substr(2, arg.size()).c_str());
-    }
-    else if(arg.compare(0, 2, "-p") == 0)
-    {
-      gPageCount = atoi(arg.substr(2, arg.size()).c_str());
-    }
+    harness.PrintHelp();
+    return 0;
   }
 
-  Benchmark test(application);
+  Benchmark test(application, harness);
   application.MainLoop();
 
   return 0;
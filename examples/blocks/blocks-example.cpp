@@ -24,6 +24,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -247,6 +249,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     application.GetWindow().KeyEventSignal().Connect(this, &ExampleController::OnKeyEvent);
 
     // Creates a default view with a default tool bar.
@@ -860,6 +864,7 @@ private:
   int                        mBrickCount;          ///< Total bricks on screen.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -867,3 +872,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ExampleController)
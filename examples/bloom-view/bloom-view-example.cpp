@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/bloom-view/bloom-view.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -69,6 +71,8 @@ public:
 public:
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window  window     = application.GetWindow();
     Vector2 windowSize = window.GetSize();
     Vector2 viewSize(windowSize);
@@ -206,6 +210,7 @@ private:
   BloomView mBloomView;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
@@ -215,3 +220,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(BloomExample)
@@ -18,6 +18,12 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/bubble-effect/bubble-emitter.h>
 #include <dali/dali.h>
+#include <cmath>
+#include "pooled-bubble-emitter.h"
+#include "shared/allocation-counter.h"
+#include "shared/benchmark-harness.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -53,14 +59,35 @@ const unsigned int NUM_BUBBLE_SHAPE_IMAGES(sizeof(BUBBLE_SHAPE_IMAGES) / sizeof(
 const Vector2      DEFAULT_BUBBLE_SIZE(10.f, 30.f);
 const unsigned int DEFAULT_NUMBER_OF_BUBBLES(1000);
 
+const float BENCHMARK_PATH_PERIOD(4.f); // seconds the emission takes to go round its path during the benchmark
+
+bool         gPooled(false);
+unsigned int gEmitRate(4u);
+float        gBenchmarkDuration(10.f);
+
 } // namespace
 
 // This example shows the usage of BubbleEmitter which displays lots of moving bubbles on the window.
+//
+// With --pooled, the bubbles are emitted from the fixed pool of a PooledBubbleEmitter, animated by a single time
+// uniform, instead of by an animation per four bubbles. With --timing-output, it emits bubbles along a circle for a
+// while, records the frame times and the numbers of animations created, properties animated and vertex uploads,
+// then quits, e.g.:
+//
+// ./bubble-effect.example --sweep=pooled=0,1 --sweep=emitRate=4,16,64
+//
+// Built with ENABLE_ALLOCATION_COUNTING, it also records the heap allocations the event thread makes per bubble emitted.
+//
 class BubbleEffectExample : public ConnectionTracker
 {
 public:
-  BubbleEffectExample(Application& app)
+  /**
+   * @param[in] app The DALi application instance
+   * @param[in] harness Records the frame times of a sustained emission, if given
+   */
+  BubbleEffectExample(Application& app, DemoHelper::BenchmarkHarness* harness = nullptr)
   : mApp(app),
+    mHarness(harness),
     mBackground(),
     mBubbleEmitter(),
     mEmitAnimation(),
@@ -75,6 +102,11 @@ public:
     mTimerInterval(16),
     mCurrentBackgroundImageId(0),
     mCurrentBubbleShapeImageId(0),
+    mBenchmarkTickCount(0),
+    mAnimationCount(0),
+    mAnimatedPropertyCount(0),
+    mEmissionCount(0),
+    mEmissionAllocationCount(0),
     mNeedNewAnimation(true)
   {
     // Connect to the Application's Init signal
@@ -89,6 +121,8 @@ private:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     Window  window     = app.GetWindow();
     Vector2 windowSize = window.GetSize();
 
@@ -123,16 +157,32 @@ private:
                        Toolkit::Alignment::HORIZONTAL_LEFT,
                        DemoHelper::DEFAULT_MODE_SWITCH_PADDING);
 
-    // Create and initialize the BubbleEmitter object
-    mBubbleEmitter = Toolkit::BubbleEmitter::New(windowSize,
-                                                 DemoHelper::LoadTexture(BUBBLE_SHAPE_IMAGES[mCurrentBubbleShapeImageId]),
-                                                 DEFAULT_NUMBER_OF_BUBBLES,
-                                                 DEFAULT_BUBBLE_SIZE);
+    // Create and initialize the emitter
+    Actor bubbleRoot;
+    if(gPooled)
+    {
+      mPooledEmitter.Initialize(windowSize, DemoHelper::LoadTexture(BUBBLE_SHAPE_IMAGES[mCurrentBubbleShapeImageId]), DEFAULT_NUMBER_OF_BUBBLES, DEFAULT_BUBBLE_SIZE);
+      mPooledEmitter.SetBackground(DemoHelper::LoadWindowFillingTexture(window.GetSize(), BACKGROUND_IMAGES[mCurrentBackgroundImageId]));
+      bubbleRoot = mPooledEmitter.GetRootActor();
 
-    mBubbleEmitter.SetBackground(DemoHelper::LoadWindowFillingTexture(window.GetSize(), BACKGROUND_IMAGES[mCurrentBackgroundImageId]), mHSVDelta);
+      // the one animation of the time uniform
+      mAnimationCount        = 1;
+      mAnimatedPropertyCount = 1;
+    }
+    else
+    {
+      mBubbleEmitter = Toolkit::BubbleEmitter::New(windowSize,
+                                                   DemoHelper::LoadTexture(BUBBLE_SHAPE_IMAGES[mCurrentBubbleShapeImageId]),
+                                                   DEFAULT_NUMBER_OF_BUBBLES,
+                                                   DEFAULT_BUBBLE_SIZE);
 
-    // Get the root actor of all bubbles, and add it to window.
-    Actor bubbleRoot = mBubbleEmitter.GetRootActor();
+      mBubbleEmitter.SetBackground(DemoHelper::LoadWindowFillingTexture(window.GetSize(), BACKGROUND_IMAGES[mCurrentBackgroundImageId]), mHSVDelta);
+
+      // Get the root actor of all bubbles
+      bubbleRoot = mBubbleEmitter.GetRootActor();
+    }
+
+    // Add the bubbles to the window.
     bubbleRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
     bubbleRoot.SetProperty(Actor::Property::POSITION_Z, 0.1f); // Make sure the bubbles displayed on top og the background.
     content.Add(bubbleRoot);
@@ -146,6 +196,18 @@ private:
 
     // Connect the callback to the touch signal on the background
     mBackground.TouchedSignal().Connect(this, &BubbleEffectExample::OnTouch);
+
+    if(mHarness)
+    {
+      mHarness->StartRecording(window.GetRootLayer());
+    }
+    if(mHarness && mHarness->IsRecording())
+    {
+      mHarness->StartPhase("emit");
+      mBenchmarkTimer = Timer::New(mTimerInterval);
+      mBenchmarkTimer.TickSignal().Connect(this, &BubbleEffectExample::OnBenchmarkTick);
+      mBenchmarkTimer.Start();
+    }
   }
 
   /***********
@@ -153,19 +215,28 @@ private:
  *****************/
 
   // Set up the animation of emitting bubbles, to be efficient, every animation controls multiple emission ( 4 here )
+  // The pooled emitter needs no animation, it only writes the bubble into its pool.
   void SetUpAnimation(Vector2 emitPosition, Vector2 direction)
   {
+    if(gPooled)
+    {
+      mPooledEmitter.EmitBubble(emitPosition, direction + Vector2(0.f, 30.f) /* upwards */, Vector2(300, 600), Random::Range(1.f, 1.5f));
+      return;
+    }
+
     if(mNeedNewAnimation)
     {
       float duration         = Random::Range(1.f, 1.5f);
       mEmitAnimation         = Animation::New(duration);
       mNeedNewAnimation      = false;
       mAnimateComponentCount = 0;
+      mAnimationCount++;
     }
 
     mBubbleEmitter.EmitBubble(mEmitAnimation, emitPosition, direction + Vector2(0.f, 30.f) /* upwards */, Vector2(300, 600));
 
     mAnimateComponentCount++;
+    mAnimatedPropertyCount++;
 
     if(mAnimateComponentCount % 4 == 0)
     {
@@ -187,6 +258,7 @@ private:
         {
           SetUpAnimation(mCurrentTouchPosition + Vector2(rand() % 5, rand() % 5), Vector2(rand() % 60 - 30, rand() % 100 - 50));
         }
+        FlushBubbles();
       }
     }
     else
@@ -198,6 +270,58 @@ private:
     return true;
   }
 
+  // Uploads the bubbles emitted into the pool, once per batch of emissions
+  void FlushBubbles()
+  {
+    if(gPooled)
+    {
+      mPooledEmitter.Flush();
+    }
+  }
+
+  // Emits bubbles every tick from a point going round a circle, as a finger moving steadily, until the benchmark ends
+  bool OnBenchmarkTick()
+  {
+    const float elapsed = static_cast<float>(++mBenchmarkTickCount * mTimerInterval) * 0.001f;
+    if(elapsed >= gBenchmarkDuration)
+    {
+      OnBenchmarkFinished();
+      return false;
+    }
+
+    const Vector2 windowSize = mApp.GetWindow().GetSize();
+    const float   angle      = elapsed * Math::PI * 2.f / BENCHMARK_PATH_PERIOD;
+    const Vector2 direction(-std::sin(angle), std::cos(angle));
+    const Vector2 position = windowSize * 0.5f + Vector2(std::cos(angle), std::sin(angle)) * std::min(windowSize.width, windowSize.height) * 0.3f;
+
+    const uint64_t allocationCount = DemoHelper::AllocationCounter::GetThreadAllocationCount();
+    for(unsigned int i = 0; i < gEmitRate; i++)
+    {
+      SetUpAnimation(position + Vector2(rand() % 5, rand() % 5), direction * 30.f);
+    }
+    FlushBubbles();
+    mEmissionAllocationCount += DemoHelper::AllocationCounter::GetThreadAllocationCount() - allocationCount;
+    mEmissionCount           += gEmitRate;
+    return true;
+  }
+
+  void OnBenchmarkFinished()
+  {
+    if(!gPooled)
+    {
+      mEmitAnimation.Play();
+    }
+    mHarness->SetParameter("animationsCreated", static_cast<double>(mAnimationCount));
+    mHarness->SetParameter("animatedProperties", static_cast<double>(mAnimatedPropertyCount));
+    mHarness->SetParameter("vertexUploads", static_cast<double>(gPooled ? mPooledEmitter.GetUploadCount() : 0u));
+    if(DemoHelper::AllocationCounter::IsEnabled() && mEmissionCount > 0u)
+    {
+      mHarness->SetParameter("allocationsPerEmission", static_cast<double>(mEmissionAllocationCount) / mEmissionCount);
+    }
+    mHarness->FinishRecording();
+    mApp.Quit();
+  }
+
   // Callback function of the touch signal on the background
   bool OnTouch(Dali::Actor actor, const Dali::TouchEvent& event)
   {
@@ -221,6 +345,7 @@ private:
         {
           SetUpAnimation(mCurrentTouchPosition + displacement * (i / step), displacement);
         }
+        FlushBubbles();
         break;
       }
       case PointState::UP:
@@ -228,7 +353,10 @@ private:
       case PointState::INTERRUPTED:
       {
         mTimerForBubbleEmission.Stop();
-        mEmitAnimation.Play();
+        if(!gPooled)
+        {
+          mEmitAnimation.Play();
+        }
         mNeedNewAnimation      = true;
         mAnimateComponentCount = 0;
         break;
@@ -249,14 +377,30 @@ private:
       mCurrentBackgroundImageId = (mCurrentBackgroundImageId + 1) % NUM_BACKGROUND_IMAGES;
 
       //Update bubble emitter background
-      mBubbleEmitter.SetBackground(DemoHelper::LoadWindowFillingTexture(mApp.GetWindow().GetSize(), BACKGROUND_IMAGES[mCurrentBackgroundImageId]), mHSVDelta);
+      Texture background = DemoHelper::LoadWindowFillingTexture(mApp.GetWindow().GetSize(), BACKGROUND_IMAGES[mCurrentBackgroundImageId]);
+      if(gPooled)
+      {
+        mPooledEmitter.SetBackground(background);
+      }
+      else
+      {
+        mBubbleEmitter.SetBackground(background, mHSVDelta);
+      }
 
       // Set the application background
       mBackground.SetProperty(Toolkit::Control::Property::BACKGROUND, BACKGROUND_IMAGES[mCurrentBackgroundImageId]);
     }
     else if(button == mChangeBubbleShapeButton)
     {
-      mBubbleEmitter.SetBubbleShape(DemoHelper::LoadTexture(BUBBLE_SHAPE_IMAGES[++mCurrentBubbleShapeImageId % NUM_BUBBLE_SHAPE_IMAGES]));
+      Texture shape = DemoHelper::LoadTexture(BUBBLE_SHAPE_IMAGES[++mCurrentBubbleShapeImageId % NUM_BUBBLE_SHAPE_IMAGES]);
+      if(gPooled)
+      {
+        mPooledEmitter.SetBubbleShape(shape);
+      }
+      else
+      {
+        mBubbleEmitter.SetBubbleShape(shape);
+      }
     }
     return true;
   }
@@ -276,14 +420,17 @@ private:
   }
 
 private:
-  Application&           mApp;
-  Dali::Toolkit::Control mBackground;
+  Application&                  mApp;
+  DemoHelper::BenchmarkHarness* mHarness;
+  Dali::Toolkit::Control        mBackground;
 
   Toolkit::BubbleEmitter mBubbleEmitter;
+  PooledBubbleEmitter    mPooledEmitter;
   Animation              mEmitAnimation;
   Toolkit::PushButton    mChangeBackgroundButton;
   Toolkit::PushButton    mChangeBubbleShapeButton;
   Timer                  mTimerForBubbleEmission;
+  Timer                  mBenchmarkTimer;
 
   Vector3 mHSVDelta;
   Vector2 mCurrentTouchPosition;
@@ -294,16 +441,48 @@ private:
   unsigned int mTimerInterval;
   unsigned int mCurrentBackgroundImageId;
   unsigned int mCurrentBubbleShapeImageId;
+  unsigned int mBenchmarkTickCount;
+  unsigned int mAnimationCount;          ///< Animations created to emit bubbles
+  unsigned int mAnimatedPropertyCount;   ///< Properties bound to an animation to emit bubbles
+  unsigned int mEmissionCount;           ///< Bubbles emitted during the benchmark
+  uint64_t     mEmissionAllocationCount; ///< Heap allocations of the event thread while emitting, if counted
 
   bool mNeedNewAnimation;
 };
 
 /*****************************************************************************/
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application         app = Application::New(&argc, &argv, DEMO_THEME_PATH);
-  BubbleEffectExample theApp(app);
+  DemoHelper::BenchmarkHarness harness("bubble-effect", "bubble-effect.example");
+  harness.AddFlag("pooled", "--pooled", "Emits the bubbles from a fixed pool animated by one time uniform", gPooled);
+  harness.AddOption("emitRate", "-e", "Bubbles emitted every 16 ms during the benchmark", gEmitRate);
+  harness.AddOption("duration", "-t", "Seconds of emission during the benchmark", gBenchmarkDuration);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  Application app = Application::New(&argc, &argv, DEMO_THEME_PATH);
+
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  BubbleEffectExample theApp(app, &harness);
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(BubbleEffectExample)
+
+DALI_DEMO_ALLOCATION_COUNTER()
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "pooled-bubble-emitter.h"
+
+// EXTERNAL INCLUDES
+#include <dali/dali.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace Dali;
+
+namespace
+{
+const char* TIME_UNIFORM_NAME("uTime");
+
+const float GRAVITY(50.0f); ///< The drop of the bubbles over their movement, as the gravity of Toolkit::BubbleEmitter
+
+// clang-format off
+const char* VERTEX_SHADER = DALI_COMPOSE_SHADER(
+  attribute mediump vec2 aPosition;\n
+  attribute mediump vec2 aTexCoord;\n
+  attribute highp   vec4 aStartEndPosition;\n
+  attribute highp   vec2 aLife;\n
+  uniform   mediump mat4 uMvpMatrix;\n
+  uniform   highp   float uTime;\n
+  uniform   mediump float uGravity;\n
+  uniform   mediump vec2 uInvertedMovementArea;\n
+  varying   mediump vec2 vTexCoord;\n
+  varying   mediump float vPercentage;\n
+  varying   mediump vec2 vEffectTexCoord;\n
+  \n
+  void main()\n
+  {\n
+    float percentage = (uTime - aLife.x) / aLife.y;\n
+    // hide the bubbles not emitted yet, or which have finished moving
+    if(percentage <= 0.0 || percentage >= 1.0)\n
+    {\n
+      gl_Position = vec4(0.0);\n
+      return;\n
+    }\n
+    \n
+    // grow during the first fifth of the movement
+    vec4 position = vec4(aPosition * min(percentage * 5.0, 1.0), 0.0, 1.0);\n
+    position.xy += mix(aStartEndPosition.xy, aStartEndPosition.zw, percentage);\n
+    position.y += uGravity * percentage * percentage;\n
+    gl_Position = uMvpMatrix * position;\n
+    vTexCoord = aTexCoord;\n
+    vPercentage = percentage;\n
+    // the color of the background where the bubble was emitted
+    vEffectTexCoord = aStartEndPosition.xy * uInvertedMovementArea + vec2(0.5);\n
+  }\n
+);
+
+const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
+  uniform lowp    vec4 uColor;\n
+  uniform sampler2D    sBackground;\n
+  uniform sampler2D    sBubbleShape;\n
+  varying mediump vec2 vTexCoord;\n
+  varying mediump float vPercentage;\n
+  varying mediump vec2 vEffectTexCoord;\n
+  \n
+  void main()\n
+  {\n
+    mediump vec4 fragColor = texture2D(sBackground, vEffectTexCoord) * uColor;\n
+    // 0.7 opaque in the shape of the bubble, fading out during the last third of the movement
+    fragColor.a *= texture2D(sBubbleShape, vTexCoord).a * (2.1 - max(vPercentage * 2.1, 1.4));\n
+    gl_FragColor = fragColor;\n
+  }\n
+);
+// clang-format on
+
+const Vector2 CORNERS[] = {Vector2(-0.5f, -0.5f), Vector2(-0.5f, 0.5f), Vector2(0.5f, 0.5f), Vector2(0.5f, -0.5f)};
+
+} // unnamed namespace
+
+PooledBubbleEmitter::PooledBubbleEmitter()
+: mCapacity(0u),
+  mNextSlot(0u),
+  mUploadCount(0u),
+  mDirty(false)
+{
+}
+
+void PooledBubbleEmitter::Initialize(const Vector2& movementArea, Texture shapeTexture, unsigned int capacity, const Vector2& bubbleSizeRange)
+{
+  mMovementArea = movementArea;
+  mCapacity     = std::min(std::max(capacity, 1u), MAXIMUM_CAPACITY);
+
+  // Every slot keeps its size; its life starts dead, as if emitted long ago
+  std::vector<unsigned short> indices;
+  mVertices.reserve(mCapacity * 4u);
+  indices.reserve(mCapacity * 6u);
+  for(unsigned int slot = 0u; slot < mCapacity; ++slot)
+  {
+    const float          size        = Random::Range(bubbleSizeRange.x, bubbleSizeRange.y);
+    const unsigned short firstVertex = static_cast<unsigned short>(mVertices.size());
+    for(const Vector2& corner : CORNERS)
+    {
+      mVertices.push_back(Vertex{corner * size, corner + Vector2(0.5f, 0.5f), Vector4::ZERO, Vector2(-TIME_PERIOD, 1.0f)});
+    }
+    for(unsigned short index : {0, 1, 2, 0, 2, 3})
+    {
+      indices.push_back(static_cast<unsigned short>(firstVertex + index));
+    }
+  }
+
+  Property::Map vertexFormat;
+  vertexFormat["aPosition"]         = Property::VECTOR2;
+  vertexFormat["aTexCoord"]         = Property::VECTOR2;
+  vertexFormat["aStartEndPosition"] = Property::VECTOR4;
+  vertexFormat["aLife"]             = Property::VECTOR2;
+  mVertexBuffer                     = VertexBuffer::New(vertexFormat);
+  mVertexBuffer.SetData(&mVertices[0], mVertices.size());
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer(mVertexBuffer);
+  geometry.SetIndexBuffer(&indices[0], indices.size());
+  geometry.SetType(Geometry::TRIANGLES);
+
+  TextureSet textureSet = TextureSet::New();
+  textureSet.SetTexture(1u, shapeTexture);
+
+  Shader shader = Shader::New(VERTEX_SHADER, FRAGMENT_SHADER);
+  mRenderer     = Renderer::New(geometry, shader);
+  mRenderer.SetTextures(textureSet);
+  mRenderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+
+  mRootActor = Actor::New();
+  mRootActor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+  mRootActor.SetProperty(Actor::Property::SIZE, movementArea);
+  mRootActor.RegisterProperty("uGravity", GRAVITY);
+  mRootActor.RegisterProperty("uInvertedMovementArea", Vector2(1.0f / movementArea.width, 1.0f / movementArea.height));
+  Property::Index timeIndex = mRootActor.RegisterProperty(TIME_UNIFORM_NAME, 0.0f);
+  mRootActor.AddRenderer(mRenderer);
+
+  // The only animation of the emitter, for as long as it lives
+  mTimeAnimation = Animation::New(TIME_PERIOD);
+  mTimeAnimation.AnimateTo(Property(mRootActor, timeIndex), TIME_PERIOD, AlphaFunction::LINEAR);
+  mTimeAnimation.SetLooping(true);
+  mTimeAnimation.Play();
+}
+
+Actor PooledBubbleEmitter::GetRootActor() const
+{
+  return mRootActor;
+}
+
+void PooledBubbleEmitter::SetBackground(Texture background)
+{
+  mRenderer.GetTextures().SetTexture(0u, background);
+}
+
+void PooledBubbleEmitter::SetBubbleShape(Texture shapeTexture)
+{
+  mRenderer.GetTextures().SetTexture(1u, shapeTexture);
+}
+
+void PooledBubbleEmitter::EmitBubble(const Vector2& emitPosition, const Vector2& direction, const Vector2& displacement, float duration)
+{
+  // The same random end position as Toolkit::BubbleEmitter, mostly upwards
+  const Vector2 start     = emitPosition - mMovementArea * 0.5f;
+  const int     halfRange = static_cast<int>(displacement.x) / 2;
+  Vector2       randomVector(static_cast<float>(rand() % static_cast<int>(displacement.x) - halfRange),
+                       static_cast<float>(rand() % static_cast<int>(displacement.y) - halfRange));
+  Vector2       normalizedDirection(direction);
+  normalizedDirection.Normalize();
+  randomVector.x -= normalizedDirection.x * halfRange;
+  randomVector.y *= 1.0f - std::abs(normalizedDirection.x) * 0.33f;
+  if(randomVector.y > 0.0f)
+  {
+    randomVector.y *= 0.33f;
+  }
+
+  const Vector4 startEndPosition(start.x, start.y, start.x + randomVector.x, start.y + randomVector.y);
+  const Vector2 life(mTimeAnimation.GetCurrentProgress() * TIME_PERIOD, duration);
+  for(unsigned int vertex = mNextSlot * 4u; vertex < mNextSlot * 4u + 4u; ++vertex)
+  {
+    mVertices[vertex].aStartEndPosition = startEndPosition;
+    mVertices[vertex].aLife             = life;
+  }
+
+  mNextSlot = (mNextSlot + 1u) % mCapacity;
+  mDirty    = true;
+}
+
+void PooledBubbleEmitter::Flush()
+{
+  if(mDirty)
+  {
+    mVertexBuffer.SetData(&mVertices[0], mVertices.size());
+    ++mUploadCount;
+    mDirty = false;
+  }
+}
+
+unsigned int PooledBubbleEmitter::GetUploadCount() const
+{
+  return mUploadCount;
+}
@@ -0,0 +1,118 @@
+#ifndef DEMO_POOLED_BUBBLE_EMITTER_H
+#define DEMO_POOLED_BUBBLE_EMITTER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/animation/animation.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/texture.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+#include <vector>
+
+/**
+ * @brief Emits bubbles like Toolkit::BubbleEmitter, from a fixed pool of bubbles drawn by one renderer.
+ *
+ * The bubbles are slots of a ring buffer, the oldest reused by every emission. Emitting a bubble writes its start
+ * and end positions and its birth time into the vertices of its slot; the shader moves every bubble by the time
+ * elapsed since its birth, read from one time uniform animated by a single looping animation. Emitting creates no
+ * animation and binds no property, so the cost of a frame doesn't depend on how fast bubbles are emitted.
+ *
+ * The vertices emitted are uploaded by Flush(), once per batch of emissions, as the vertex buffer can only be set
+ * as a whole. Bubbles in flight when the time uniform loops, every TIME_PERIOD seconds, disappear.
+ */
+class PooledBubbleEmitter
+{
+public:
+  static constexpr float        TIME_PERIOD      = 3600.0f;     ///< Seconds before the time uniform loops
+  static constexpr unsigned int MAXIMUM_CAPACITY = 65536u / 4u; ///< Four vertices per bubble, indexed by unsigned short
+
+  /**
+   * @brief Constructor.
+   */
+  PooledBubbleEmitter();
+
+  /**
+   * @brief Creates the actor drawing the bubbles and starts animating the time.
+   * @param[in]  movementArea     The size of the area the bubbles move in, centered on the root actor.
+   * @param[in]  shapeTexture     The texture giving the shape of the bubbles in its alpha channel.
+   * @param[in]  capacity         The number of bubbles, up to MAXIMUM_CAPACITY.
+   * @param[in]  bubbleSizeRange  The minimum and maximum size of the bubbles.
+   */
+  void Initialize(const Dali::Vector2& movementArea, Dali::Texture shapeTexture, unsigned int capacity, const Dali::Vector2& bubbleSizeRange);
+
+  /**
+   * @brief The actor drawing the bubbles, to add to the scene.
+   */
+  Dali::Actor GetRootActor() const;
+
+  /**
+   * @brief Sets the texture the bubbles take their color from, at the position they were emitted.
+   * @param[in]  background  A texture filling the movement area.
+   */
+  void SetBackground(Dali::Texture background);
+
+  /**
+   * @brief Sets the texture giving the shape of the bubbles.
+   */
+  void SetBubbleShape(Dali::Texture shapeTexture);
+
+  /**
+   * @brief Emits a bubble from the oldest slot, moving as those of Toolkit::BubbleEmitter::EmitBubble.
+   * @param[in]  emitPosition  The position to emit from, in screen coordinates.
+   * @param[in]  direction     The direction the bubble moves towards.
+   * @param[in]  displacement  The range of the random displacement of the bubble.
+   * @param[in]  duration      The time the bubble takes to move, in seconds.
+   */
+  void EmitBubble(const Dali::Vector2& emitPosition, const Dali::Vector2& direction, const Dali::Vector2& displacement, float duration);
+
+  /**
+   * @brief Uploads the bubbles emitted since the last flush, if any.
+   */
+  void Flush();
+
+  /**
+   * @brief The number of times the vertices have been uploaded.
+   */
+  unsigned int GetUploadCount() const;
+
+private:
+  struct Vertex
+  {
+    Dali::Vector2 aPosition; ///< The corner of the bubble, scaled by its size
+    Dali::Vector2 aTexCoord;
+    Dali::Vector4 aStartEndPosition; ///< Where the bubble moves from (xy) and to (zw), relative to the center of the area
+    Dali::Vector2 aLife;             ///< The time the bubble was emitted at, and its duration, in seconds
+  };
+
+  Dali::Actor         mRootActor;
+  Dali::Renderer      mRenderer;
+  Dali::VertexBuffer  mVertexBuffer;
+  Dali::Animation     mTimeAnimation; ///< Animates the time uniform, looping
+  std::vector<Vertex> mVertices;      ///< The vertices of every slot, uploaded as a whole
+  Dali::Vector2       mMovementArea;
+  unsigned int        mCapacity;
+  unsigned int        mNextSlot; ///< The oldest slot, emitted from next
+  unsigned int        mUploadCount;
+  bool                mDirty; ///< Whether bubbles were emitted since the last flush
+};
+
+#endif // DEMO_POOLED_BUBBLE_EMITTER_H
@@ -43,6 +43,8 @@
 
 #include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/debug.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #define TOKEN_STRING(x) #x
@@ -465,6 +467,8 @@ public:
 
   void Create(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     Window window = app.GetWindow();
 
     window.KeyEventSignal().Connect(this, &ExampleApp::OnKeyEvent);
@@ -579,6 +583,7 @@ private:
   Timer       mTimer;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 //------------------------------------------------------------------------------
 //
 //
@@ -602,3 +607,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ExampleApp)
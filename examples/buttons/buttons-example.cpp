@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -86,6 +88,8 @@ public:
 
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // The Init signal is received once (only) during the Application lifetime
 
     // Respond to key events
@@ -506,6 +510,7 @@ private:
   Toolkit::ImageView mImage;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -513,3 +518,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ButtonsController)
@@ -17,6 +17,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -47,6 +49,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime.
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -227,6 +231,7 @@ private:
   Application& mApplication;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                   application = Application::New(&argc, &argv);
@@ -234,3 +239,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ClippingDrawOrderVerification)
@@ -23,6 +23,8 @@
 // INTERNAL INCLUDES
 #include "clipping-item-factory.h"
 #include "item-view-orientation-constraint.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -72,6 +74,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Connect to the window's key signal to allow Back and Escape to exit.
     Window window = application.GetWindow();
     window.KeyEventSignal().Connect(this, &ClippingExample::OnKeyEvent);
@@ -200,6 +204,7 @@ private:
   Constraint          mItemViewOrientationConstraint; ///< The constraint used to control the orientation of item-view.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application     app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -207,3 +212,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ClippingExample)
@@ -21,6 +21,8 @@
 #include <dali/dali.h>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -106,6 +108,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -201,6 +205,7 @@ private:
   Application& mApplication;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                        application = Application::New(&argc, &argv);
@@ -208,3 +213,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(CompressedTextureFormatsController)
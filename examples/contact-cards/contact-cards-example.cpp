@@ -25,6 +25,8 @@
 // INTERNAL INCLUDES
 #include "contact-card-layouter.h"
 #include "contact-data.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -76,6 +78,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Set the window background color and connect to the window's key signal to allow Back and Escape to exit.
     Window window = application.GetWindow();
     window.SetBackgroundColor(WINDOW_COLOR);
@@ -113,6 +117,7 @@ private:
   ContactCardLayouter mContactCardLayouter; ///< The contact card layouter.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv, THEME_PATH);
@@ -120,3 +125,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ContactCardController)
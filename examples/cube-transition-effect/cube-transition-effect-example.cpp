@@ -19,6 +19,8 @@
 #include <math.h>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -206,6 +208,8 @@ CubeTransitionApp::~CubeTransitionApp()
 
 void CubeTransitionApp::OnInit(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   application.GetWindow().KeyEventSignal().Connect(this, &CubeTransitionApp::OnKeyEvent);
 
   // Creates a default view with a default tool bar, the view is added to the window.
@@ -406,6 +410,7 @@ void CubeTransitionApp::OnKeyEvent(const KeyEvent& event)
   }
 }
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -414,3 +419,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(CubeTransitionApp)
@@ -20,6 +20,7 @@
 #include "dali/dali.h"
 #include "dali/public-api/actors/actor.h"
 #include "dali/public-api/rendering/renderer.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 
@@ -504,6 +505,8 @@ public:
 private:
   void Create(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     // Grab window, configure layer
     Window window    = app.GetWindow();
     auto   rootLayer = window.GetRootLayer();
@@ -19,6 +19,8 @@
 #include <math.h>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -211,6 +213,8 @@ DissolveEffectApp::~DissolveEffectApp()
 
 void DissolveEffectApp::OnInit(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   auto    window     = application.GetWindow();
   Vector2 windowSize = window.GetSize();
   window.KeyEventSignal().Connect(this, &DissolveEffectApp::OnKeyEvent);
@@ -434,6 +438,7 @@ bool DissolveEffectApp::OnTimerTick()
   return false; //return false to stop the timer
 }
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -442,3 +447,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(DissolveEffectApp)
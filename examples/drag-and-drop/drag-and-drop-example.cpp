@@ -19,6 +19,8 @@
 #include <dali-toolkit/devel-api/drag-drop-detector/drag-and-drop-detector.h>
 #include <dali/devel-api/actors/actor-devel.h>
 #include <dali/integration-api/debug.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
@@ -71,6 +73,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     auto window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
 
@@ -270,6 +274,7 @@ private:
   Vector2 mDragLocalPos;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application        application = Application::New(&argc, &argv);
@@ -277,3 +282,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(DragAndDropExample)
@@ -18,6 +18,8 @@
 // EXTERNAL INCLUDES
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -116,6 +118,8 @@ EffectsViewApp::~EffectsViewApp()
 
 void EffectsViewApp::OnAppInitialize(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   // The Init signal is received once (only) during the Application lifetime
 
   auto window = application.GetWindow();
@@ -241,6 +245,7 @@ void EffectsViewApp::OnKeyEvent(const KeyEvent& event)
 
 /*****************************************************************************/
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application    application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -248,3 +253,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(EffectsViewApp)
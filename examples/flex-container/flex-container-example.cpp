@@ -16,6 +16,8 @@
  */
 
 #include <sstream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -111,6 +113,8 @@ public:
    */
   void OnInit(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     auto window = app.GetWindow();
     window.KeyEventSignal().Connect(this, &FlexContainerExample::OnKeyEvent);
     window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR, Layer::LAYER_3D);
@@ -356,6 +360,7 @@ private:
   Toolkit::PushButton mAlignContentButton;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application          app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -363,3 +368,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(FlexContainerExample)
@@ -17,6 +17,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -51,6 +53,8 @@ public:
 
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     mWindow            = application.GetWindow();
     Vector2 windowSize = mWindow.GetSize();
     mContentLayer      = DemoHelper::CreateView(application,
@@ -191,6 +195,7 @@ private:
   Layer            mContentLayer; ///< Content layer.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 //
 int DALI_EXPORT_API main(int argc, char** argv)
 {
@@ -202,3 +207,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(FocusIntegrationExample)
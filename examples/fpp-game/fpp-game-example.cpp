@@ -23,6 +23,17 @@
 #include "fpp-game-tutorial-controller.h"
 
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/integration-api/debug.h>
+#include <stdio.h>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "shared/benchmark-harness.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
+#include "third-party/pico-json.h"
 
 using namespace Dali;
 
@@ -32,6 +43,87 @@ const char* SCENE_URL =
   {
     DEMO_GAME_DIR "/scene.json"};
 
+const unsigned int BENCHMARK_RENDER_TIME(2000u); ///< Milliseconds of frames recorded after the parse benchmark
+
+unsigned int gSceneEntities(50000u);
+unsigned int gParseRepeats(10u);
+bool         gLoadInBackground(true);
+
+/**
+ * Milliseconds elapsed since the given time
+ */
+double GetMillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Appends a number given in millionths with six decimals, as the exporter of scene.json writes them, whatever the locale
+ */
+void AppendMillionths(std::string& text, int millionths)
+{
+  char digits[32];
+  snprintf(digits, sizeof(digits), "%s%d.%06d", millionths < 0 ? "-" : "", std::abs(millionths) / 1000000, std::abs(millionths) % 1000000);
+  text += digits;
+}
+
+/**
+ * Creates a scene of crates laid out in a grid, in the format of scene.json
+ */
+std::string GenerateScene(unsigned int entityCount)
+{
+  std::string text("{\n");
+  char        line[128];
+  for(unsigned int i = 0u; i < entityCount; ++i)
+  {
+    snprintf(line, sizeof(line), "%s  \"crate.%06u\" : {\n    \"uid\" : %llu,\n    \"location\" : [ ", i ? ",\n" : "", i, 140636849641992ull + i);
+    text += line;
+    AppendMillionths(text, static_cast<int>(i % 256u) * 1156036 - 150000000);
+    text += ", ";
+    AppendMillionths(text, static_cast<int>(i / 256u) * 1156036 - 150000000);
+    text += ", -0.438286 ],\n    \"rotation\" : [ -0.000000, -0.000000, ";
+    AppendMillionths(text, static_cast<int>(i % 1000u) * 997 - 500000);
+    text += ", 0.977632 ],\n    \"scale\" : [ 1.000000, 1.000000, 1.000000 ],\n    \"size\" : [ 1.156036, 1.156036, 1.156036 ],\n";
+    snprintf(line, sizeof(line), "    \"model\" : \"Cube.mod\",\n    \"texture\" : \"lm_crate.%03u.png\"\n  }", i % 64u);
+    text += line;
+  }
+  return text + "\n}\n";
+}
+
+/**
+ * Reads the entities as GameScene::Load did before it used DemoHelper::JsonReader: a picojson document copied and walked
+ * with lookups, returns the number of entities
+ */
+unsigned int ReadSceneWithPicojson(const std::string& text)
+{
+  picojson::value root;
+  picojson::parse(root, text);
+  if(!root.is<picojson::object>())
+  {
+    return 0u;
+  }
+
+  unsigned int     entityCount = 0u;
+  double           sum         = 0.0;
+  picojson::object rootObject  = root.get<picojson::object>();
+  for(picojson::object::iterator it = rootObject.begin(); it != rootObject.end(); ++it)
+  {
+    picojson::value& entity = it->second;
+    for(const char* key : {"location", "rotation", "scale", "size"})
+    {
+      picojson::value& value = entity.get(key);
+      if(!value.is<picojson::null>())
+      {
+        picojson::array& values = value.get<picojson::array>();
+        sum += values.at(0).get<double>() + values.at(1).get<double>() + values.at(2).get<double>();
+      }
+    }
+    sum += static_cast<double>(entity.get("model").get<std::string>().size() + entity.get("texture").get<std::string>().size());
+    ++entityCount;
+  }
+  return sum != 0.0 ? entityCount : 0u;
+}
+
 }
 /* This example creates 3D environment with first person camera control
    It contains following modules:
@@ -72,12 +164,25 @@ const char* SCENE_URL =
 .--------------.  .--------------.
 | GameTexture  |  |  GameModel   |
 '--------------'  '--------------'
+
+   With --timing-output, it times reading a synthetic scene of -e entities, with GameScene::ReadEntities() and with
+   the picojson document it used before, -r times over. It then times loading scene.json until the first frame is
+   rendered ("firstFrame") and until the first frame showing every entity is ("completeFrame"), records the frame
+   times for a while, then quits. --sync-loading loads the models and textures on the event thread, as it did before
+   the worker threads, e.g.:
+
+   ./fpp-game.example --timing-output=fpp-game.json --sweep=syncLoading=0,1
  */
 class GameController : public ConnectionTracker
 {
 public:
-  GameController(Application& application)
-  : mApplication(application)
+  /**
+   * @param[in] application The DALi application instance
+   * @param[in] harness Records the parse times of a synthetic scene and the frame times, if given
+   */
+  GameController(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr)
+  : mApplication(application),
+    mHarness(harness)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &GameController::Create);
@@ -90,6 +195,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     mWindow = application.GetWindow();
 
@@ -98,8 +205,31 @@ public:
     // Use 3D layer
     mWindow.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR, Layer::LAYER_3D);
 
-    // Load game scene
-    mScene.Load(mWindow, SCENE_URL);
+    if(mHarness)
+    {
+      mHarness->StartRecording(mWindow.GetRootLayer());
+    }
+    const bool recording = mHarness && mHarness->IsRecording();
+    if(recording)
+    {
+      // Before the scene, so its loading doesn't disturb the parse times
+      mHarness->StartPhase("parse");
+      AddParseTimes();
+      mHarness->StartPhase("load");
+    }
+
+    // Load game scene, its models and textures keep loading in the background unless --sync-loading is given
+    mLoadingStartTime = std::chrono::steady_clock::now();
+    mScene.LoadingProgressSignal().Connect(this, &GameController::OnLoadingProgress);
+    const bool loaded = mScene.Load(mWindow, SCENE_URL, gLoadInBackground);
+    if(recording && !loaded)
+    {
+      StartRenderPhase();
+    }
+    else if(recording)
+    {
+      DevelWindow::AddFrameRenderedCallback(mWindow, std::unique_ptr<CallbackBase>(MakeCallback(this, &GameController::OnFirstFrameRendered)), 0);
+    }
 
     // Display tutorial
     mTutorialController.DisplayTutorial(mWindow);
@@ -108,6 +238,80 @@ public:
     mWindow.KeyEventSignal().Connect(this, &GameController::OnKeyEvent);
   }
 
+  /**
+   * Times reading a synthetic scene of many entities with GameScene::ReadEntities() and with picojson, as many times as
+   * requested, and adds the times to the results
+   */
+  void AddParseTimes()
+  {
+    const std::string text = GenerateScene(gSceneEntities);
+    mHarness->SetParameter("sceneBytes", static_cast<double>(text.size()));
+
+    std::vector<double> times;
+    std::vector<double> picojsonTimes;
+    times.reserve(gParseRepeats);
+    picojsonTimes.reserve(gParseRepeats);
+    for(unsigned int i = 0u; i < gParseRepeats; ++i)
+    {
+      unsigned int entityCount = 0u;
+      auto         start       = std::chrono::steady_clock::now();
+      GameScene::ReadEntities(text.data(), text.size(), [&entityCount](const GameScene::EntityDescription&) {
+        ++entityCount;
+        return true;
+      });
+      times.push_back(GetMillisecondsSince(start));
+
+      start                            = std::chrono::steady_clock::now();
+      const unsigned int picojsonCount = ReadSceneWithPicojson(text);
+      picojsonTimes.push_back(GetMillisecondsSince(start));
+
+      if(entityCount != gSceneEntities || picojsonCount != gSceneEntities)
+      {
+        DALI_LOG_ERROR("Read %u and %u of %u entities\n", entityCount, picojsonCount, gSceneEntities);
+      }
+    }
+    mHarness->AddSamples("readScene", std::move(times));
+    mHarness->AddSamples("readScenePicojson", std::move(picojsonTimes));
+  }
+
+  /**
+   * Records the frame times for a while, then quits
+   */
+  void StartRenderPhase()
+  {
+    mHarness->StartPhase("render");
+    mBenchmarkTimer = Timer::New(BENCHMARK_RENDER_TIME);
+    mBenchmarkTimer.TickSignal().Connect(this, &GameController::OnBenchmarkFinished);
+    mBenchmarkTimer.Start();
+  }
+
+  void OnFirstFrameRendered(int32_t)
+  {
+    mHarness->AddSamples("firstFrame", {GetMillisecondsSince(mLoadingStartTime)});
+  }
+
+  void OnCompleteFrameRendered(int32_t)
+  {
+    mHarness->AddSamples("completeFrame", {GetMillisecondsSince(mLoadingStartTime)});
+    StartRenderPhase();
+  }
+
+  bool OnBenchmarkFinished()
+  {
+    mHarness->FinishRecording();
+    mApplication.Quit();
+    return false;
+  }
+
+  // Once the scene is complete, the next frame rendered is the first one showing every entity
+  void OnLoadingProgress(uint32_t loadedCount, uint32_t totalCount)
+  {
+    if(loadedCount == totalCount && mHarness && mHarness->IsRecording())
+    {
+      DevelWindow::AddFrameRenderedCallback(mWindow, std::unique_ptr<CallbackBase>(MakeCallback(this, &GameController::OnCompleteFrameRendered)), 0);
+    }
+  }
+
   // Handle a quit key event
   void OnKeyEvent(const KeyEvent& event)
   {
@@ -121,16 +325,46 @@ public:
   }
 
 private:
-  Application&              mApplication;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness* mHarness;
+  Timer                         mBenchmarkTimer;
+
   GameScene                 mScene;
   Window                    mWindow;
   FppGameTutorialController mTutorialController;
+
+  std::chrono::steady_clock::time_point mLoadingStartTime;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application    application = Application::New(&argc, &argv);
-  GameController test(application);
+  DemoHelper::BenchmarkHarness harness("fpp-game", "fpp-game.example");
+  harness.AddOption("sceneEntities", "-e", "Entities of the synthetic scene read with --timing-output", gSceneEntities);
+  harness.AddOption("parseRepeats", "-r", "Times the synthetic scene is read with --timing-output", gParseRepeats);
+  harness.AddFlag("syncLoading", "--sync-loading", "Loads the models and textures on the event thread", gLoadInBackground, false);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  Application application = Application::New(&argc, &argv);
+
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  GameController test(application, &harness);
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(GameController)
@@ -15,6 +15,8 @@
  *
  */
 
+#include <string.h>
+
 #include "game-model.h"
 #include "game-utils.h"
 
@@ -24,30 +26,104 @@ namespace
 {
 // 'MODV' tag stored in the big-endian (network) order
 const uint32_t MODV_TAG(0x4D4F4456);
+
+// 'MODV' tag read from a file of the opposite endianness
+const uint32_t MODV_TAG_SWAPPED(0x56444F4D);
+
+inline uint32_t SwapBytes(uint32_t value)
+{
+  return (value >> 24) | ((value >> 8) & 0xff00u) | ((value << 8) & 0xff0000u) | (value << 24);
+}
+
+/**
+ * Reads the header at the given offset, converting it to the host byte order
+ * @param[out] swapped Set to true if the data following the header is stored in the opposite byte order
+ * @return true if the header is valid and the vertex data it describes is within the file
+ */
+bool ReadHeader(const GameUtils::FileView& file, size_t offset, ModelHeader& header, bool& swapped)
+{
+  if(offset + sizeof(ModelHeader) > file.GetSize())
+  {
+    return false;
+  }
+
+  memcpy(&header, file.GetData() + offset, sizeof(ModelHeader));
+
+  swapped = (header.tag == MODV_TAG_SWAPPED);
+  if(swapped)
+  {
+    uint32_t* words = reinterpret_cast<uint32_t*>(&header);
+    for(size_t i = 0; i < sizeof(ModelHeader) / sizeof(uint32_t); ++i)
+    {
+      words[i] = SwapBytes(words[i]);
+    }
+  }
+
+  return header.tag == MODV_TAG &&
+         header.vertexStride != 0 &&
+         header.vertexBufferSize % sizeof(uint32_t) == 0 &&
+         uint64_t(header.dataBeginOffset) + header.vertexBufferSize <= file.GetSize();
+}
+
 } // namespace
 
 GameModel::GameModel(const char* filename)
 : mUniqueId(false),
   mIsReady(false)
 {
-  ByteArray bytes;
-  if(!LoadFile(filename, bytes))
+  FileView file(filename);
+  Initialise(filename, file);
+}
+
+GameModel::GameModel(const char* filename, const FileView& file)
+: mUniqueId(false),
+  mIsReady(false)
+{
+  Initialise(filename, file);
+}
+
+void GameModel::Initialise(const char* filename, const FileView& file)
+{
+  // The file holds the model in big-endian order, usually followed by a little-endian copy
+  // whose data offset is relative to the start of the file.
+  bool swapped(false);
+  if(!ReadHeader(file, 0, mHeader, swapped))
   {
     return;
   }
 
-  mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data()));
-
-  // expect big-endian
-  if(MODV_TAG != mHeader.tag)
+  if(swapped)
   {
-    // jump to little-endian variant
-    mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data() + bytes.size() / 2));
+    // use the copy in the host byte order if there is one, its pages are the only ones read
+    ModelHeader hostHeader;
+    bool        hostSwapped(false);
+    if(ReadHeader(file, file.GetSize() / 2, hostHeader, hostSwapped) && !hostSwapped)
+    {
+      mHeader = hostHeader;
+      swapped = false;
+    }
   }
 
   mVertexBuffer = Dali::VertexBuffer::New(Dali::Property::Map().Add("aPosition", Dali::Property::VECTOR3).Add("aNormal", Dali::Property::VECTOR3).Add("aTexCoord", Dali::Property::VECTOR2));
 
-  mVertexBuffer.SetData(bytes.data() + mHeader.dataBeginOffset, mHeader.vertexBufferSize / mHeader.vertexStride);
+  const uint8_t* vertexData  = file.GetData() + mHeader.dataBeginOffset;
+  const uint32_t vertexCount = mHeader.vertexBufferSize / mHeader.vertexStride;
+  if(!swapped)
+  {
+    // the vertex buffer copies straight from the mapping
+    mVertexBuffer.SetData(vertexData, vertexCount);
+  }
+  else
+  {
+    // all the attributes are made of 32 bit components, so the data is swapped word by word
+    std::vector<uint32_t> words(mHeader.vertexBufferSize / sizeof(uint32_t));
+    memcpy(words.data(), vertexData, mHeader.vertexBufferSize);
+    for(size_t i = 0; i < words.size(); ++i)
+    {
+      words[i] = SwapBytes(words[i]);
+    }
+    mVertexBuffer.SetData(words.data(), vertexCount);
+  }
 
   mGeometry = Dali::Geometry::New();
   mGeometry.AddVertexBuffer(mVertexBuffer);
@@ -23,6 +23,8 @@
 
 #include <inttypes.h>
 
+#include "game-utils.h"
+
 /**
  * @brief The ModelHeader struct
  * Model file header structure
@@ -58,6 +60,13 @@ public:
    */
   GameModel(const char* filename);
 
+  /**
+   * Creates an instance of GameModel from a '.mod' file already opened
+   * @param[in] filename Name of the opened file
+   * @param[in] file View of the file
+   */
+  GameModel(const char* filename, const GameUtils::FileView& file);
+
   /**
    * Destroys an instance of GameModel
    */
@@ -81,6 +90,12 @@ public:
    */
   uint32_t GetUniqueId();
 
+private:
+  /**
+   * Creates the geometry from the contents of a '.mod' file
+   */
+  void Initialise(const char* filename, const GameUtils::FileView& file);
+
 private:
   Dali::Geometry     mGeometry;
   Dali::VertexBuffer mVertexBuffer;
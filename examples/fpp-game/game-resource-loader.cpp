@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+
+#include "game-model.h"
+#include "game-resource-loader.h"
+#include "game-texture.h"
+#include "shared/trace.h"
+
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/signals/callback.h>
+
+GameResourceLoader::GameResourceLoader()
+: mNextRequest(0u),
+  mCancelled(false),
+  mEventThreadCallback(new Dali::EventThreadCallback(Dali::MakeCallback(this, &GameResourceLoader::OnRequestsCompleted))),
+  mModelCount(0u),
+  mTextureCount(0u),
+  mCompletedCount(0u)
+{
+}
+
+GameResourceLoader::~GameResourceLoader()
+{
+  mCancelled = true;
+  JoinWorkers();
+}
+
+uint32_t GameResourceLoader::AddModel(const std::string& filename)
+{
+  mRequests.push_back(Request{RequestType::MODEL, mModelCount, filename, GameUtils::FileView(), Dali::PixelData()});
+  return mModelCount++;
+}
+
+uint32_t GameResourceLoader::AddTexture(const std::string& filename)
+{
+  mRequests.push_back(Request{RequestType::TEXTURE, mTextureCount, filename, GameUtils::FileView(), Dali::PixelData()});
+  return mTextureCount++;
+}
+
+void GameResourceLoader::Start()
+{
+  // the requests must not be added to from now on, as the workers access them without locking
+  const uint32_t threadCount = std::min(std::max(std::thread::hardware_concurrency(), 1u), GetRequestCount());
+  for(uint32_t i = 0u; i < threadCount; ++i)
+  {
+    mWorkers.emplace_back(&GameResourceLoader::Process, this);
+  }
+}
+
+void GameResourceLoader::LoadNow()
+{
+  ProcessRequests(false);
+  OnRequestsCompleted();
+}
+
+uint32_t GameResourceLoader::GetRequestCount() const
+{
+  return static_cast<uint32_t>(mRequests.size());
+}
+
+uint32_t GameResourceLoader::GetCompletedCount() const
+{
+  return mCompletedCount;
+}
+
+GameResourceLoader::ModelLoadedSignalType& GameResourceLoader::ModelLoadedSignal()
+{
+  return mModelLoadedSignal;
+}
+
+GameResourceLoader::TextureLoadedSignalType& GameResourceLoader::TextureLoadedSignal()
+{
+  return mTextureLoadedSignal;
+}
+
+GameResourceLoader::ProgressSignalType& GameResourceLoader::ProgressSignal()
+{
+  return mProgressSignal;
+}
+
+void GameResourceLoader::Process()
+{
+  DemoHelper::Tracer::Get().SetThreadName("Resource loader");
+  ProcessRequests(true);
+}
+
+void GameResourceLoader::ProcessRequests(bool triggerEventThread)
+{
+  for(uint32_t i = mNextRequest++; i < GetRequestCount() && !mCancelled; i = mNextRequest++)
+  {
+    // the span ends once the resource is taken on the event thread
+    DEMO_TRACE_ASYNC_BEGIN("LoadResource", i);
+    Request& request = mRequests[i];
+    if(request.type == RequestType::MODEL)
+    {
+      request.file.Open(request.filename);
+    }
+    else
+    {
+      Dali::Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile(request.filename);
+      if(pixelBuffer)
+      {
+        request.pixelData = Dali::Devel::PixelBuffer::Convert(pixelBuffer);
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mCompletedMutex);
+      mCompleted.push_back(i);
+    }
+
+    // triggers may be merged, so every completed request is taken on the event thread
+    if(triggerEventThread)
+    {
+      mEventThreadCallback->Trigger();
+    }
+  }
+}
+
+void GameResourceLoader::OnRequestsCompleted()
+{
+  std::vector<uint32_t> completed;
+  {
+    std::lock_guard<std::mutex> lock(mCompletedMutex);
+    completed.swap(mCompleted);
+  }
+
+  if(completed.empty())
+  {
+    return;
+  }
+
+  for(uint32_t i : completed)
+  {
+    DEMO_TRACE_SCOPE("ResourceReady");
+    Request& request = mRequests[i];
+    if(request.type == RequestType::MODEL)
+    {
+      GameModel* model(NULL);
+      if(!request.file.IsEmpty())
+      {
+        model = new GameModel(request.filename.c_str(), request.file);
+        if(!model->IsReady())
+        {
+          delete model;
+          model = NULL;
+        }
+      }
+
+      if(!model)
+      {
+        DALI_LOG_ERROR("Failed to load model %s\n", request.filename.c_str());
+      }
+
+      // the vertex buffer keeps its own copy
+      request.file.Close();
+      ++mCompletedCount;
+      mModelLoadedSignal.Emit(request.index, model);
+    }
+    else
+    {
+      GameTexture* texture(NULL);
+      if(request.pixelData)
+      {
+        texture = new GameTexture();
+        if(!texture->Load(request.filename.c_str(), request.pixelData))
+        {
+          delete texture;
+          texture = NULL;
+        }
+      }
+
+      if(!texture)
+      {
+        DALI_LOG_ERROR("Failed to load texture %s\n", request.filename.c_str());
+      }
+
+      request.pixelData.Reset();
+      ++mCompletedCount;
+      mTextureLoadedSignal.Emit(request.index, texture);
+    }
+    DEMO_TRACE_ASYNC_END("LoadResource", i);
+  }
+  DEMO_TRACE_COUNTER("ResourcesLoaded", mCompletedCount);
+
+  mProgressSignal.Emit(mCompletedCount, GetRequestCount());
+
+  if(mCompletedCount == GetRequestCount())
+  {
+    JoinWorkers();
+  }
+}
+
+void GameResourceLoader::JoinWorkers()
+{
+  for(std::thread& worker : mWorkers)
+  {
+    worker.join();
+  }
+  mWorkers.clear();
+}
@@ -0,0 +1,171 @@
+#ifndef GAME_RESOURCE_LOADER_H
+#define GAME_RESOURCE_LOADER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <inttypes.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "game-utils.h"
+
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/signals/dali-signal.h>
+
+class GameModel;
+class GameTexture;
+
+/**
+ * @brief The GameResourceLoader class
+ * Loads a list of unique models and textures on a pool of worker threads.
+ * Files are read and images decoded by the workers, while the GameModel and
+ * GameTexture objects, which own the GPU resources, are created on the event
+ * thread as soon as each file is ready. The objects are handed over through
+ * the loaded signals, in the order the workers complete them.
+ */
+class GameResourceLoader
+{
+public:
+  typedef Dali::Signal<void(uint32_t, GameModel*)>   ModelLoadedSignalType;   ///< Request index and model, NULL if failed to load
+  typedef Dali::Signal<void(uint32_t, GameTexture*)> TextureLoadedSignalType; ///< Request index and texture, NULL if failed to load
+  typedef Dali::Signal<void(uint32_t, uint32_t)>     ProgressSignalType;      ///< Number of completed requests and total number of requests
+
+  /**
+   * Creates an instance of the GameResourceLoader
+   */
+  GameResourceLoader();
+
+  /**
+   * Destroys an instance of the GameResourceLoader, waiting for the workers to finish
+   * the files they are reading. Requests not started yet are dropped.
+   */
+  ~GameResourceLoader();
+
+  /**
+   * Adds a model to be loaded
+   * @param[in] filename Path to the '.mod' file
+   * @return Index of the request, passed back by ModelLoadedSignal()
+   */
+  uint32_t AddModel(const std::string& filename);
+
+  /**
+   * Adds a texture to be loaded
+   * @param[in] filename Path to the image file
+   * @return Index of the request, passed back by TextureLoadedSignal()
+   */
+  uint32_t AddTexture(const std::string& filename);
+
+  /**
+   * Starts loading all the requests added so far, must be called only once
+   */
+  void Start();
+
+  /**
+   * Loads all the requests added so far on the calling thread, emitting the signals before returning, instead of
+   * Start(). This is how the scene was loaded before the workers, kept for comparison.
+   */
+  void LoadNow();
+
+  /**
+   * Returns the number of requests
+   */
+  uint32_t GetRequestCount() const;
+
+  /**
+   * Returns the number of requests completed on the event thread
+   */
+  uint32_t GetCompletedCount() const;
+
+  /**
+   * Emitted on the event thread for each model, the receiver takes ownership of it
+   */
+  ModelLoadedSignalType& ModelLoadedSignal();
+
+  /**
+   * Emitted on the event thread for each texture, the receiver takes ownership of it
+   */
+  TextureLoadedSignalType& TextureLoadedSignal();
+
+  /**
+   * Emitted on the event thread after each batch of completed requests
+   */
+  ProgressSignalType& ProgressSignal();
+
+private:
+  enum class RequestType
+  {
+    MODEL,
+    TEXTURE
+  };
+
+  struct Request
+  {
+    RequestType          type;
+    uint32_t             index;     ///< Index within the requests of the same type
+    std::string          filename;
+    GameUtils::FileView  file;      ///< View of a model file, opened by a worker
+    Dali::PixelData      pixelData; ///< Decoded texture, filled by a worker
+  };
+
+  /**
+   * Reads and decodes requests until there are none left, runs on a worker thread
+   */
+  void Process();
+
+  /**
+   * Reads and decodes requests until there are none left
+   * @param[in] triggerEventThread Whether the event thread is triggered to take each completed request
+   */
+  void ProcessRequests(bool triggerEventThread);
+
+  /**
+   * Creates the objects of the completed requests, runs on the event thread
+   */
+  void OnRequestsCompleted();
+
+  /**
+   * Waits for all the workers to exit
+   */
+  void JoinWorkers();
+
+private:
+  std::vector<Request>     mRequests;
+  std::vector<std::thread> mWorkers;
+  std::atomic<uint32_t>    mNextRequest;
+  std::atomic<bool>        mCancelled;
+
+  std::mutex            mCompletedMutex;
+  std::vector<uint32_t> mCompleted; ///< Requests processed by the workers but not by the event thread yet
+
+  std::unique_ptr<Dali::EventThreadCallback> mEventThreadCallback;
+
+  uint32_t mModelCount;
+  uint32_t mTextureCount;
+  uint32_t mCompletedCount;
+
+  ModelLoadedSignalType   mModelLoadedSignal;
+  TextureLoadedSignalType mTextureLoadedSignal;
+  ProgressSignalType      mProgressSignal;
+};
+
+#endif
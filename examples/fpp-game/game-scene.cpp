@@ -17,6 +17,8 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <map>
+#include <string_view>
 
 #include "game-camera.h"
 #include "game-entity.h"
@@ -25,124 +27,111 @@
 #include "game-scene.h"
 #include "game-texture.h"
 
-#include "third-party/pico-json.h"
+#include "shared/json-reader.h"
+#include "shared/mapped-file.h"
 
 #include <dali/dali.h>
+#include <dali/integration-api/debug.h>
 
 using namespace Dali;
-using namespace picojson;
 
 using std::vector;
 
 using namespace GameUtils;
 
-GameScene::GameScene()
-{
-}
-
-GameScene::~GameScene()
+namespace
 {
-}
-
-bool GameScene::Load(Window window, const char* filename)
+/**
+ * Reads an array of numbers, returns true if it holds at least @p count numbers
+ */
+bool ReadFloatArray(DemoHelper::JsonReader& reader, float* values, uint32_t count)
 {
-  ByteArray bytes;
-  if(!LoadFile(filename, bytes))
+  if(!reader.EnterArray())
   {
     return false;
   }
 
-  // add EOL
-  bytes.push_back('\0');
-
-  picojson::value root;
-  picojson::parse(root, bytes.data());
-
-  bool failed(false);
-
-  if(root.is<object>())
+  uint32_t index = 0u;
+  for(; reader.NextElement(); ++index)
   {
-    object rootObject = root.get<object>();
-    for(object::iterator it = rootObject.begin(); it != rootObject.end(); ++it)
+    if(index < count ? !reader.ReadNumber(values[index]) : !reader.Skip())
     {
-      std::string entityName((*it).first);
+      return false;
+    }
+  }
 
-      GameEntity* entity = new GameEntity(entityName.c_str());
-      mEntities.PushBack(entity);
+  return index >= count && !reader.HasError();
+}
 
-      value& val((*it).second);
-      value& vLocation = val.get("location");
-      value& vRotation = val.get("rotation");
-      value& vScale    = val.get("scale");
-      value& vSize     = val.get("size");
-      value& vModel    = val.get("model");
-      value& vTexture  = val.get("texture");
+/**
+ * Returns the index of a resource name, assigning the next index to names not seen yet
+ */
+uint32_t GetResourceIndex(const std::string& name, std::map<std::string, uint32_t>& indices)
+{
+  std::map<std::string, uint32_t>::iterator iter = indices.find(name);
+  if(iter == indices.end())
+  {
+    iter = indices.insert(std::make_pair(name, static_cast<uint32_t>(indices.size()))).first;
+  }
+  return iter->second;
+}
 
-      if(!vLocation.is<null>())
-      {
-        array& location = vLocation.get<array>();
-        entity->SetLocation(Vector3(
-          location.at(0).get<double>(),
-          location.at(1).get<double>(),
-          location.at(2).get<double>()));
-      }
+/**
+ * Returns the paths of the resources, ordered by their index
+ */
+std::vector<std::string> GetResourcePaths(const std::map<std::string, uint32_t>& indices)
+{
+  std::vector<std::string> paths(indices.size());
+  for(std::map<std::string, uint32_t>::const_iterator iter = indices.begin(); iter != indices.end(); ++iter)
+  {
+    paths[iter->second] = std::string(DEMO_GAME_DIR) + "/" + iter->first;
+  }
+  return paths;
+}
 
-      if(!vRotation.is<null>())
-      {
-        array& rotation = vRotation.get<array>();
-        entity->SetRotation(Quaternion(Vector4(
-          -rotation.at(0).get<double>(),
-          rotation.at(1).get<double>(),
-          -rotation.at(2).get<double>(),
-          rotation.at(3).get<double>())));
-      }
+} // namespace
 
-      if(!vScale.is<null>())
-      {
-        array& scale = vScale.get<array>();
-        entity->SetScale(Vector3(
-          scale.at(0).get<double>(),
-          scale.at(1).get<double>(),
-          scale.at(2).get<double>()));
-      }
+GameScene::GameScene()
+{
+}
 
-      if(!vSize.is<null>())
-      {
-        array& size = vSize.get<array>();
-        entity->SetSize(Vector3(
-          size.at(0).get<double>(),
-          size.at(1).get<double>(),
-          size.at(2).get<double>()));
-      }
+GameScene::~GameScene()
+{
+}
 
-      GameModel*   model(NULL);
-      GameTexture* texture(NULL);
+bool GameScene::Load(Window window, const char* filename, bool loadInBackground)
+{
+  DemoHelper::MappedFile file(filename);
+  if(file.IsEmpty())
+  {
+    return false;
+  }
 
-      if(!vModel.is<null>())
-      {
-        std::string& strModel = vModel.get<std::string>();
-        model                 = GetResource(strModel.c_str(), mModelCache);
-      }
+  // unique resources, each loaded only once
+  std::map<std::string, uint32_t> modelIndices;
+  std::map<std::string, uint32_t> textureIndices;
 
-      if(!vTexture.is<null>())
-      {
-        std::string& strTexture = vTexture.get<std::string>();
-        texture                 = GetResource(strTexture.c_str(), mTextureCache);
-      }
+  const bool read = ReadEntities(reinterpret_cast<const char*>(file.GetData()), file.GetSize(), [&](const EntityDescription& description) {
+    if(description.model.empty() || description.texture.empty())
+    {
+      return false;
+    }
 
-      if(!model || !texture)
-      {
-        failed = true;
-        break;
-      }
+    GameEntity* entity = new GameEntity(std::string(description.name).c_str());
+    mEntities.PushBack(entity);
+    entity->SetLocation(description.location);
+    entity->SetRotation(description.rotation);
+    entity->SetScale(description.scale);
+    entity->SetSize(description.size);
 
-      entity->GetGameRenderer().SetModel(model);
-      entity->GetGameRenderer().SetMainTexture(texture);
-    }
-  }
+    mEntityModels.push_back(GetResourceIndex(description.model, modelIndices));
+    mEntityTextures.push_back(GetResourceIndex(description.texture, textureIndices));
+    return true;
+  });
 
-  if(failed)
+  if(!read)
   {
+    DALI_LOG_ERROR("Invalid scene file %s\n", filename);
     return false;
   }
 
@@ -160,16 +149,187 @@ bool GameScene::Load(Window window, const char* filename)
     actor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
     actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
     mRootActor.Add(actor);
-    mEntities[i]->UpdateRenderer();
   }
 
   // update camera
   mCamera.Initialise(window.GetRenderTaskList().GetTask(0).GetCameraActor(), 60.0f, 0.1f, 100.0f, window.GetSize());
 
+  // read and decode the resources on worker threads, the entities are set up as they arrive
+  mModels.assign(modelIndices.size(), NULL);
+  mTextures.assign(textureIndices.size(), NULL);
+  mModelUsers.assign(modelIndices.size(), std::vector<uint32_t>());
+  mTextureUsers.assign(textureIndices.size(), std::vector<uint32_t>());
+  for(uint32_t i = 0u; i < mEntityModels.size(); ++i)
+  {
+    mModelUsers[mEntityModels[i]].push_back(i);
+    mTextureUsers[mEntityTextures[i]].push_back(i);
+  }
+
+  mResourceLoader.reset(new GameResourceLoader());
+  mResourceLoader->ModelLoadedSignal().Connect(this, &GameScene::OnModelLoaded);
+  mResourceLoader->TextureLoadedSignal().Connect(this, &GameScene::OnTextureLoaded);
+  mResourceLoader->ProgressSignal().Connect(this, &GameScene::OnLoadingProgress);
+
+  const std::vector<std::string> modelPaths(GetResourcePaths(modelIndices));
+  for(size_t i = 0; i < modelPaths.size(); ++i)
+  {
+    mResourceLoader->AddModel(modelPaths[i]);
+  }
+
+  const std::vector<std::string> texturePaths(GetResourcePaths(textureIndices));
+  for(size_t i = 0; i < texturePaths.size(); ++i)
+  {
+    mResourceLoader->AddTexture(texturePaths[i]);
+  }
+
+  if(loadInBackground)
+  {
+    mResourceLoader->Start();
+  }
+  else
+  {
+    mResourceLoader->LoadNow();
+  }
+
+  if(!mResourceLoader->GetRequestCount())
+  {
+    mLoadingProgressSignal.Emit(0u, 0u);
+  }
+
   return true;
 }
 
+bool GameScene::ReadEntities(const char* text, size_t length, const EntityCallback& callback)
+{
+  // Entities are read as the text is walked, without building a document first.
+  DemoHelper::JsonReader reader(text, text + length);
+
+  bool              failed(!reader.EnterObject());
+  EntityDescription description;
+  for(std::string_view entityName; !failed && reader.NextMember(entityName);)
+  {
+    description.name     = entityName;
+    description.location = Vector3::ZERO;
+    description.rotation = Quaternion::IDENTITY;
+    description.scale    = Vector3::ONE;
+    description.size     = Vector3::ZERO;
+    description.model.clear();
+    description.texture.clear();
+
+    if(!reader.EnterObject())
+    {
+      failed = true;
+      break;
+    }
+
+    for(std::string_view key; !failed && reader.NextMember(key);)
+    {
+      float values[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+      if(reader.GetType() == DemoHelper::JsonReader::Type::NULL_VALUE)
+      {
+        reader.ReadNull();
+      }
+      else if(key == "location")
+      {
+        failed               = !ReadFloatArray(reader, values, 3u);
+        description.location = Vector3(values[0], values[1], values[2]);
+      }
+      else if(key == "rotation")
+      {
+        failed               = !ReadFloatArray(reader, values, 4u);
+        description.rotation = Quaternion(Vector4(-values[0], values[1], -values[2], values[3]));
+      }
+      else if(key == "scale")
+      {
+        failed            = !ReadFloatArray(reader, values, 3u);
+        description.scale = Vector3(values[0], values[1], values[2]);
+      }
+      else if(key == "size")
+      {
+        failed           = !ReadFloatArray(reader, values, 3u);
+        description.size = Vector3(values[0], values[1], values[2]);
+      }
+      else if(key == "model")
+      {
+        failed = !reader.ReadString(description.model);
+      }
+      else if(key == "texture")
+      {
+        failed = !reader.ReadString(description.texture);
+      }
+      else
+      {
+        failed = !reader.Skip();
+      }
+    }
+
+    failed = failed || !callback(description);
+  }
+
+  if(reader.HasError())
+  {
+    DALI_LOG_ERROR("Invalid JSON at offset %zu\n", reader.GetErrorOffset());
+    return false;
+  }
+  return !failed;
+}
+
 Dali::Actor& GameScene::GetRootActor()
 {
   return mRootActor;
 }
+
+GameScene::LoadingProgressSignalType& GameScene::LoadingProgressSignal()
+{
+  return mLoadingProgressSignal;
+}
+
+void GameScene::SetupEntity(uint32_t entityIndex)
+{
+  GameModel*   model   = mModels[mEntityModels[entityIndex]];
+  GameTexture* texture = mTextures[mEntityTextures[entityIndex]];
+  if(model && texture)
+  {
+    GameEntity* entity = mEntities[entityIndex];
+    entity->GetGameRenderer().SetModel(model);
+    entity->GetGameRenderer().SetMainTexture(texture);
+    entity->UpdateRenderer();
+  }
+}
+
+void GameScene::OnModelLoaded(uint32_t index, GameModel* model)
+{
+  if(!model)
+  {
+    // reported by the loader, entities using it are never rendered
+    return;
+  }
+
+  mModelCache.PushBack(model);
+  mModels[index] = model;
+  for(size_t i = 0; i < mModelUsers[index].size(); ++i)
+  {
+    SetupEntity(mModelUsers[index][i]);
+  }
+}
+
+void GameScene::OnTextureLoaded(uint32_t index, GameTexture* texture)
+{
+  if(!texture)
+  {
+    // reported by the loader, entities using it are never rendered
+    return;
+  }
+
+  mTextureCache.PushBack(texture);
+  mTextures[index] = texture;
+  for(size_t i = 0; i < mTextureUsers[index].size(); ++i)
+  {
+    SetupEntity(mTextureUsers[index][i]);
+  }
+}
+
+void GameScene::OnLoadingProgress(uint32_t loadedCount, uint32_t totalCount)
+{
+  mLoadingProgressSignal.Emit(loadedCount, totalCount);
+}
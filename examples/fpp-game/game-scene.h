@@ -19,15 +19,25 @@
  */
 
 #include <inttypes.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "game-camera.h"
 #include "game-container.h"
+#include "game-resource-loader.h"
 #include "game-utils.h"
 
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/public-api/signals/dali-signal.h>
 
 class GameCamera;
 class GameEntity;
@@ -41,9 +51,27 @@ typedef GameContainer<GameEntity*>  EntityArray;
 typedef GameContainer<GameTexture*> TextureArray;
 typedef GameContainer<GameModel*>   ModelArray;
 
-class GameScene
+class GameScene : public Dali::ConnectionTracker
 {
 public:
+  typedef Dali::Signal<void(uint32_t, uint32_t)> LoadingProgressSignalType; ///< Number of loaded resources and total number of resources
+
+  /**
+   * An entity as read from a scene file, the properties it doesn't have keep the defaults of an actor
+   */
+  struct EntityDescription
+  {
+    std::string_view name; ///< A view into the text of the scene
+    Dali::Vector3    location{Dali::Vector3::ZERO};
+    Dali::Quaternion rotation{Dali::Quaternion::IDENTITY};
+    Dali::Vector3    scale{Dali::Vector3::ONE};
+    Dali::Vector3    size{Dali::Vector3::ZERO};
+    std::string      model;
+    std::string      texture;
+  };
+
+  typedef std::function<bool(const EntityDescription&)> EntityCallback; ///< Returns false to stop reading
+
   /**
    * Creates an instance of the GameScene
    */
@@ -57,20 +85,26 @@ public:
   /**
    * Loads scene from formatted JSON file, returns true on success
    *
+   * The entities are added to the window straight away. Their models and textures
+   * are loaded in the background and each entity is rendered once both are ready.
+   *
    * @param[in] window The window to load the scene on
    * @param[in] filename Path to the scene file
+   * @param[in] loadInBackground Whether the models and textures are loaded in the background,
+   *            otherwise they are all loaded before returning
    * @return true if suceess
    */
-  bool Load(Dali::Window window, const char* filename);
+  bool Load(Dali::Window window, const char* filename, bool loadInBackground = true);
 
   /**
-   * Loads resource ( model or texture ) or gets if from cache if already loaded
-   * @param[in] filename Path to the resource file
-   * @param[in] cache Reference to the cache array to be used
-   * @return Pointer to the resource or NULL otherwise
+   * Reads the entities of a scene in JSON, without creating them
+   *
+   * @param[in] text The text of the scene, which doesn't need to be null terminated
+   * @param[in] length The length of the text
+   * @param[in] callback Called with each entity, in the order of the text
+   * @return true if every entity was read and accepted by @p callback
    */
-  template<typename T>
-  T* GetResource(const char* filename, GameContainer<T*>& cache);
+  static bool ReadEntities(const char* text, size_t length, const EntityCallback& callback);
 
   /**
    * Returns scene root actor
@@ -78,6 +112,25 @@ public:
    */
   Dali::Actor& GetRootActor();
 
+  /**
+   * Emitted as the models and textures of the scene are loaded
+   * @return The signal to connect to
+   */
+  LoadingProgressSignalType& LoadingProgressSignal();
+
+private:
+  /**
+   * Sets the model and texture of an entity once both are loaded
+   * @param[in] entityIndex Index of the entity
+   */
+  void SetupEntity(uint32_t entityIndex);
+
+  void OnModelLoaded(uint32_t index, GameModel* model);
+
+  void OnTextureLoaded(uint32_t index, GameTexture* texture);
+
+  void OnLoadingProgress(uint32_t loadedCount, uint32_t totalCount);
+
 private:
   EntityArray mEntities;
   GameCamera  mCamera;
@@ -86,36 +139,21 @@ private:
   ModelArray   mModelCache;
   TextureArray mTextureCache;
 
-  Dali::Actor mRootActor;
-};
+  // resources by loader request index, owned by the caches
+  std::vector<GameModel*>   mModels;
+  std::vector<GameTexture*> mTextures;
 
-template<typename T>
-T* GameScene::GetResource(const char* filename, GameContainer<T*>& cache)
-{
-  std::string path(DEMO_GAME_DIR);
-  path += "/";
-  path += filename;
-
-  uint32_t hash(GameUtils::HashString(path.c_str()));
+  // resource request indices by entity, and entity indices by resource request
+  std::vector<uint32_t>              mEntityModels;
+  std::vector<uint32_t>              mEntityTextures;
+  std::vector<std::vector<uint32_t>> mModelUsers;
+  std::vector<std::vector<uint32_t>> mTextureUsers;
 
-  for(typename GameContainer<T*>::Iterator iter = cache.Begin(); iter != cache.End(); ++iter)
-  {
-    if((*iter)->GetUniqueId() == hash)
-    {
-      return (*iter);
-    }
-  }
-
-  // load resource
-  T* resource = new T(path.c_str());
-  if(!resource->IsReady())
-  {
-    return NULL;
-  }
+  Dali::Actor mRootActor;
 
-  cache.PushBack(resource);
+  LoadingProgressSignalType mLoadingProgressSignal;
 
-  return resource;
-}
+  std::unique_ptr<GameResourceLoader> mResourceLoader; ///< Destroyed first, so it never signals a partly destroyed scene
+};
 
 #endif
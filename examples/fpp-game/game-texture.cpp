@@ -41,8 +41,11 @@ GameTexture::GameTexture(const char* filename)
 
 bool GameTexture::Load(const char* filename)
 {
-  Dali::PixelData pixelData = Dali::Toolkit::SyncImageLoader::Load(filename);
+  return Load(filename, Dali::Toolkit::SyncImageLoader::Load(filename));
+}
 
+bool GameTexture::Load(const char* filename, Dali::PixelData pixelData)
+{
   if(!pixelData)
   {
     return false;
@@ -15,7 +15,6 @@
  *
  */
 
-#include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
 #include <inttypes.h>
 #include <stdio.h>
@@ -24,30 +23,6 @@
 
 namespace GameUtils
 {
-bool LoadFile(const char* filename, ByteArray& bytes)
-{
-  Dali::FileStream fileStream(filename, Dali::FileStream::READ | Dali::FileStream::BINARY);
-  FILE*            fin = fileStream.GetFile();
-
-  if(fin)
-  {
-    if(fseek(fin, 0, SEEK_END))
-    {
-      return false;
-    }
-    bytes.resize(ftell(fin));
-    std::fill(bytes.begin(), bytes.end(), 0);
-    if(fseek(fin, 0, SEEK_SET))
-    {
-      return false;
-    }
-    size_t result = fread(bytes.data(), 1, bytes.size(), fin);
-    return (result != 0);
-  }
-
-  return false;
-}
-
 size_t HashString(const char* str)
 {
   size_t hash = 5381;
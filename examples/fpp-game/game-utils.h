@@ -22,14 +22,15 @@
 #include <stdlib.h>
 #include <vector>
 
+#include "shared/mapped-file.h"
+
 namespace GameUtils
 {
-typedef std::vector<char> ByteArray;
-
 /**
- * Loads file from the storage and returns byte array
+ * Read-only view of a file, memory mapped where the platform allows it, so its
+ * contents are neither zero-filled nor copied before being used
  */
-bool LoadFile(const char* filename, ByteArray& out);
+typedef DemoHelper::MappedFile FileView;
 
 /**
  * Computes hash value from string using djb2 algorithm
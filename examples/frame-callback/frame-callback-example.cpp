@@ -18,9 +18,18 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/devel-api/common/stage-devel.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include "frame-callback.h"
+#include "shared/benchmark-harness.h"
+#include "shared/bulk-frame-callback.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -36,6 +45,80 @@ Vector4     TEXT_COLOR_DISABLED(Color::RED);
 
 float ANIMATION_TIME(4.0f);
 float ANIMATION_PROGRESS_MULTIPLIER(0.02f);
+
+const uint32_t MAXIMUM_UPDATE_SAMPLES(100000u); ///< Update times recorded in a benchmark run
+
+unsigned int gActorCount(0u);           ///< 0 fills the height of the window
+bool         gUseBulk(false);           ///< Whether the image-views are updated by a DemoHelper::BulkFrameCallback
+unsigned int gWorkerCount(1u);          ///< Threads the kernels of the DemoHelper::BulkFrameCallback run on
+unsigned int gParallelThreshold(DemoHelper::BulkFrameCallback::DEFAULT_PARALLEL_THRESHOLD);
+float        gBenchmarkDuration(10.0f); ///< Seconds measured when recording
+
+/**
+ * @brief Times the Update() of another frame callback, to report the update thread time it takes per frame.
+ *
+ * Only writes to storage allocated up front while it is added to the stage.
+ */
+class UpdateTimer : public FrameCallbackInterface
+{
+public:
+  explicit UpdateTimer(FrameCallbackInterface& frameCallback)
+  : mFrameCallback(frameCallback),
+    mSamples(MAXIMUM_UPDATE_SAMPLES),
+    mSampleCount(0u)
+  {
+  }
+
+  /**
+   * @brief The update times recorded, in milliseconds; call once removed from the stage.
+   */
+  std::vector<double> GetSamples() const
+  {
+    return std::vector<double>(mSamples.begin(), mSamples.begin() + mSampleCount.load(std::memory_order_acquire));
+  }
+
+private:
+  void Update(UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    const auto start = std::chrono::steady_clock::now();
+    mFrameCallback.Update(updateProxy, elapsedSeconds);
+    const auto end = std::chrono::steady_clock::now();
+
+    const uint32_t sampleCount = mSampleCount.load(std::memory_order_relaxed);
+    if(sampleCount < mSamples.size())
+    {
+      mSamples[sampleCount] = std::chrono::duration<double, std::milli>(end - start).count();
+      mSampleCount.store(sampleCount + 1u, std::memory_order_release);
+    }
+  }
+
+private:
+  FrameCallbackInterface& mFrameCallback;
+  std::vector<double>     mSamples;
+  std::atomic<uint32_t>   mSampleCount;
+};
+
+/**
+ * @brief Adds the kernel doing what FrameCallback does for every ID, over all the image-views at once.
+ */
+void AddEdgeKernel(DemoHelper::BulkFrameCallback& bulkFrameCallback, float windowWidth)
+{
+  const float windowHalfWidth = windowWidth * 0.5f;
+  bulkFrameCallback.AddKernel(DemoHelper::BulkFrameCallback::POSITION | DemoHelper::BulkFrameCallback::SIZE,
+                              DemoHelper::BulkFrameCallback::SIZE | DemoHelper::BulkFrameCallback::COLOR,
+                              [windowHalfWidth](DemoHelper::BulkFrameCallback::Arrays& arrays, float /* elapsedSeconds */) {
+                                for(uint32_t i = 0u; i < arrays.count; ++i)
+                                {
+                                  // Grow as the edge is hit, and fade out towards the middle
+                                  const float halfWidthPoint = windowHalfWidth - arrays.width[i] * 0.5f;
+                                  const float xTranslation   = std::abs(arrays.positionX[i]);
+                                  const float adjustment     = std::max(xTranslation - halfWidthPoint, 0.0f);
+                                  arrays.width[i] += adjustment * 2.0f;
+                                  arrays.height[i] += adjustment * 2.0f;
+                                  arrays.alpha[i] = xTranslation / halfWidthPoint;
+                                }
+                              });
+}
 } // unnamed namespace
 
 /**
@@ -44,6 +127,20 @@ float ANIMATION_PROGRESS_MULTIPLIER(0.02f);
  * Creates a scene with several image-views which are animated from side-to-side.
  * With the frame-callback enabled, the image-views' sizes expand as they hits the sides and the opacity
  * changes to transparent as they go to the middle.
+ *
+ * Run with --timing-output, it measures the update thread time the frame-callback takes per frame, either the
+ * FrameCallback looking up every actor ID or, with --bulk, a DemoHelper::BulkFrameCallback, e.g. to compare how
+ * both scale:
+ *
+ * @code
+ * ./frame-callback.example --sweep=actors=100,1000,5000,10000,20000,50000 --sweep=bulk=0,1 --report=frame-callback.csv
+ * @endcode
+ *
+ * With --bulk, the kernel can also run on several threads, e.g. to find the number of actors from which it pays off:
+ *
+ * @code
+ * ./frame-callback.example --bulk --sweep=actors=500..64000*2 --sweep=workers=1,2,4,8 --parallel-threshold=0
+ * @endcode
  */
 class FrameCallbackController : public ConnectionTracker
 {
@@ -51,10 +148,15 @@ public:
   /**
    * @brief Constructor.
    * @param[in]  application  The application.
+   * @param[in]  harness      Measures the update time of the frame-callback, if given.
    */
-  FrameCallbackController(Application& application)
+  FrameCallbackController(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr)
   : mApplication(application),
+    mHarness(harness),
     mFrameCallback(),
+    mBulkFrameCallback(),
+    mUpdateTimer(gUseBulk ? static_cast<FrameCallbackInterface&>(mBulkFrameCallback) : mFrameCallback),
+    mTimeUpdates(false),
     mTextLabel(),
     mTapDetector(),
     mFrameCallbackEnabled(false)
@@ -74,6 +176,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Set the window background color and connect to the window's key signal to allow Back and Escape to exit.
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -83,6 +187,8 @@ private:
     // Can call methods in mFrameCallback directly as we have not set it on the window yet.
     Vector2 windowSize = window.GetSize();
     mFrameCallback.SetWindowWidth(windowSize.width);
+    AddEdgeKernel(mBulkFrameCallback, windowSize.width);
+    mBulkFrameCallback.SetWorkerCount(gWorkerCount, gParallelThreshold);
 
     // Detect taps on the root layer.
     mTapDetector = TapGestureDetector::New();
@@ -96,27 +202,45 @@ private:
     keyFrames.Add(0.75f, -windowSize.width * 0.5f);
     keyFrames.Add(1.0f, 0.0f);
 
-    float yPos = 0.0f;
-    for(int i = 0; yPos < windowSize.height; ++i)
+    // Each image starts at a different point, up to the one where all the following images start; these share an
+    // animation, so that many images don't take as many animations.
+    const unsigned int animationCount = static_cast<unsigned int>(std::lround(1.0f / ANIMATION_PROGRESS_MULTIPLIER)) + 1u;
+    std::vector<Animation> animations;
+    float                  yPos = 0.0f;
+    for(unsigned int i = 0u; gActorCount ? i < gActorCount : yPos < windowSize.height; ++i)
     {
       ImageView imageView = ImageView::New(IMAGE_NAME);
       imageView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
       imageView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_CENTER);
       imageView.SetProperty(Actor::Property::POSITION_Y, yPos);
       yPos += imageView.GetNaturalSize().height;
+      if(gActorCount && yPos >= windowSize.height)
+      {
+        // Stack the requested number of images from the top again
+        yPos = 0.0f;
+      }
 
       // Add the ID of the created ImageView to mFrameCallback.
       // Again, can call methods in mFrameCallback directly as we have not set it on the window yet.
       mFrameCallback.AddId(imageView.GetProperty<int>(Actor::Property::ID));
+      mBulkFrameCallback.AddActor(imageView.GetProperty<int>(Actor::Property::ID));
 
       window.Add(imageView);
 
-      // Create an animation and set the progress so that each image starts at a different point.
-      Animation animation = Animation::New(ANIMATION_TIME);
-      animation.SetLooping(true);
-      animation.AnimateBetween(Property(imageView, Actor::Property::POSITION_X), keyFrames);
-      animation.SetCurrentProgress(std::min(1.0f, ANIMATION_PROGRESS_MULTIPLIER * i));
-      animation.Play();
+      const unsigned int animationIndex = std::min(i, animationCount - 1u);
+      if(animationIndex == animations.size())
+      {
+        Animation animation = Animation::New(ANIMATION_TIME);
+        animation.SetLooping(true);
+        animations.push_back(animation);
+      }
+      animations[animationIndex].AnimateBetween(Property(imageView, Actor::Property::POSITION_X), keyFrames);
+    }
+
+    for(unsigned int i = 0u; i < animations.size(); ++i)
+    {
+      animations[i].SetCurrentProgress(std::min(1.0f, ANIMATION_PROGRESS_MULTIPLIER * i));
+      animations[i].Play();
     }
 
     // Create a text-label to display whether the FrameCallback is enabled/disabled.
@@ -127,11 +251,53 @@ private:
     mTextLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
     window.Add(mTextLabel);
 
+    if(mHarness)
+    {
+      mHarness->StartRecording(window.GetRootLayer());
+      mHarness->StartPhase("animate");
+      if(mHarness->IsRecording())
+      {
+        mTimeUpdates    = true;
+        mBenchmarkTimer = Timer::New(static_cast<unsigned int>(gBenchmarkDuration * 1000.0f));
+        mBenchmarkTimer.TickSignal().Connect(this, &FrameCallbackController::OnBenchmarkFinished);
+        mBenchmarkTimer.Start();
+      }
+    }
+
     // Set the FrameCallbackInterface on the root layer.
-    DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameCallback, window.GetRootLayer());
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), GetFrameCallback(), window.GetRootLayer());
     mFrameCallbackEnabled = true;
   }
 
+  /**
+   * @brief The frame-callback added to the stage: the one used, wrapped by the update timer with --timing-output.
+   */
+  FrameCallbackInterface& GetFrameCallback()
+  {
+    if(mTimeUpdates)
+    {
+      return mUpdateTimer;
+    }
+    return gUseBulk ? static_cast<FrameCallbackInterface&>(mBulkFrameCallback) : mFrameCallback;
+  }
+
+  /**
+   * @brief Called when the benchmark has run for its duration; writes the frame and update times and quits.
+   */
+  bool OnBenchmarkFinished()
+  {
+    if(mFrameCallbackEnabled)
+    {
+      // stop the update thread from timing before reading the samples
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), GetFrameCallback());
+      mFrameCallbackEnabled = false;
+    }
+    mHarness->AddSamples("update", mUpdateTimer.GetSamples());
+    mHarness->FinishRecording();
+    mApplication.Quit();
+    return false;
+  }
+
   /**
    * @brief Called when a tap on the window occurs.
    *
@@ -141,13 +307,13 @@ private:
   {
     if(mFrameCallbackEnabled)
     {
-      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), mFrameCallback);
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), GetFrameCallback());
       mTextLabel.SetProperty(TextLabel::Property::TEXT, TEXT_DISABLED);
       mTextLabel.SetProperty(TextLabel::Property::TEXT_COLOR, TEXT_COLOR_DISABLED);
     }
     else
     {
-      DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameCallback, actor);
+      DevelStage::AddFrameCallback(Stage::GetCurrent(), GetFrameCallback(), actor);
       mTextLabel.SetProperty(TextLabel::Property::TEXT, TEXT_ENABLED);
       mTextLabel.SetProperty(TextLabel::Property::TEXT_COLOR, TEXT_COLOR_ENABLED);
     }
@@ -173,17 +339,49 @@ private:
   }
 
 private:
-  Application&       mApplication;          ///< A reference to the application instance.
-  FrameCallback      mFrameCallback;        ///< An instance of our implementation of the FrameCallbackInterface.
-  TextLabel          mTextLabel;            ///< Text label which shows whether the frame-callback is enabled/disabled.
-  TapGestureDetector mTapDetector;          ///< Tap detector to enable/disable the FrameCallbackInterface.
-  bool               mFrameCallbackEnabled; ///< Stores whether the FrameCallbackInterface is enabled/disabled.
+  Application&                  mApplication;          ///< A reference to the application instance.
+  DemoHelper::BenchmarkHarness* mHarness;              ///< Measures the update time, if given.
+  FrameCallback                 mFrameCallback;        ///< An instance of our implementation of the FrameCallbackInterface.
+  DemoHelper::BulkFrameCallback mBulkFrameCallback;    ///< Does the same for all the image-views at once, with --bulk.
+  UpdateTimer                   mUpdateTimer;          ///< Times the frame-callback used.
+  bool                          mTimeUpdates;          ///< Whether the update timer wraps the frame-callback, with --timing-output.
+  TextLabel                     mTextLabel;            ///< Text label which shows whether the frame-callback is enabled/disabled.
+  TapGestureDetector            mTapDetector;          ///< Tap detector to enable/disable the FrameCallbackInterface.
+  Timer                         mBenchmarkTimer;       ///< Ends the benchmark when recording.
+  bool                          mFrameCallbackEnabled; ///< Stores whether the FrameCallbackInterface is enabled/disabled.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application             application = Application::New(&argc, &argv);
-  FrameCallbackController controller(application);
+  DemoHelper::BenchmarkHarness harness("frame-callback", "frame-callback.example");
+  harness.AddOption("actors", "-n", "Number of image-views, 0 to fill the height of the window", gActorCount);
+  harness.AddFlag("bulk", "--bulk", "Updates the image-views with a structure-of-arrays frame-callback", gUseBulk);
+  harness.AddOption("workers", "-w", "Threads the kernel of --bulk runs on, including the update thread", gWorkerCount);
+  harness.AddOption("parallelThreshold", "--parallel-threshold=", "Actors below which --bulk runs its kernel on the update thread alone", gParallelThreshold);
+  harness.AddOption("duration", "-t", "Seconds measured with --timing-output", gBenchmarkDuration);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  Application application = Application::New(&argc, &argv);
+
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  FrameCallbackController controller(application, &harness);
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(FrameCallbackController)
@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include "frame-callback.h"
 
+// INTERNAL INCLUDES
+#include "shared/trace.h"
+
 using namespace Dali;
 using namespace std;
 
@@ -39,6 +42,9 @@ void FrameCallback::AddId(uint32_t id)
 
 void FrameCallback::Update(Dali::UpdateProxy& updateProxy, float /* elapsedSeconds */)
 {
+  DemoHelper::Tracer::Get().SetThreadName("Update thread");
+  DEMO_TRACE_SCOPE("FrameCallback::Update");
+
   // Go through Actor ID container and check if we've hit the sides.
   for(auto&& i : mActorIdContainer)
   {
@@ -19,6 +19,8 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/gaussian-blur-view/gaussian-blur-view.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using Dali::Toolkit::GaussianBlurView;
@@ -51,6 +53,8 @@ public:
 private:
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     auto    window     = application.GetWindow();
     Vector2 windowSize = window.GetSize();
     window.KeyEventSignal().Connect(this, &GaussianBlurViewExample::OnKeyEvent);
@@ -166,6 +170,7 @@ private:
   bool mActivate;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv);
@@ -176,3 +181,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(GaussianBlurViewExample)
@@ -18,6 +18,8 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <string>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -130,6 +132,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window & connect to the key event signal
     auto    window     = application.GetWindow();
     Vector2 windowSize = window.GetSize();
@@ -469,6 +473,7 @@ private:
   bool       mPanStarted = false;  ///< Set to true to state that panning has started.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application    application = Application::New(&argc, &argv);
@@ -476,3 +481,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(GestureExample)
@@ -18,12 +18,18 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 
+// INTERNAL INCLUDES
+#include "shared/benchmark-harness.h"
+#include "shared/example-startup.h"
+#include "shared/touch-trace.h"
+
 using namespace Dali;
 using Dali::Toolkit::TextLabel;
 
@@ -44,6 +50,10 @@ const float PAGE_SCALE_FACTOR_X(0.95f);
 const float PAGE_SCALE_FACTOR_Y(0.95f);
 const float PAGE_DURATION_SCALE_FACTOR(10.0f); ///< Time-scale factor, larger = animation is slower
 
+const float        PAGE_SNAP_DURATION(0.25f); ///< Seconds to settle on a page once a pan is released
+const float        FLICK_SPEED(0.5f);         ///< Pixels per millisecond from which a released pan moves to the next page
+const unsigned int REPLAY_SETTLE_TIME(1000u); ///< Milliseconds recorded after the last point of a touch replay
+
 const float    DEFAULT_OPT_ROW_COUNT(5);
 const float    DEFAULT_OPT_COL_COUNT(4);
 const float    DEFAULT_OPT_PAGE_COUNT(10);
@@ -64,23 +74,13 @@ const char* DEMO_APPS_NAMES[] =
   {
     "Achdyer", "Aughm", "Cerl", "Daril", "Emgha", "Ghatan", "Issum", "Lertan", "Mosorrad", "Achtortor", "Aughtheryer", "Certin", "Darpban", "Emiton", "Gibanis", "Itenthbel", "Liadem", "Mosraye", "Ackirlor", "Awitad", "Checerper", "Dasrad", "Emworeng", "Hatdyn", "K'ackves", "Liathar", "Mosth", "Ackptin", "Banengon", "Chegit", "Deeqskel", "Endnys", "Heesban", "Kagdra", "Liephden", "Neabar", "Aighte", "Banhinat", "Cheirat", "Delurnther", "Enessray", "Hesub", "Kalbankim", "Likellor", "Neerdem", "Akala", "Belrisash", "Che'rak", "Denalda", "Engyer", "Hinkelenth", "Kal'enda", "Loightmos", "Nichqua", "Alealdny", "Bilorm", "Cheves", "Derynkel", "En'rady", "Hirryer", "Kimest", "Loromum", "Nudraough", "Angash", "Bleustcer", "Chiperath", "Deurnos", "Enthount", "Ideinta", "Kimundeng", "Lorr", "Nuyim", "Anglor", "Bliagelor", "Chralerack", "Doyaryke", "Enundem", "Im'eld", "Koachlor", "Lortas", "Nycha", "Anveraugh", "Blorynton", "Chram", "Draithon", "Essina", "Ina'ir", "Kuren", "Lyerr", "Nyia", "Ardangas", "Booten", "Clyimen", "Drantess", "Faughald", "Ing'moro", "Kygver", "Maustbur", "Nyjac", "Ardug", "Bripolqua", "Coqueang", "Druardny", "Fiummos", "Ingormess", "Kyning", "Menvor", "Nystondar", "Ardworu", "Bryray", "Craennther", "Dynsaytor", "Garash", "Ingshy", "Laiyach", "Meusten", "Okine", "Ascerald", "Burust", "Cykage", "Dytinris", "Garight", "Issath", "Lasuzu", "Mirodskel", "Oldit", "Ash'ach", "Cataikel", "Dalek", "Eeni", "Garrynath", "Issendris", "Lekew", "Morhatrod", "Om'mose", "Athiund", "Cerilwar", "Darhkel", "Elmryn", "Ghalora", "Issey", "Lerengom", "Moserbel", "Onye", "Ososrak", "Pecertin", "Perrd"};
 
-// This code comes from command-line-options.cpp. the reason it's here is to
-// keep consistent the extra-help formatting when '--help' used.
-void PrintHelp(const char* const opt, const char* const optDescription)
-{
-  const std::ios_base::fmtflags flags = std::cout.flags();
-  std::cout << std::left << "  -";
-  std::cout.width(18);
-  std::cout << opt;
-  std::cout << optDescription;
-  std::cout << std::endl;
-  std::cout.flags(flags);
-}
-
 } // namespace
 
 /**
  * @brief This example is a benchmark that mimics the paged applications list of the homescreen application.
+ *
+ * By default the pages are scrolled by a script. With --touch-record they are dragged by hand instead, and the
+ * touches are written to a trace that --touch-replay feeds back, reporting the frame times of each of its segments.
  */
 class HomescreenBenchmark : public ConnectionTracker
 {
@@ -100,13 +100,20 @@ public:
     {
     }
 
-    int      mRows;
-    int      mCols;
-    int      mPageCount;
-    bool     mTableViewEnabled;
-    bool     mIconLabelsEnabled;
-    IconType mIconType;
-    bool     mUseTextLabel;
+    bool IsTouchDriven() const
+    {
+      return !mTouchReplayPath.empty() || !mTouchRecordPath.empty();
+    }
+
+    int         mRows;
+    int         mCols;
+    int         mPageCount;
+    bool        mTableViewEnabled;
+    bool        mIconLabelsEnabled;
+    IconType    mIconType;
+    bool        mUseTextLabel;
+    std::string mTouchReplayPath; ///< Pages are scrolled by the touches of this trace rather than the script
+    std::string mTouchRecordPath; ///< Pages are scrolled by the user, whose touches are recorded to this trace
   };
 
   // animation script data
@@ -124,8 +131,9 @@ public:
     bool  mFlick;    ///< Use flick or 'one-by-one' scroll
   };
 
-  HomescreenBenchmark(Application& application, const Config& config)
+  HomescreenBenchmark(Application& application, const Config& config, DemoHelper::BenchmarkHarness& harness)
   : mApplication(application),
+    mHarness(harness),
     mConfig(config),
     mScriptFrame(0),
     mCurrentPage(0)
@@ -141,11 +149,23 @@ public:
   // The Init signal is received once (only) during the Application lifetime.
   void Create(Application& application)
   {
-    // Create benchmark script
-    CreateScript();
+    DemoHelper::StartExample(application);
+
+    // Create benchmark script, unless the pages are scrolled by touch
+    if(!mConfig.mTouchReplayPath.empty() && !mTouchTrace.Load(mConfig.mTouchReplayPath))
+    {
+      std::cerr << "Failed to read the touch trace " << mConfig.mTouchReplayPath << std::endl;
+      mApplication.Quit();
+      return;
+    }
+    if(!mConfig.IsTouchDriven())
+    {
+      CreateScript();
+    }
 
     // Get a handle to the window
     Window window = application.GetWindow();
+    mHarness.StartRecording(window.GetRootLayer());
 
     mScrollParent = Actor::New();
     mScrollParent.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
@@ -163,8 +183,19 @@ public:
 
     window.Add(mScrollParent);
 
-    // Respond to a click anywhere on the window.
-    window.GetRootLayer().TouchedSignal().Connect(this, &HomescreenBenchmark::OnTouch);
+    if(mConfig.IsTouchDriven())
+    {
+      // Drag the pages, between them too
+      mPanDetector = PanGestureDetector::New();
+      mPanDetector.Attach(mScrollParent);
+      mPanDetector.Attach(background);
+      mPanDetector.DetectedSignal().Connect(this, &HomescreenBenchmark::OnPan);
+    }
+    else
+    {
+      // Respond to a click anywhere on the window.
+      window.GetRootLayer().TouchedSignal().Connect(this, &HomescreenBenchmark::OnTouch);
+    }
 
     // Respond to key events
     window.KeyEventSignal().Connect(this, &HomescreenBenchmark::OnKeyEvent);
@@ -380,6 +411,7 @@ public:
     mShowAnimation.AnimateTo(Property(mScrollParent, Actor::Property::COLOR_ALPHA), 1.0f, AlphaFunction::EASE_IN_OUT);
     mShowAnimation.AnimateTo(Property(mScrollParent, Actor::Property::SCALE), Vector3::ONE, AlphaFunction::EASE_IN_OUT);
     mShowAnimation.FinishedSignal().Connect(this, &HomescreenBenchmark::OnAnimationEnd);
+    mHarness.StartPhase("show");
     mShowAnimation.Play();
   }
 
@@ -405,16 +437,119 @@ public:
     mCurrentPage += pages;
   }
 
+  void OnPan(Actor actor, const PanGesture& pan)
+  {
+    switch(pan.GetState())
+    {
+      case GestureState::STARTED:
+      {
+        // Catch the pages where they are
+        if(mScrollAnimation)
+        {
+          mScrollAnimation.Stop();
+        }
+        mDragPosition = mScrollParent.GetCurrentProperty<Vector3>(Actor::Property::POSITION).x + pan.GetDisplacement().x;
+        mScrollParent.SetProperty(Actor::Property::POSITION_X, mDragPosition);
+        break;
+      }
+
+      case GestureState::CONTINUING:
+      {
+        mDragPosition += pan.GetDisplacement().x;
+        mScrollParent.SetProperty(Actor::Property::POSITION_X, mDragPosition);
+        break;
+      }
+
+      case GestureState::FINISHED:
+      case GestureState::CANCELLED:
+      {
+        // Settle on the nearest page, or the next one in the direction of a flick
+        const float pageWidth = mApplication.GetWindow().GetSize().GetWidth();
+        const float page      = -mDragPosition / pageWidth;
+        const float velocity  = pan.GetVelocity().x;
+        int         target    = static_cast<int>(std::round(page));
+        if(velocity < -FLICK_SPEED)
+        {
+          target = static_cast<int>(std::floor(page)) + 1;
+        }
+        else if(velocity > FLICK_SPEED)
+        {
+          target = static_cast<int>(std::ceil(page)) - 1;
+        }
+        mCurrentPage = std::max(0, std::min(target, mConfig.mPageCount - 1));
+
+        mScrollAnimation = Animation::New(PAGE_SNAP_DURATION);
+        mScrollAnimation.AnimateTo(Property(mScrollParent, Actor::Property::POSITION_X), -mCurrentPage * pageWidth, AlphaFunction::EASE_OUT);
+        mScrollAnimation.Play();
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  void StartTouchSession()
+  {
+    if(!mConfig.mTouchReplayPath.empty())
+    {
+      // The touches before the first segment of the trace, if any, are reported as "replay"
+      mHarness.StartPhase("replay");
+      mTouchTrace.SegmentStartedSignal().Connect(this, &HomescreenBenchmark::OnTouchSegmentStarted);
+      mTouchTrace.FinishedSignal().Connect(this, &HomescreenBenchmark::OnTouchReplayFinished);
+      mTouchTrace.StartReplay();
+    }
+    else
+    {
+      mHarness.StartPhase("record");
+      mTouchTrace.StartRecording(mApplication.GetWindow());
+      std::cout << "Recording touches, press Escape to write them to " << mConfig.mTouchRecordPath << std::endl;
+    }
+  }
+
+  void OnTouchSegmentStarted(const std::string& name)
+  {
+    mHarness.StartPhase(name);
+  }
+
+  void OnTouchReplayFinished()
+  {
+    // Let the pages settle after the last gesture
+    mReplaySettleTimer = Timer::New(REPLAY_SETTLE_TIME);
+    mReplaySettleTimer.TickSignal().Connect(this, &HomescreenBenchmark::OnReplaySettled);
+    mReplaySettleTimer.Start();
+  }
+
+  bool OnReplaySettled()
+  {
+    mHarness.FinishRecording();
+    mApplication.Quit();
+    return false;
+  }
+
   void OnAnimationEnd(Animation& source)
   {
-    if(mScriptFrame < mScriptFrameData.size())
+    if(mConfig.IsTouchDriven())
+    {
+      // Only the show animation is followed
+      StartTouchSession();
+    }
+    else if(mScriptFrame < mScriptFrameData.size())
     {
+      if(mScriptFrame == 0u)
+      {
+        mHarness.StartPhase("scroll");
+      }
+
       ScriptData& frame = mScriptFrameData[mScriptFrame];
       ScrollPages(frame.mPages, frame.mDuration, frame.mFlick);
       ++mScriptFrame;
     }
     else
     {
+      mHarness.FinishRecording();
       mApplication.Quit();
     }
   }
@@ -425,78 +560,76 @@ public:
     {
       if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
       {
+        if(!mConfig.mTouchRecordPath.empty())
+        {
+          mHarness.FinishRecording();
+          if(mTouchTrace.Save(mConfig.mTouchRecordPath))
+          {
+            std::cout << "Touch trace written to " << mConfig.mTouchRecordPath << std::endl;
+          }
+          else
+          {
+            std::cerr << "Failed to write the touch trace to " << mConfig.mTouchRecordPath << std::endl;
+          }
+        }
         mApplication.Quit();
       }
     }
   }
 
 private:
-  Application&            mApplication;
-  Actor                   mScrollParent;
-  Animation               mShowAnimation;
-  Animation               mScrollAnimation;
-  Config                  mConfig;
-  std::vector<ScriptData> mScriptFrameData;
-  size_t                  mScriptFrame;
-  int                     mCurrentPage;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness& mHarness;
+  Actor                         mScrollParent;
+  Animation                     mShowAnimation;
+  Animation                     mScrollAnimation;
+  PanGestureDetector            mPanDetector;
+  DemoHelper::TouchTrace        mTouchTrace;
+  Timer                         mReplaySettleTimer;
+  float                         mDragPosition{0.0f};
+  Config                        mConfig;
+  std::vector<ScriptData>       mScriptFrameData;
+  size_t                        mScriptFrame;
+  int                           mCurrentPage;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   // Default settings.
   HomescreenBenchmark::Config config;
+  bool                        useCheckbox = false;
+
+  DemoHelper::BenchmarkHarness harness("homescreen-benchmark", "homescreen-benchmark.example");
+  harness.AddOption("columns", "-c", "Number of columns", config.mCols);
+  harness.AddOption("rows", "-r", "Number of rows", config.mRows);
+  harness.AddOption("pages", "-p", "Number of pages ( must be greater than 1 )", config.mPageCount);
+  harness.AddFlag("disableTableView", "--disable-tableview", "Disables the use of TableView for layouting", config.mTableViewEnabled, false);
+  harness.AddFlag("disableIconLabels", "--disable-icon-labels", "Disables labels for each icon", config.mIconLabelsEnabled, false);
+  harness.AddFlag("useCheckbox", "--use-checkbox", "Uses checkboxes for icons", useCheckbox);
+  harness.AddFlag("useTextLabel", "--use-text-label", "Uses TextLabel instead of a TextVisual", config.mUseTextLabel);
+  harness.AddOption("touchReplay", "--touch-replay=", "Scrolls by replaying a touch trace, its segments reported as phases", config.mTouchReplayPath);
+  harness.AddOption("touchRecord", "--touch-record=", "Scrolls by touch and records a touch trace, written on Escape", config.mTouchRecordPath);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
 
-  bool printHelpAndExit = false;
+  if(useCheckbox)
+  {
+    config.mIconType = CHECKBOX;
+  }
 
-  for(int i = 1; i < argc; ++i)
+  if(harness.IsSweep() && !harness.IsHelpRequested())
   {
-    std::string arg(argv[i]);
-    if(arg.compare(0, 2, "-r") == 0)
-    {
-      config.mRows = atoi(arg.substr(2).c_str());
-    }
-    else if(arg.compare(0, 2, "-c") == 0)
-    {
-      config.mCols = atoi(arg.substr(2).c_str());
-    }
-    else if(arg.compare(0, 2, "-p") == 0)
-    {
-      config.mPageCount = atoi(arg.substr(2).c_str());
-    }
-    else if(arg.compare("--disable-tableview") == 0)
-    {
-      config.mTableViewEnabled = false;
-    }
-    else if(arg.compare("--disable-icon-labels") == 0)
-    {
-      config.mIconLabelsEnabled = false;
-    }
-    else if(arg.compare("--use-checkbox") == 0)
-    {
-      config.mIconType = CHECKBOX;
-    }
-    else if(arg.compare("--use-text-label") == 0)
-    {
-      config.mUseTextLabel = true;
-    }
-    else if(arg.compare("--help") == 0)
-    {
-      printHelpAndExit = true;
-    }
+    return harness.RunSweep();
   }
 
   Application         application = Application::New(&argc, &argv);
-  HomescreenBenchmark test(application, config);
+  HomescreenBenchmark test(application, config, harness);
 
-  if(printHelpAndExit)
+  if(harness.IsHelpRequested())
   {
-    PrintHelp("c<num>", " Number of columns");
-    PrintHelp("r<num>", " Number of rows");
-    PrintHelp("p<num>", " Number of pages ( must be greater than 1 )");
-    PrintHelp("-disable-tableview", " Disables the use of TableView for layouting");
-    PrintHelp("-disable-icon-labels", " Disables labels for each icon");
-    PrintHelp("-use-checkbox", " Uses checkboxes for icons");
-    PrintHelp("-use-text-label", " Uses TextLabel instead of a TextVisual");
+    harness.PrintHelp();
     return 0;
   }
 
@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali/dali.h>
 #include <string>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -375,6 +377,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Property::Map gradientBackground;
     CreateGradient(gradientBackground);
 
@@ -541,6 +545,7 @@ private:
   unsigned int mExampleIndex;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application   application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -548,3 +553,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ImagePolicies)
@@ -21,6 +21,8 @@
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
 #include <iostream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -171,6 +173,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window  window     = application.GetWindow();
     Vector2 windowSize = window.GetSize();
@@ -688,6 +692,7 @@ private:
   bool                 mQueuedImageLoad;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                        application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -695,3 +700,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ImageScalingAndFilteringController)
@@ -53,6 +53,8 @@
 
 // INTERNAL INCLUDES
 #include "grid-flags.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -293,6 +295,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     std::cout << "ImageScalingIrregularGridController::Create" << std::endl;
 
     // Get a handle to the window:
@@ -638,6 +642,7 @@ private:
   unsigned int                                mImagesLoaded; ///< How many images have been loaded
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                         application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -645,3 +650,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ImageScalingIrregularGridController)
@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali/dali.h>
 #include <string>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -92,6 +94,8 @@ public:
 
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // The Init signal is received once (only) during the Application lifetime
 
     // Creates a default view with a default tool bar.
@@ -278,6 +282,7 @@ private:
   Toolkit::TableView::CellPosition mCurrentPositionImage;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application         application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -285,3 +290,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ImageViewController)
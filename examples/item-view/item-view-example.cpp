@@ -16,6 +16,8 @@
  */
 
 #include <sstream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -194,6 +196,8 @@ public:
    */
   void OnInit(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     Window window = app.GetWindow();
     window.KeyEventSignal().Connect(this, &ItemViewExample::OnKeyEvent);
     window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR, Layer::LAYER_3D);
@@ -995,6 +999,7 @@ private:
   LongPressGestureDetector mLongPressDetector;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application     app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -1002,3 +1007,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ItemViewExample)
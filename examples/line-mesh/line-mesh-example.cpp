@@ -21,6 +21,8 @@
 #include <dali/devel-api/actors/actor-devel.h>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <sstream>
@@ -145,6 +147,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     // initial settings
@@ -381,6 +385,7 @@ private:
   int                  mMaxIndexCount;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv);
@@ -388,3 +393,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ExampleController)
@@ -18,6 +18,8 @@
 // EXTERNAL INCLUDES
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -193,6 +195,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
     window.KeyEventSignal().Connect(this, &ExampleController::OnKeyEvent);
     mWindowSize = window.GetSize();
@@ -396,6 +400,7 @@ private:
   bool               mMagnifierShown;        ///< Flag indicating whether the magnifier is being shown or not.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -403,3 +408,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ExampleController)
@@ -18,15 +18,21 @@
 // EXTERNAL INCLUDES
 #include <cstdint> // uint32_t, uint16_t etc
 #include <cstdio>
+#include <iostream>
 #include <string>
+#include <vector>
 
 #include <dali/public-api/math/random.h>
+#include <dali/public-api/object/handle.h>
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
+#include "shared/benchmark-harness.h"
+#include "shared/example-startup.h"
+#include "shared/metaball-field.h"
 #include "shared/utility.h" // DemoHelper::LoadTexture
 
 using namespace Dali;
@@ -36,9 +42,18 @@ namespace // unnamed namespace for constants
 // background image
 const char* const BACKGROUND_IMAGE(DEMO_IMAGE_DIR "background-2.jpg");
 
-// number of metaballs
+// default number of metaballs
 constexpr uint32_t METABALL_NUMBER = 6;
 
+constexpr uint32_t MAXIMUM_METABALL_NUMBER = 512;
+
+const uint32_t BENCHMARK_IDLE_TIME(2000u);    // milliseconds recorded before the explosion
+const uint32_t BENCHMARK_EXPLODE_TIME(6000u); // milliseconds recorded from the explosion until the balls are back
+
+uint32_t gMetaballCount(METABALL_NUMBER);
+bool     gField(false);
+uint32_t gFboScale(1u);
+
 /**
  * Vertex shader code for metaball
  */
@@ -84,6 +99,27 @@ const char* const METABALL_FRAG_SHADER = DALI_COMPOSE_SHADER (
   }\n
 );
 
+/**
+ * Fragment shader code for the field of all the metaballs at once, prefixed by MetaballField::GetShaderPrefix()
+ */
+const char* const METABALL_FIELD_FRAG_SHADER = DALI_COMPOSE_SHADER (
+  precision mediump float;\n
+  varying vec2 vTexCoord;\n
+  uniform vec4 uMetaballs[METABALL_COUNT];\n
+  void main()\n
+  {\n
+    vec2 adjustedCoords = vTexCoord * 2.0 - 1.0;\n
+    float color = 0.0;\n
+    for (int i = 0; i < METABALL_COUNT; i++)\n
+    {\n
+      vec2 distanceVec = adjustedCoords - uMetaballs[i].xy;\n
+      color += inversesqrt(dot(distanceVec, distanceVec)) * uMetaballs[i].z;\n
+    }\n
+    \n
+    gl_FragColor = vec4(color,color,color,1.0);\n
+  }\n
+);
+
 /**
  * Fragment shader code for metaball and background composition with refraction effect
  */
@@ -165,7 +201,7 @@ const char* const REFRACTION_FRAG_SHADER = DALI_COMPOSE_SHADER (
  */
 struct MetaballInfo
 {
-  Actor   actor;
+  Handle  handle; ///< The actor drawing the ball, or the handle of its properties with --field
   Vector2 position;
   float   radius;
   float   initRadius;
@@ -173,6 +209,9 @@ struct MetaballInfo
   //new shader stuff
   Property::Index positionIndex;
   Property::Index positionVarIndex;
+  Property::Index gravityIndex;
+  Property::Index radiusIndex;
+  Property::Index radiusVarIndex;
 };
 
 } // unnamed namespace
@@ -181,6 +220,13 @@ struct MetaballInfo
  * Demo using Metaballs
  *
  * When the metaball is clicked it explodes to smaller balls
+ *
+ * With --field, a single actor evaluates the field of all the metaballs, packed in one uniform array, instead of an
+ * actor per ball, so that the metaball can be made of more balls, up to MetaballField::MAXIMUM_BALL_COUNT; --fbo-scale
+ * divides the resolution the field is rendered at. With --timing-output, it records the frame times before an explosion, then until the balls are
+ * back, and quits, e.g.:
+ *
+ * ./metaball-explosion.example --sweep=balls=6,64,200 --sweep=field=0,1 --sweep=fboScale=1,2,4
  */
 class MetaballExplosionController : public ConnectionTracker
 {
@@ -188,8 +234,9 @@ public:
   /**
    * Constructor
    * @param application
+   * @param harness Records the frame times of an explosion, if given
    */
-  MetaballExplosionController(Application& application);
+  MetaballExplosionController(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr);
 
   /**
    * Destructor
@@ -212,15 +259,21 @@ public:
    */
   void OnKeyEvent(const KeyEvent& event);
 
+  /**
+   * Explodes the metaball of the benchmark, then ends it
+   */
+  bool OnBenchmarkTick();
+
 private: // Data
-  Application& mApplication;
-  Vector2      mScreenSize;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness* mHarness;
+  Vector2                       mScreenSize;
 
   Texture     mBackgroundTexture;
   FrameBuffer mMetaballFBO;
 
-  Actor        mMetaballRoot;
-  MetaballInfo mMetaballs[METABALL_NUMBER];
+  Actor                     mMetaballRoot;
+  std::vector<MetaballInfo> mMetaballs;
 
   Property::Index mPositionIndex;
   Actor           mCompositionActor;
@@ -233,15 +286,18 @@ private: // Data
   Vector2 mMetaballCenter;
 
   //Animations
-  Animation mPositionVarAnimation[METABALL_NUMBER];
+  std::vector<Animation> mPositionVarAnimation;
 
-  uint32_t  mDispersion;
-  Animation mDispersionAnimation[METABALL_NUMBER];
+  uint32_t               mDispersion;
+  std::vector<Animation> mDispersionAnimation;
 
   Timer mTimerDispersion;
 
   float mTimeMultiplier;
 
+  Timer    mBenchmarkTimer;
+  uint32_t mBenchmarkStep;
+
   // Private helper functions
 
   /**
@@ -306,13 +362,14 @@ private: // Data
  * Implementation
  */
 
-MetaballExplosionController::MetaballExplosionController(Application& application)
+MetaballExplosionController::MetaballExplosionController(Application& application, DemoHelper::BenchmarkHarness* harness)
 : mApplication(application),
+  mHarness(harness),
   mScreenSize(),
   mBackgroundTexture(),
   mMetaballFBO(),
   mMetaballRoot(),
-  mMetaballs(),
+  mMetaballs(gMetaballCount),
   mPositionIndex(),
   mCompositionActor(),
   mCurrentTouchPosition(),
@@ -320,11 +377,13 @@ MetaballExplosionController::MetaballExplosionController(Application& applicatio
   mMetaballPosVariationFrom(),
   mMetaballPosVariationTo(),
   mMetaballCenter(),
-  mPositionVarAnimation(),
+  mPositionVarAnimation(gMetaballCount),
   mDispersion(0),
-  mDispersionAnimation(),
+  mDispersionAnimation(gMetaballCount),
   mTimerDispersion(),
-  mTimeMultiplier(1.0f)
+  mTimeMultiplier(1.0f),
+  mBenchmarkTimer(),
+  mBenchmarkStep(0)
 {
   // Connect to the Application's Init signal
   mApplication.InitSignal().Connect(this, &MetaballExplosionController::Create);
@@ -337,6 +396,8 @@ MetaballExplosionController::~MetaballExplosionController()
 
 void MetaballExplosionController::Create(Application& app)
 {
+  DemoHelper::StartExample(app);
+
   Window window = app.GetWindow();
 
   window.KeyEventSignal().Connect(this, &MetaballExplosionController::OnKeyEvent);
@@ -365,6 +426,18 @@ void MetaballExplosionController::Create(Application& app)
 
   // Connect the callback to the touch signal on the mesh actor
   window.GetRootLayer().TouchedSignal().Connect(this, &MetaballExplosionController::OnTouch);
+
+  if(mHarness)
+  {
+    mHarness->StartRecording(window.GetRootLayer());
+  }
+  if(mHarness && mHarness->IsRecording())
+  {
+    mHarness->StartPhase("idle");
+    mBenchmarkTimer = Timer::New(BENCHMARK_IDLE_TIME);
+    mBenchmarkTimer.TickSignal().Connect(this, &MetaballExplosionController::OnBenchmarkTick);
+    mBenchmarkTimer.Start();
+  }
 }
 
 Geometry MetaballExplosionController::CreateGeometry(bool aspectMappedTexture)
@@ -429,44 +502,81 @@ Geometry MetaballExplosionController::CreateGeometry(bool aspectMappedTexture)
 void MetaballExplosionController::CreateMetaballActors()
 {
   // Create the shader for the metaballs, tell DALi that shader modifies geometry so we dont need to set a meaningless size
-  Shader shader = Shader::New(METABALL_VERTEX_SHADER, METABALL_FRAG_SHADER, Shader::Hint::MODIFIES_GEOMETRY);
+  Shader shader;
+  if(gField)
+  {
+    shader = Shader::New(METABALL_VERTEX_SHADER, DemoHelper::MetaballField::GetShaderPrefix(gMetaballCount) + METABALL_FIELD_FRAG_SHADER, Shader::Hint::MODIFIES_GEOMETRY);
+  }
+  else
+  {
+    shader = Shader::New(METABALL_VERTEX_SHADER, METABALL_FRAG_SHADER, Shader::Hint::MODIFIES_GEOMETRY);
+  }
 
   Geometry metaballGeom = CreateGeometry();
   // Reuse same renderer for each actor
   Renderer renderer = Renderer::New(metaballGeom, shader);
-  renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_RGB, BlendFactor::ONE);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_RGB, BlendFactor::ONE);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_ALPHA, BlendFactor::ONE);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_ALPHA, BlendFactor::ONE);
+  if(!gField)
+  {
+    // The fields of the balls add up
+    renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_RGB, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_RGB, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_ALPHA, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_ALPHA, BlendFactor::ONE);
+  }
+
+  // Root creation
+  mMetaballRoot = Actor::New();
+  mMetaballRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+
+  // With --field, one actor draws the field of all the metaballs, whose properties are on handles of their own
+  Actor field;
+  if(gField)
+  {
+    field = Actor::New();
+    field.SetProperty(Dali::Actor::Property::NAME, "MetaballField");
+    field.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    field.AddRenderer(renderer);
+    mMetaballRoot.Add(field);
+  }
+
+  // The balls share the field of the default number of balls, so that they make a metaball of the same size
+  const float radiusScale = static_cast<float>(METABALL_NUMBER) / gMetaballCount;
 
   //Initialization of each of the metaballs
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  for(uint32_t i = 0; i < gMetaballCount; i++)
   {
     mMetaballs[i].position = Vector2(0.0f, 0.0f);
-    mMetaballs[i].radius = mMetaballs[i].initRadius = Random::Range(0.05f, 0.07f);
+    mMetaballs[i].radius = mMetaballs[i].initRadius = Random::Range(0.05f, 0.07f) * radiusScale;
 
-    mMetaballs[i].actor = Actor::New();
-    mMetaballs[i].actor.SetProperty(Dali::Actor::Property::NAME, "Metaball");
-    mMetaballs[i].actor.SetProperty(Actor::Property::SCALE, 1.0f);
-    mMetaballs[i].actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-    mMetaballs[i].actor.AddRenderer(renderer);
+    if(gField)
+    {
+      mMetaballs[i].handle = Handle::New();
+    }
+    else
+    {
+      Actor actor = Actor::New();
+      actor.SetProperty(Dali::Actor::Property::NAME, "Metaball");
+      actor.SetProperty(Actor::Property::SCALE, 1.0f);
+      actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+      actor.AddRenderer(renderer);
+      mMetaballRoot.Add(actor);
+
+      mMetaballs[i].handle = actor;
+    }
 
-    mMetaballs[i].positionIndex = mMetaballs[i].actor.RegisterProperty("uPositionMetaball", mMetaballs[i].position);
+    mMetaballs[i].positionIndex = mMetaballs[i].handle.RegisterProperty("uPositionMetaball", mMetaballs[i].position);
 
-    mMetaballs[i].positionVarIndex = mMetaballs[i].actor.RegisterProperty("uPositionVar", Vector2(0.f, 0.f));
+    mMetaballs[i].positionVarIndex = mMetaballs[i].handle.RegisterProperty("uPositionVar", Vector2(0.f, 0.f));
 
-    mMetaballs[i].actor.RegisterProperty("uGravityVector", Vector2(Random::Range(-0.2, 0.2), Random::Range(-0.2, 0.2)));
-    mMetaballs[i].actor.RegisterProperty("uRadius", mMetaballs[i].radius);
-    mMetaballs[i].actor.RegisterProperty("uRadiusVar", 0.f);
-  }
+    mMetaballs[i].gravityIndex   = mMetaballs[i].handle.RegisterProperty("uGravityVector", Vector2(Random::Range(-0.2, 0.2), Random::Range(-0.2, 0.2)));
+    mMetaballs[i].radiusIndex    = mMetaballs[i].handle.RegisterProperty("uRadius", mMetaballs[i].radius);
+    mMetaballs[i].radiusVarIndex = mMetaballs[i].handle.RegisterProperty("uRadiusVar", 0.f);
 
-  // Root creation
-  mMetaballRoot = Actor::New();
-  mMetaballRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
-  {
-    mMetaballRoot.Add(mMetaballs[i].actor);
+    if(gField)
+    {
+      DemoHelper::MetaballField::AddBall(field, i, mMetaballs[i].handle, {mMetaballs[i].positionIndex, mMetaballs[i].positionVarIndex, mMetaballs[i].gravityIndex, mMetaballs[i].radiusIndex, mMetaballs[i].radiusVarIndex});
+    }
   }
 }
 
@@ -475,7 +585,8 @@ void MetaballExplosionController::CreateMetaballImage()
   // Create an FBO and a render task to create to render the metaballs with a fragment shader
   Window window = mApplication.GetWindow();
 
-  mMetaballFBO = FrameBuffer::New(mScreenSize.x, mScreenSize.y);
+  // The composition samples it filtered, so it can be smaller than the screen
+  mMetaballFBO = FrameBuffer::New(static_cast<uint32_t>(mScreenSize.x) / gFboScale, static_cast<uint32_t>(mScreenSize.y) / gFboScale);
 
   window.Add(mMetaballRoot);
 
@@ -530,7 +641,7 @@ void MetaballExplosionController::CreateAnimations()
 {
   Vector2 direction;
 
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  for(uint32_t i = 0; i < gMetaballCount; i++)
   {
     KeyFrames keySinCosVariation = KeyFrames::New();
     Vector2   sinCosVariation(0, 0);
@@ -550,7 +661,7 @@ void MetaballExplosionController::CreateAnimations()
     }
 
     mPositionVarAnimation[i] = Animation::New(3.f);
-    mPositionVarAnimation[i].AnimateBetween(Property(mMetaballs[i].actor, mMetaballs[i].positionVarIndex), keySinCosVariation);
+    mPositionVarAnimation[i].AnimateBetween(Property(mMetaballs[i].handle, mMetaballs[i].positionVarIndex), keySinCosVariation);
     mPositionVarAnimation[i].SetLooping(true);
     mPositionVarAnimation[i].Play();
   }
@@ -558,7 +669,7 @@ void MetaballExplosionController::CreateAnimations()
 
 void MetaballExplosionController::ResetMetaballs(bool resetAnims)
 {
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  for(uint32_t i = 0; i < gMetaballCount; i++)
   {
     if(mDispersionAnimation[i])
     {
@@ -566,7 +677,7 @@ void MetaballExplosionController::ResetMetaballs(bool resetAnims)
     }
 
     mMetaballs[i].position = Vector2(0.0f, 0.0f);
-    mMetaballs[i].actor.SetProperty(mMetaballs[i].positionIndex, mMetaballs[i].position);
+    mMetaballs[i].handle.SetProperty(mMetaballs[i].positionIndex, mMetaballs[i].position);
   }
   mTimerDispersion.Stop();
   mDispersion = 0;
@@ -581,10 +692,10 @@ void MetaballExplosionController::DisperseBallAnimation(uint32_t ball)
   position.y = Random::Range(-1.5f, 1.5f);
 
   mDispersionAnimation[ball] = Animation::New(2.0f * mTimeMultiplier);
-  mDispersionAnimation[ball].AnimateTo(Property(mMetaballs[ball].actor, mMetaballs[ball].positionIndex), position);
+  mDispersionAnimation[ball].AnimateTo(Property(mMetaballs[ball].handle, mMetaballs[ball].positionIndex), position);
   mDispersionAnimation[ball].Play();
 
-  if(ball == METABALL_NUMBER - 1)
+  if(ball == gMetaballCount - 1)
   {
     mDispersionAnimation[ball].FinishedSignal().Connect(this, &MetaballExplosionController::LaunchResetMetaballPosition);
   }
@@ -592,13 +703,15 @@ void MetaballExplosionController::DisperseBallAnimation(uint32_t ball)
 
 void MetaballExplosionController::LaunchResetMetaballPosition(Animation& source)
 {
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  // The balls come back in as long as the default number of balls does
+  const float delayScale = static_cast<float>(METABALL_NUMBER) / gMetaballCount;
+  for(uint32_t i = 0; i < gMetaballCount; i++)
   {
-    mDispersionAnimation[i] = Animation::New(1.5f + i * 0.25f * mTimeMultiplier);
-    mDispersionAnimation[i].AnimateTo(Property(mMetaballs[i].actor, mMetaballs[i].positionIndex), Vector2(0, 0));
+    mDispersionAnimation[i] = Animation::New(1.5f + i * 0.25f * delayScale * mTimeMultiplier);
+    mDispersionAnimation[i].AnimateTo(Property(mMetaballs[i].handle, mMetaballs[i].positionIndex), Vector2(0, 0));
     mDispersionAnimation[i].Play();
 
-    if(i == METABALL_NUMBER - 1)
+    if(i == gMetaballCount - 1)
     {
       mDispersionAnimation[i].FinishedSignal().Connect(this, &MetaballExplosionController::EndDisperseAnimation);
     }
@@ -612,7 +725,9 @@ void MetaballExplosionController::EndDisperseAnimation(Animation& source)
 
 bool MetaballExplosionController::OnTimerDispersionTick()
 {
-  if(mDispersion < METABALL_NUMBER)
+  // Disperse the balls in as many ticks as the default number of balls
+  const uint32_t ballsPerTick = (gMetaballCount + METABALL_NUMBER - 1) / METABALL_NUMBER;
+  for(uint32_t i = 0; i < ballsPerTick && mDispersion < gMetaballCount; i++)
   {
     DisperseBallAnimation(mDispersion);
     mDispersion++;
@@ -623,10 +738,10 @@ bool MetaballExplosionController::OnTimerDispersionTick()
 void MetaballExplosionController::SetPositionToMetaballs(const Vector2& metaballCenter)
 {
   //We set the position for the metaballs based on click position
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  for(uint32_t i = 0; i < gMetaballCount; i++)
   {
     mMetaballs[i].position = metaballCenter;
-    mMetaballs[i].actor.SetProperty(mMetaballs[i].positionIndex, mMetaballs[i].position);
+    mMetaballs[i].handle.SetProperty(mMetaballs[i].positionIndex, mMetaballs[i].position);
   }
 
   mCompositionActor.SetProperty(mPositionIndex, metaballCenter);
@@ -668,6 +783,22 @@ bool MetaballExplosionController::OnTouch(Actor actor, const TouchEvent& touch)
   return true;
 }
 
+bool MetaballExplosionController::OnBenchmarkTick()
+{
+  if(mBenchmarkStep++ == 0u)
+  {
+    // Release at the center, as a tap would
+    mHarness->StartPhase("explode");
+    mTimerDispersion.Start();
+    mBenchmarkTimer.SetInterval(BENCHMARK_EXPLODE_TIME);
+    return true;
+  }
+
+  mHarness->FinishRecording();
+  mApplication.Quit();
+  return false;
+}
+
 void MetaballExplosionController::OnKeyEvent(const KeyEvent& event)
 {
   if(event.GetState() == KeyEvent::DOWN)
@@ -684,9 +815,48 @@ void MetaballExplosionController::OnKeyEvent(const KeyEvent& event)
  */
 int32_t DALI_EXPORT_API main(int argc, char** argv)
 {
+  DemoHelper::BenchmarkHarness harness("metaball-explosion", "metaball-explosion.example");
+  harness.AddOption("balls", "-n", "Number of balls making the metaball", gMetaballCount);
+  harness.AddFlag("field", "--field", "Evaluates the field of all the metaballs in a single pass", gField);
+  harness.AddOption("fboScale", "--fbo-scale=", "Divides the resolution the metaballs are rendered at: 1, 2 or 4", gFboScale);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(gMetaballCount < 1u || gMetaballCount > MAXIMUM_METABALL_NUMBER)
+  {
+    std::cerr << "The number of balls must be from 1 to " << MAXIMUM_METABALL_NUMBER << std::endl;
+    return 1;
+  }
+
+  if(gFboScale != 1u && gFboScale != 2u && gFboScale != 4u)
+  {
+    std::cerr << "The scale of the frame buffer must be 1, 2 or 4" << std::endl;
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  // Every ball of the field takes a uniform vector, of which a fragment shader can't have many
+  if(gField && gMetaballCount > DemoHelper::MetaballField::MAXIMUM_BALL_COUNT)
+  {
+    std::cerr << "The field has at most " << DemoHelper::MetaballField::MAXIMUM_BALL_COUNT << " balls, the GPU may not have the uniforms for more" << std::endl;
+    gMetaballCount = DemoHelper::MetaballField::MAXIMUM_BALL_COUNT;
+  }
+
   Application application = Application::New(&argc, &argv);
 
-  MetaballExplosionController test(application);
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  MetaballExplosionController test(application, &harness);
 
   application.MainLoop();
 
@@ -18,14 +18,19 @@
 // EXTERNAL INCLUDES
 #include <cstdint> // uint32_t, uint16_t etc
 #include <cstdio>
+#include <iostream>
 #include <string>
 
+#include <dali/public-api/object/handle.h>
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
 
 // INTERNAL INCLUDES
+#include "shared/benchmark-harness.h"
+#include "shared/example-startup.h"
+#include "shared/metaball-field.h"
 #include "shared/utility.h" // DemoHelper::LoadTexture
 
 using namespace Dali;
@@ -39,6 +44,11 @@ const float       GRAVITY_Y(-0.09);
 // number of metaballs
 constexpr uint32_t METABALL_NUMBER = 6;
 
+const uint32_t BENCHMARK_PHASE_TIME(4000u); // milliseconds recorded while pressing, then after releasing
+
+bool     gField(false);
+uint32_t gFboScale(1u);
+
 // clang-format off
 
 /**
@@ -104,6 +114,46 @@ const char* const METABALL_FRAG_SHADER = DALI_COMPOSE_SHADER (
   }\n
 );
 
+/**
+ * Fragment shader for the field of all the metaballs at once, prefixed by MetaballField::GetShaderPrefix()
+ */
+const char* const METABALL_FIELD_FRAG_SHADER = DALI_COMPOSE_SHADER (
+  precision mediump float;\n
+  varying vec2 vTexCoord;\n
+  uniform vec4 uMetaballs[METABALL_COUNT];\n
+  uniform float uAspect;\n
+  void main()\n
+  {\n
+    vec2 adjustedCoords = vTexCoord * 2.0 - 1.0;\n
+    float color = 0.0;\n
+    for (int i = 0; i < METABALL_COUNT; i++)\n
+    {\n
+      vec2 distanceVec = adjustedCoords - uMetaballs[i].xy;\n
+      color += uMetaballs[i].z * inversesqrt(dot(distanceVec, distanceVec));\n
+    }\n
+    vec2 bordercolor = vec2(0.0,0.0);\n
+    if (vTexCoord.x < 0.1)\n
+    {\n
+      bordercolor.x = (0.1 - vTexCoord.x) * 0.8;\n
+    }\n
+    if (vTexCoord.x > 0.9)\n
+    {\n
+      bordercolor.x = (vTexCoord.x - 0.9) * 0.8;\n
+    }\n
+    if (vTexCoord.y < 0.1)\n
+    {\n
+      bordercolor.y = (0.1 - vTexCoord.y) * 0.8;\n
+    }\n
+    if (vTexCoord.y > (0.9 * uAspect))\n
+    {\n
+      bordercolor.y = (vTexCoord.y - (0.9 * uAspect)) * 0.8;\n
+    }\n
+    // every ball drawn on its own adds the border
+    float border = (bordercolor.x + bordercolor.y) * 0.5 * float(METABALL_COUNT);\n
+    gl_FragColor = vec4(color + border,color + border,color + border,1.0);\n
+  }\n
+);
+
 /**
  * Fragment shader code for metaball and background composition with refraction effect
  */
@@ -155,7 +205,7 @@ const char* const FRAG_SHADER = DALI_COMPOSE_SHADER (
  */
 struct MetaballInfo
 {
-  Actor   actor;
+  Handle  handle; ///< The actor drawing the ball, or the handle of its properties with --field
   Vector2 position;
   float   radius;
   float   initRadius;
@@ -175,6 +225,12 @@ struct MetaballInfo
  * Demo using Metaballs
  *
  * When the metaball is clicked it starts to grow and fuses into the closest edge of screen
+ *
+ * With --field, a single actor evaluates the field of all the metaballs, packed in one uniform array, instead of an
+ * actor per ball; --fbo-scale divides the resolution the field is rendered at. With --timing-output, it records the
+ * frame times while a press grows the metaball, then after its release, and quits, e.g.:
+ *
+ * ./metaball-refrac.example --sweep=field=0,1 --sweep=fboScale=1,2,4
  */
 class MetaballRefracController : public ConnectionTracker
 {
@@ -182,8 +238,9 @@ public:
   /**
    * Constructor
    * @param application
+   * @param harness Records the frame times of a press and release, if given
    */
-  MetaballRefracController(Application& application);
+  MetaballRefracController(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr);
 
   /**
    * Destructor
@@ -205,9 +262,15 @@ public:
    */
   void OnKeyEvent(const KeyEvent& event);
 
+  /**
+   * Releases the press of the benchmark, then ends it
+   */
+  bool OnBenchmarkTick();
+
 private: // Data
-  Application& mApplication;
-  Vector2      mScreenSize;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness* mHarness;
+  Vector2                       mScreenSize;
 
   Texture     mBackgroundTexture;
   FrameBuffer mMetaballFBO;
@@ -241,6 +304,9 @@ private: // Data
   Animation mRadiusVarAnimation[METABALL_NUMBER];
   Animation mPositionVarAnimation[METABALL_NUMBER];
 
+  Timer    mBenchmarkTimer;
+  uint32_t mBenchmarkStep;
+
   // Private Helper functions
 
   /**
@@ -298,14 +364,23 @@ private: // Data
    * Function to set the actual position of the metaballs when the user clicks the screen
    */
   void SetPositionToMetaballs(const Vector2& metaballCenter);
+
+  /**
+   * Functions to start growing the metaballs at a position, move them and let them fall, when touched
+   */
+  void Press(const Vector2& screen);
+  void Move(const Vector2& screen);
+  void Release();
 };
 
 /**
  * Implementation
  */
 
-MetaballRefracController::MetaballRefracController(Application& application)
-: mApplication(application)
+MetaballRefracController::MetaballRefracController(Application& application, DemoHelper::BenchmarkHarness* harness)
+: mApplication(application),
+  mHarness(harness),
+  mBenchmarkStep(0u)
 {
   // Connect to the Application's Init signal
   mApplication.InitSignal().Connect(this, &MetaballRefracController::Create);
@@ -318,6 +393,8 @@ MetaballRefracController::~MetaballRefracController()
 
 void MetaballRefracController::Create(Application& app)
 {
+  DemoHelper::StartExample(app);
+
   Window window = app.GetWindow();
 
   window.KeyEventSignal().Connect(this, &MetaballRefracController::OnKeyEvent);
@@ -339,6 +416,19 @@ void MetaballRefracController::Create(Application& app)
 
   // Connect the callback to the touch signal on the mesh actor
   window.GetRootLayer().TouchedSignal().Connect(this, &MetaballRefracController::OnTouch);
+
+  if(mHarness)
+  {
+    mHarness->StartRecording(window.GetRootLayer());
+  }
+  if(mHarness && mHarness->IsRecording())
+  {
+    mHarness->StartPhase("press");
+    Press(mScreenSize * 0.5f);
+    mBenchmarkTimer = Timer::New(BENCHMARK_PHASE_TIME);
+    mBenchmarkTimer.TickSignal().Connect(this, &MetaballRefracController::OnBenchmarkTick);
+    mBenchmarkTimer.Start();
+  }
 }
 
 Geometry MetaballRefracController::CreateGeometry(bool aspectMappedTexture)
@@ -405,14 +495,26 @@ void MetaballRefracController::CreateMetaballActors()
   const float aspect = mScreenSize.y / mScreenSize.x;
 
   // Create the renderer for the metaballs
-  Shader   shader           = Shader::New(METABALL_VERTEX_SHADER, METABALL_FRAG_SHADER, Shader::Hint::MODIFIES_GEOMETRY);
+  Shader shader;
+  if(gField)
+  {
+    shader = Shader::New(METABALL_VERTEX_SHADER, DemoHelper::MetaballField::GetShaderPrefix(METABALL_NUMBER) + METABALL_FIELD_FRAG_SHADER, Shader::Hint::MODIFIES_GEOMETRY);
+  }
+  else
+  {
+    shader = Shader::New(METABALL_VERTEX_SHADER, METABALL_FRAG_SHADER, Shader::Hint::MODIFIES_GEOMETRY);
+  }
   Geometry metaballGeometry = CreateGeometry();
   Renderer renderer         = Renderer::New(metaballGeometry, shader);
-  renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_RGB, BlendFactor::ONE);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_RGB, BlendFactor::ONE);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_ALPHA, BlendFactor::ONE);
-  renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_ALPHA, BlendFactor::ONE);
+  if(!gField)
+  {
+    // The fields of the balls add up
+    renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_RGB, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_RGB, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_SRC_ALPHA, BlendFactor::ONE);
+    renderer.SetProperty(Renderer::Property::BLEND_FACTOR_DEST_ALPHA, BlendFactor::ONE);
+  }
 
   // Each metaball has a different radius
   mMetaballs[0].radius = mMetaballs[0].initRadius = 0.0145f;
@@ -420,40 +522,65 @@ void MetaballRefracController::CreateMetaballActors()
   mMetaballs[2].radius = mMetaballs[2].initRadius = 0.0135f;
   mMetaballs[3].radius = mMetaballs[3].initRadius = 0.0135f;
 
+  //Root creation
+  mMetaballRoot = Actor::New();
+  mMetaballRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+
+  // With --field, one actor draws the field of all the metaballs, whose properties are on handles of their own
+  Actor           field;
+  Property::Index fieldAspectIndex = Property::INVALID_INDEX;
+  if(gField)
+  {
+    field = Actor::New();
+    field.SetProperty(Dali::Actor::Property::NAME, "MetaballField");
+    field.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    field.AddRenderer(renderer);
+    fieldAspectIndex = field.RegisterProperty("uAspect", aspect);
+    mMetaballRoot.Add(field);
+  }
+
   // Initialization of each of the metaballs
   for(uint32_t i = 0; i < METABALL_NUMBER; i++)
   {
     mMetaballs[i].position = Vector2(0.0f, 0.0f);
 
-    mMetaballs[i].actor = Actor::New();
-    mMetaballs[i].actor.SetProperty(Dali::Actor::Property::NAME, "Metaball");
-    mMetaballs[i].actor.SetProperty(Actor::Property::SCALE, 1.0f);
-    mMetaballs[i].actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-
-    mMetaballs[i].actor.AddRenderer(renderer);
+    if(gField)
+    {
+      mMetaballs[i].handle      = Handle::New();
+      mMetaballs[i].aspectIndex = fieldAspectIndex;
+    }
+    else
+    {
+      Actor actor = Actor::New();
+      actor.SetProperty(Dali::Actor::Property::NAME, "Metaball");
+      actor.SetProperty(Actor::Property::SCALE, 1.0f);
+      actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+      actor.AddRenderer(renderer);
+      mMetaballRoot.Add(actor);
+
+      mMetaballs[i].handle      = actor;
+      mMetaballs[i].aspectIndex = actor.RegisterProperty("uAspect", aspect);
+    }
 
-    mMetaballs[i].positionIndex    = mMetaballs[i].actor.RegisterProperty("uPositionMetaball", mMetaballs[i].position);
-    mMetaballs[i].positionVarIndex = mMetaballs[i].actor.RegisterProperty("uPositionVar", Vector2(0.f, 0.f));
-    mMetaballs[i].gravityIndex     = mMetaballs[i].actor.RegisterProperty("uGravityVector", Vector2(0.f, 0.f));
-    mMetaballs[i].radiusIndex      = mMetaballs[i].actor.RegisterProperty("uRadius", mMetaballs[i].radius);
-    mMetaballs[i].radiusVarIndex   = mMetaballs[i].actor.RegisterProperty("uRadiusVar", 0.f);
-    mMetaballs[i].aspectIndex      = mMetaballs[i].actor.RegisterProperty("uAspect", aspect);
-  }
+    mMetaballs[i].positionIndex    = mMetaballs[i].handle.RegisterProperty("uPositionMetaball", mMetaballs[i].position);
+    mMetaballs[i].positionVarIndex = mMetaballs[i].handle.RegisterProperty("uPositionVar", Vector2(0.f, 0.f));
+    mMetaballs[i].gravityIndex     = mMetaballs[i].handle.RegisterProperty("uGravityVector", Vector2(0.f, 0.f));
+    mMetaballs[i].radiusIndex      = mMetaballs[i].handle.RegisterProperty("uRadius", mMetaballs[i].radius);
+    mMetaballs[i].radiusVarIndex   = mMetaballs[i].handle.RegisterProperty("uRadiusVar", 0.f);
 
-  //Root creation
-  mMetaballRoot = Actor::New();
-  mMetaballRoot.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
-  {
-    mMetaballRoot.Add(mMetaballs[i].actor);
+    if(gField)
+    {
+      DemoHelper::MetaballField::AddBall(field, i, mMetaballs[i].handle, {mMetaballs[i].positionIndex, mMetaballs[i].positionVarIndex, mMetaballs[i].gravityIndex, mMetaballs[i].radiusIndex, mMetaballs[i].radiusVarIndex});
+    }
   }
 }
 
 void MetaballRefracController::CreateMetaballImage()
 {
   // Create an FBO and a render task to create to render the metaballs with a fragment shader
+  // The composition samples it filtered, so it can be smaller than the screen
   Window window = mApplication.GetWindow();
-  mMetaballFBO  = FrameBuffer::New(mScreenSize.x, mScreenSize.y);
+  mMetaballFBO  = FrameBuffer::New(static_cast<uint32_t>(mScreenSize.x) / gFboScale, static_cast<uint32_t>(mScreenSize.y) / gFboScale);
 
   window.Add(mMetaballRoot);
 
@@ -522,7 +649,7 @@ void MetaballRefracController::CreateAnimations()
   }
 
   mPositionVarAnimation[2] = Animation::New(6.f);
-  mPositionVarAnimation[2].AnimateBetween(Property(mMetaballs[2].actor, mMetaballs[2].positionVarIndex), keySinCosVariation);
+  mPositionVarAnimation[2].AnimateBetween(Property(mMetaballs[2].handle, mMetaballs[2].positionVarIndex), keySinCosVariation);
   mPositionVarAnimation[2].SetLooping(true);
   mPositionVarAnimation[2].Pause();
 
@@ -537,7 +664,7 @@ void MetaballRefracController::CreateAnimations()
   }
 
   mPositionVarAnimation[3] = Animation::New(6.f);
-  mPositionVarAnimation[3].AnimateBetween(Property(mMetaballs[3].actor, mMetaballs[3].positionVarIndex), keyCosSinVariation);
+  mPositionVarAnimation[3].AnimateBetween(Property(mMetaballs[3].handle, mMetaballs[3].positionVarIndex), keyCosSinVariation);
   mPositionVarAnimation[3].SetLooping(true);
   mPositionVarAnimation[3].Pause();
 
@@ -545,7 +672,7 @@ void MetaballRefracController::CreateAnimations()
   for(i = 0; i < METABALL_NUMBER; i++)
   {
     mGravityAnimation[i] = Animation::New(25.f);
-    mGravityAnimation[i].AnimateBy(Property(mMetaballs[i].actor, mMetaballs[i].gravityIndex), mGravity * 25.f * 3.f);
+    mGravityAnimation[i].AnimateBy(Property(mMetaballs[i].handle, mMetaballs[i].gravityIndex), mGravity * 25.f * 3.f);
     mGravityAnimation[i].SetLooping(false);
     mGravityAnimation[i].Pause();
   }
@@ -554,7 +681,7 @@ void MetaballRefracController::CreateAnimations()
   for(i = 0; i < METABALL_NUMBER; i++)
   {
     mRadiusDecAnimation[i] = Animation::New(25.f);
-    mRadiusDecAnimation[i].AnimateBy(Property(mMetaballs[i].actor, mMetaballs[i].radiusIndex), -0.004f * 25.f * 3.f);
+    mRadiusDecAnimation[i].AnimateBy(Property(mMetaballs[i].handle, mMetaballs[i].radiusIndex), -0.004f * 25.f * 3.f);
     mRadiusDecAnimation[i].SetLooping(false);
     mRadiusDecAnimation[i].Pause();
   }
@@ -563,7 +690,7 @@ void MetaballRefracController::CreateAnimations()
   for(i = 0; i < METABALL_NUMBER; i++)
   {
     mRadiusIncFastAnimation[i] = Animation::New(0.3f);
-    mRadiusIncFastAnimation[i].AnimateBy(Property(mMetaballs[i].actor, mMetaballs[i].radiusIndex), 0.06f);
+    mRadiusIncFastAnimation[i].AnimateBy(Property(mMetaballs[i].handle, mMetaballs[i].radiusIndex), 0.06f);
     mRadiusIncFastAnimation[i].SetLooping(false);
     mRadiusIncFastAnimation[i].Pause();
   }
@@ -573,7 +700,7 @@ void MetaballRefracController::CreateAnimations()
   for(i = 0; i < METABALL_NUMBER; i++)
   {
     mRadiusIncSlowAnimation[i] = Animation::New(20.f);
-    mRadiusIncSlowAnimation[i].AnimateBy(Property(mMetaballs[i].actor, mMetaballs[i].radiusIndex), 0.04f);
+    mRadiusIncSlowAnimation[i].AnimateBy(Property(mMetaballs[i].handle, mMetaballs[i].radiusIndex), 0.04f);
     mRadiusIncSlowAnimation[i].SetLooping(false);
     mRadiusIncSlowAnimation[i].Pause();
   }
@@ -590,7 +717,7 @@ void MetaballRefracController::CreateAnimations()
 
   //Animation to change the size of the metaball
   mRadiusVarAnimation[2] = Animation::New(8.f);
-  mRadiusVarAnimation[2].AnimateBetween(Property(mMetaballs[2].actor, mMetaballs[2].radiusVarIndex), keySin);
+  mRadiusVarAnimation[2].AnimateBetween(Property(mMetaballs[2].handle, mMetaballs[2].radiusVarIndex), keySin);
   mRadiusVarAnimation[2].SetLooping(true);
 
   // Keyframes of a cos function
@@ -604,7 +731,7 @@ void MetaballRefracController::CreateAnimations()
 
   //Animation to change the size of the metaball
   mRadiusVarAnimation[3] = Animation::New(8.f);
-  mRadiusVarAnimation[3].AnimateBetween(Property(mMetaballs[3].actor, mMetaballs[3].radiusVarIndex), keyCos);
+  mRadiusVarAnimation[3].AnimateBetween(Property(mMetaballs[3].handle, mMetaballs[3].radiusVarIndex), keyCos);
   mRadiusVarAnimation[3].SetLooping(true);
 }
 
@@ -614,7 +741,7 @@ void MetaballRefracController::LaunchGetBackToPositionAnimation(Animation& sourc
 
   mPositionVarAnimation[1] = Animation::New(1.f);
   mPositionVarAnimation[1].SetLooping(false);
-  mPositionVarAnimation[1].AnimateTo(Property(mMetaballs[1].actor, mMetaballs[1].positionVarIndex), Vector2(0, 0));
+  mPositionVarAnimation[1].AnimateTo(Property(mMetaballs[1].handle, mMetaballs[1].positionVarIndex), Vector2(0, 0));
   mPositionVarAnimation[1].Play();
 }
 
@@ -649,9 +776,9 @@ void MetaballRefracController::StopAfterClickAnimations()
 
     mMetaballs[i].radius = mMetaballs[i].initRadius;
 
-    mMetaballs[i].actor.SetProperty(mMetaballs[i].gravityIndex, Vector2(0, 0));
-    mMetaballs[i].actor.SetProperty(mMetaballs[i].radiusIndex, mMetaballs[i].radius);
-    mMetaballs[i].actor.SetProperty(mMetaballs[i].radiusVarIndex, 0.f);
+    mMetaballs[i].handle.SetProperty(mMetaballs[i].gravityIndex, Vector2(0, 0));
+    mMetaballs[i].handle.SetProperty(mMetaballs[i].radiusIndex, mMetaballs[i].radius);
+    mMetaballs[i].handle.SetProperty(mMetaballs[i].radiusVarIndex, 0.f);
   }
   mRadiusVarAnimation[2].Stop();
   mRadiusVarAnimation[3].Stop();
@@ -679,81 +806,97 @@ void MetaballRefracController::SetPositionToMetaballs(const Vector2& metaballCen
   for(uint32_t i = 0; i < METABALL_NUMBER; i++)
   {
     mMetaballs[i].position = metaballCenter;
-    mMetaballs[i].actor.SetProperty(mMetaballs[i].positionIndex, mMetaballs[i].position);
+    mMetaballs[i].handle.SetProperty(mMetaballs[i].positionIndex, mMetaballs[i].position);
   }
 }
 
-bool MetaballRefracController::OnTouch(Actor actor, const TouchEvent& touch)
+void MetaballRefracController::Press(const Vector2& screen)
 {
   const float aspect = mScreenSize.y / mScreenSize.x;
+
+  StopAfterClickAnimations();
+  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  {
+    mRadiusIncFastAnimation[i].Play();
+  }
+  mRadiusVarAnimation[2].Play();
+  mRadiusVarAnimation[3].Play();
+
+  //We draw with the refraction-composition shader
+  mRendererRefraction.SetTextures(mTextureSetRefraction);
+  mRendererRefraction.SetShader(mShaderRefraction);
+  mCurrentTouchPosition = screen;
+
+  //we use the click position for the metaballs
+  Vector2 metaballCenter = Vector2((mCurrentTouchPosition.x / mScreenSize.x) - 0.5f,
+                                   (aspect * (mScreenSize.y - mCurrentTouchPosition.y) / mScreenSize.y) - 0.5f) *
+                           2.0f;
+  SetPositionToMetaballs(metaballCenter);
+}
+
+void MetaballRefracController::Move(const Vector2& screen)
+{
+  const float aspect       = mScreenSize.y / mScreenSize.x;
+  Vector2     displacement = screen - mCurrentTouchPosition;
+  mCurrentTouchPosition    = screen;
+
+  mMetaballPosVariationTo.x += (displacement.x / mScreenSize.x) * 2.2f;
+  mMetaballPosVariationTo.y += (-displacement.y / mScreenSize.y) * 2.2f;
+
+  if(mPositionVarAnimation[1])
+  {
+    mPositionVarAnimation[1].FinishedSignal().Disconnect(this, &MetaballRefracController::LaunchGetBackToPositionAnimation);
+    mPositionVarAnimation[1].Stop();
+  }
+  mPositionVarAnimation[1] = Animation::New(1.f);
+  mPositionVarAnimation[1].SetLooping(false);
+  mPositionVarAnimation[1].AnimateTo(Property(mMetaballs[1].handle, mMetaballs[1].positionVarIndex), mMetaballPosVariationTo);
+  mPositionVarAnimation[1].FinishedSignal().Connect(this, &MetaballRefracController::LaunchGetBackToPositionAnimation);
+  mPositionVarAnimation[1].Play();
+
+  //we use the click position for the metaballs
+  Vector2 metaballCenter = Vector2((screen.x / mScreenSize.x) - 0.5f,
+                                   (aspect * (mScreenSize.y - screen.y) / mScreenSize.y) - 0.5f) *
+                           2.0f;
+  SetPositionToMetaballs(metaballCenter);
+}
+
+void MetaballRefracController::Release()
+{
+  //Stop click animations
+  StopClickAnimations();
+
+  //Launch out of screen animations
+  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  {
+    mGravityAnimation[i].Play();
+  }
+
+  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  {
+    mRadiusDecAnimation[i].Play();
+  }
+}
+
+bool MetaballRefracController::OnTouch(Actor actor, const TouchEvent& touch)
+{
   switch(touch.GetState(0))
   {
     case PointState::DOWN:
     {
-      StopAfterClickAnimations();
-      for(uint32_t i = 0; i < METABALL_NUMBER; i++)
-      {
-        mRadiusIncFastAnimation[i].Play();
-      }
-      mRadiusVarAnimation[2].Play();
-      mRadiusVarAnimation[3].Play();
-
-      //We draw with the refraction-composition shader
-      mRendererRefraction.SetTextures(mTextureSetRefraction);
-      mRendererRefraction.SetShader(mShaderRefraction);
-      mCurrentTouchPosition = touch.GetScreenPosition(0);
-
-      //we use the click position for the metaballs
-      Vector2 metaballCenter = Vector2((mCurrentTouchPosition.x / mScreenSize.x) - 0.5f,
-                                       (aspect * (mScreenSize.y - mCurrentTouchPosition.y) / mScreenSize.y) - 0.5f) *
-                               2.0f;
-      SetPositionToMetaballs(metaballCenter);
+      Press(touch.GetScreenPosition(0));
       break;
     }
     case PointState::MOTION:
     {
-      Vector2 screen        = touch.GetScreenPosition(0);
-      Vector2 displacement  = screen - mCurrentTouchPosition;
-      mCurrentTouchPosition = screen;
-
-      mMetaballPosVariationTo.x += (displacement.x / mScreenSize.x) * 2.2f;
-      mMetaballPosVariationTo.y += (-displacement.y / mScreenSize.y) * 2.2f;
-
-      if(mPositionVarAnimation[1])
-      {
-        mPositionVarAnimation[1].FinishedSignal().Disconnect(this, &MetaballRefracController::LaunchGetBackToPositionAnimation);
-        mPositionVarAnimation[1].Stop();
-      }
-      mPositionVarAnimation[1] = Animation::New(1.f);
-      mPositionVarAnimation[1].SetLooping(false);
-      mPositionVarAnimation[1].AnimateTo(Property(mMetaballs[1].actor, mMetaballs[1].positionVarIndex), mMetaballPosVariationTo);
-      mPositionVarAnimation[1].FinishedSignal().Connect(this, &MetaballRefracController::LaunchGetBackToPositionAnimation);
-      mPositionVarAnimation[1].Play();
-
-      //we use the click position for the metaballs
-      Vector2 metaballCenter = Vector2((screen.x / mScreenSize.x) - 0.5f,
-                                       (aspect * (mScreenSize.y - screen.y) / mScreenSize.y) - 0.5f) *
-                               2.0f;
-      SetPositionToMetaballs(metaballCenter);
+      Move(touch.GetScreenPosition(0));
       break;
     }
     case PointState::UP:
     case PointState::LEAVE:
     case PointState::INTERRUPTED:
     {
-      //Stop click animations
-      StopClickAnimations();
-
-      //Launch out of screen animations
-      for(uint32_t i = 0; i < METABALL_NUMBER; i++)
-      {
-        mGravityAnimation[i].Play();
-      }
-
-      for(uint32_t i = 0; i < METABALL_NUMBER; i++)
-      {
-        mRadiusDecAnimation[i].Play();
-      }
+      Release();
       break;
     }
     default:
@@ -762,6 +905,20 @@ bool MetaballRefracController::OnTouch(Actor actor, const TouchEvent& touch)
   return true;
 }
 
+bool MetaballRefracController::OnBenchmarkTick()
+{
+  if(mBenchmarkStep++ == 0u)
+  {
+    mHarness->StartPhase("release");
+    Release();
+    return true;
+  }
+
+  mHarness->FinishRecording();
+  mApplication.Quit();
+  return false;
+}
+
 void MetaballRefracController::OnKeyEvent(const KeyEvent& event)
 {
   if(event.GetState() == KeyEvent::DOWN)
@@ -778,9 +935,34 @@ void MetaballRefracController::OnKeyEvent(const KeyEvent& event)
  */
 int32_t DALI_EXPORT_API main(int argc, char** argv)
 {
+  DemoHelper::BenchmarkHarness harness("metaball-refrac", "metaball-refrac.example");
+  harness.AddFlag("field", "--field", "Evaluates the field of all the metaballs in a single pass", gField);
+  harness.AddOption("fboScale", "--fbo-scale=", "Divides the resolution the metaballs are rendered at: 1, 2 or 4", gFboScale);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(gFboScale != 1u && gFboScale != 2u && gFboScale != 4u)
+  {
+    std::cerr << "The scale of the frame buffer must be 1, 2 or 4" << std::endl;
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
   Application application = Application::New(&argc, &argv);
 
-  MetaballRefracController test(application);
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  MetaballRefracController test(application, &harness);
   application.MainLoop();
 
   return 0;
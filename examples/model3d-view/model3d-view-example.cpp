@@ -16,6 +16,8 @@
  */
 
 #include <dali-toolkit/dali-toolkit.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using Dali::Toolkit::Model3dView;
@@ -77,6 +79,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window  window     = application.GetWindow();
     Vector2 screenSize = window.GetSize();
@@ -291,6 +295,7 @@ private:
   bool mScaled;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application           application = Application::New(&argc, &argv);
@@ -298,3 +303,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(Model3dViewController)
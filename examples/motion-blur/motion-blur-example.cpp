@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/shader-effects/motion-blur-effect.h>
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -142,6 +144,8 @@ public:
    */
   void OnInit(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     // The Init signal is received once (only) during the Application lifetime
     Window window = app.GetWindow();
 
@@ -448,6 +452,7 @@ private:
   Animation         mRotateAnimation; ///< Animation for rotating between landscape and portrait.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application          app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -455,3 +460,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(MotionBlurExampleApp)
@@ -22,6 +22,8 @@
 #include <dali-toolkit/devel-api/shader-effects/motion-stretch-effect.h>
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -120,6 +122,8 @@ public:
    */
   void OnInit(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     // The Init signal is received once (only) during the Application lifetime
     Window window = app.GetWindow();
 
@@ -420,6 +424,7 @@ private:
   Animation         mRotateAnimation; ///< Animation for rotating between landscape and portrait.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application             app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -427,3 +432,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(MotionStretchExampleApp)
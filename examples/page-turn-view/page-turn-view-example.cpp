@@ -21,6 +21,8 @@
 #include <dali-toolkit/devel-api/controls/page-turn-view/page-turn-portrait-view.h>
 #include <dali-toolkit/devel-api/controls/page-turn-view/page-turn-view.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -196,6 +198,8 @@ PageTurnExample::~PageTurnExample()
  */
 void PageTurnExample::OnInit(Application& app)
 {
+  DemoHelper::StartExample(app);
+
   Window window = app.GetWindow();
   window.KeyEventSignal().Connect(this, &PageTurnExample::OnKeyEvent);
 
@@ -269,6 +273,7 @@ void PageTurnExample::OnKeyEvent(const KeyEvent& event)
   }
 }
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 // Entry point for applications
 int DALI_EXPORT_API main(int argc, char** argv)
 {
@@ -279,3 +284,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(PageTurnExample)
@@ -20,6 +20,8 @@
 #include <dali/devel-api/actors/actor-devel.h>
 
 #include <iostream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -63,6 +65,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
@@ -148,6 +152,7 @@ private:
   TapGestureDetector mTapDetector; ///< Used for animating the tapped control.
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application     application = Application::New(&argc, &argv);
@@ -155,3 +160,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(PivotController)
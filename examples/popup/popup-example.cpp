@@ -19,6 +19,8 @@
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -108,6 +110,8 @@ public:
 
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // The Init signal is received once (only) during the Application lifetime
     Window window = application.GetWindow();
 
@@ -724,6 +728,7 @@ private:
   Toolkit::ItemView mItemView; ///< ItemView to hold test images
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application  application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -731,3 +736,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(PopupExample)
@@ -18,6 +18,8 @@
 #include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali/devel-api/adaptor-framework/application-devel.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali::Toolkit;
 
@@ -88,6 +90,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     mWindow = application.GetWindow();
     mWindow.SetBackgroundColor(Color::WHITE);
     mWindow.KeyEventSignal().Connect(this, &PreRenderCallbackController::OnKeyEvent);
@@ -247,6 +251,7 @@ private:
 
 } // namespace Dali
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Dali::Application                 application = Dali::Application::New(&argc, &argv);
@@ -254,3 +259,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(Dali::PreRenderCallbackController)
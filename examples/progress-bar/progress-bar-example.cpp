@@ -18,6 +18,8 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/progress-bar/progress-bar-devel.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -62,6 +64,8 @@ public:
 private:
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // The Init signal is received once (only) during the Application lifetime
 
     // Respond to key events
@@ -259,6 +263,7 @@ private:
   bool                isDefaultTheme;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application        application = Application::New(&argc, &argv);
@@ -266,3 +271,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ProgressBarExample)
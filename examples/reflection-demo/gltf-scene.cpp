@@ -19,7 +19,13 @@
 #include "gltf-scene.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/file-stream.h>
+#include <errno.h>
+#include <algorithm>
+#include <string.h>
+
+// INTERNAL INCLUDES
+#include "shared/base64.h"
+#include "shared/json-reader.h"
 
 namespace
 {
@@ -35,7 +41,7 @@ const std::vector<std::pair<std::string, uint32_t>> GLTF_STR_COMPONENT_TYPE = {
   std::make_pair("VEC4", 4),
   std::make_pair("SCALAR", 1)};
 
-glTFAttributeType glTFAttributeTypeStrToEnum(const std::string& name)
+glTFAttributeType glTFAttributeTypeStrToEnum(std::string_view name)
 {
   int  index = -1;
   auto iter  = std::find_if(GLTF_STR_ATTRIBUTE_TYPE.begin(), GLTF_STR_ATTRIBUTE_TYPE.end(), [name, &index](const std::string& val) {
@@ -50,7 +56,7 @@ glTFAttributeType glTFAttributeTypeStrToEnum(const std::string& name)
   return static_cast<glTFAttributeType>(index);
 }
 
-uint32_t glTFComponentTypeStrToNum(const std::string& name)
+uint32_t glTFComponentTypeStrToNum(std::string_view name)
 {
   auto iter = std::find_if(GLTF_STR_COMPONENT_TYPE.begin(), GLTF_STR_COMPONENT_TYPE.end(), [name](const std::pair<std::string, uint32_t>& val) {
     return val.first == name;
@@ -63,82 +69,94 @@ uint32_t glTFComponentTypeStrToNum(const std::string& name)
   return iter->second;
 }
 
-template<class T>
-struct JsonResult
-{
-  bool success;
-  T    result;
-  operator T() const
-  {
-    return static_cast<T>(result);
-  }
-};
+const std::string GLTF_EXTENSION  = ".gltf";
+const std::string GLB_EXTENSION   = ".glb";
+const std::string BIN_EXTENSION   = ".bin";
+const std::string DATA_URI_PREFIX = "data:";
+const std::string DATA_URI_BASE64 = ";base64,";
 
-template<>
-struct JsonResult<bool>
-{
-  bool success;
-  bool result;
+// GLB container, see https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#binary-gltf-layout
+const uint32_t GLB_MAGIC           = 0x46546C67; // "glTF"
+const uint32_t GLB_VERSION         = 2u;
+const uint32_t GLB_CHUNK_TYPE_JSON = 0x4E4F534A; // "JSON"
+const uint32_t GLB_CHUNK_TYPE_BIN  = 0x004E4942; // "BIN\0"
 
-  operator bool() const
-  {
-    return result;
-  }
+struct GlbHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t length;
 };
 
-template<class Expected, class Converted = Expected>
-JsonResult<picojson::value> JsonFindValue(const picojson::object& object, const std::string& name)
+struct GlbChunkHeader
 {
-  auto iter = find_if(object.begin(), object.end(), [name](decltype(*object.begin())& item) {
-    return item.first == name;
-  });
-
-  if(iter == object.end())
-  {
-    return {false};
-  }
-
-  return {true, iter->second};
+  uint32_t length;
+  uint32_t type;
 };
 
-template<class Expected, class Converted = Expected>
-JsonResult<Converted> JsonGetValue(const picojson::value& val, const std::string& name, const Converted& onFail)
+bool EndsWith(const std::string& text, const std::string& suffix)
 {
-  if(val.contains(name))
-  {
-    return {true, static_cast<Converted>(val.get(name).get<Expected>())};
-  }
-  return {false, onFail};
+  return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
 
-template<class Expected, class Converted = Expected>
-bool JsonGetValueOut(const picojson::value& val, const std::string& name, Converted& writeOut)
+/**
+ * Calls readElement for each element of the array at the reader, which must consume it
+ */
+template<class F>
+bool ForEachElement(DemoHelper::JsonReader& reader, F&& readElement)
 {
-  if(val.contains(name))
+  if(!reader.EnterArray())
+  {
+    return false;
+  }
+  while(reader.NextElement())
   {
-    writeOut = static_cast<Converted>(val.get(name).get<Expected>());
-    return true;
+    if(!readElement())
+    {
+      return false;
+    }
   }
-  return false;
+  return !reader.HasError();
 }
 
 /**
- * Safe json value accessor
+ * Calls readMember with the key of each member of the object at the reader, which must consume its value
  */
-template<class Expected, class Converted = Expected>
-JsonResult<std::vector<Converted>> JsonGetArray(const picojson::value& val, const std::string& name, std::vector<Converted> valueOnFail = {})
+template<class F>
+bool ForEachMember(DemoHelper::JsonReader& reader, F&& readMember)
 {
-  if(val.contains(name))
+  if(!reader.EnterObject())
   {
-    const auto&            array = val.get(name).get<picojson::array>();
-    std::vector<Converted> result{};
-    for(const auto& item : array)
+    return false;
+  }
+  for(std::string_view key; reader.NextMember(key);)
+  {
+    if(!readMember(key))
     {
-      result.emplace_back(static_cast<Converted>(item.get<Expected>()));
+      return false;
     }
-    return {true, result};
   }
-  return {false, valueOnFail};
+  return !reader.HasError();
+}
+
+/**
+ * Reads up to count numbers into values, any further ones are ignored
+ */
+bool ReadFloatArray(DemoHelper::JsonReader& reader, float* values, uint32_t count)
+{
+  uint32_t index = 0u;
+  return ForEachElement(reader, [&]() {
+    return (index < count) ? reader.ReadNumber(values[index++]) : reader.Skip();
+  });
+}
+
+bool ReadIndexArray(DemoHelper::JsonReader& reader, std::vector<uint32_t>& values)
+{
+  values.clear();
+  return ForEachElement(reader, [&]() {
+    values.emplace_back();
+    return reader.ReadNumber(values.back());
+  });
 }
 
 } // namespace
@@ -146,65 +164,170 @@ JsonResult<std::vector<Converted>> JsonGetArray(const picojson::value& val, cons
 glTF::glTF(const std::string& filename)
 {
   LoadFromFile(filename);
-  ParseJSON();
 }
 
 void glTF::LoadFromFile(const std::string& filename)
 {
-  std::string jsonFile(filename);
-  jsonFile += ".gltf";
-  std::string binFile(filename);
-  binFile += ".bin";
+  if(EndsWith(filename, GLB_EXTENSION))
+  {
+    LoadFromBinaryFile(filename);
+    return;
+  }
 
-  // load binary
+  // a name without extension refers to a .gltf file
+  std::string jsonFile(filename);
+  if(!EndsWith(jsonFile, GLTF_EXTENSION))
+  {
+    jsonFile += GLTF_EXTENSION;
+  }
 
-  GLTF_LOG("LoadFromFile: %s", binFile.c_str());
-  mBuffer    = LoadFile(binFile);
-  jsonBuffer = LoadFile(jsonFile);
+  GLTF_LOG("LoadFromFile: %s", jsonFile.c_str());
 
-  // Log errors
-  if(mBuffer.empty())
+  // the json file is only kept in this scope, until the buffer it refers to is loaded
+  glTF_Buffer jsonBuffer = LoadFile(jsonFile);
+  if(jsonBuffer.IsEmpty())
   {
-    GLTF_LOG("Error, buffer empty!");
+    GLTF_LOG("Error, buffer GLTF empty!");
+    return;
   }
-  else
+
+  std::string_view bufferUri;
+  if(ParseJSON(jsonBuffer.GetData(), jsonBuffer.GetSize(), jsonFile, bufferUri))
   {
-    GLTF_LOG("GLTF[BIN]: %s loaded, size = %d", binFile.c_str(), int(mBuffer.size()));
+    LoadBuffer(jsonFile, bufferUri);
+    ResolveBufferViews();
   }
-  if(jsonBuffer.empty())
+}
+
+void glTF::LoadFromBinaryFile(const std::string& filename)
+{
+  GLTF_LOG("LoadFromBinaryFile: %s", filename.c_str());
+
+  // the whole container stays mapped, both chunks are used in place
+  mBuffer = LoadFile(filename);
+
+  GlbHeader header;
+  if(mBuffer.GetSize() < sizeof(header) + sizeof(GlbChunkHeader))
   {
-    GLTF_LOG("Error, buffer GLTF empty!");
+    GLTF_LOG("GLB: %s is too small, size = %d", filename.c_str(), int(mBuffer.GetSize()));
+    return;
   }
-  else
+
+  memcpy(&header, mBuffer.GetData(), sizeof(header));
+  if(header.magic != GLB_MAGIC || header.version != GLB_VERSION || header.length > mBuffer.GetSize())
   {
-    GLTF_LOG("GLTF: %s loaded, size = %d", binFile.c_str(), int(jsonBuffer.size()));
+    GLTF_LOG("GLB: %s has an invalid header", filename.c_str());
+    return;
   }
 
-  // Abort if errors
-  if(jsonBuffer.empty() || mBuffer.empty())
+  // first chunk must be JSON
+  size_t         offset = sizeof(header);
+  GlbChunkHeader jsonChunk;
+  memcpy(&jsonChunk, mBuffer.GetData() + offset, sizeof(jsonChunk));
+  offset += sizeof(jsonChunk);
+  if(jsonChunk.type != GLB_CHUNK_TYPE_JSON || offset + jsonChunk.length > header.length)
   {
+    GLTF_LOG("GLB: %s has no valid JSON chunk", filename.c_str());
     return;
   }
 
-  // parse json
-  auto err = picojson::parse(jsonNode, std::string(reinterpret_cast<char*>(jsonBuffer.data())));
-  if(!err.empty())
+  const uint8_t* jsonData = mBuffer.GetData() + offset;
+  offset += jsonChunk.length;
+
+  // optional second chunk holds the binary buffer
+  GlbChunkHeader binChunk;
+  if(offset + sizeof(binChunk) <= header.length)
+  {
+    memcpy(&binChunk, mBuffer.GetData() + offset, sizeof(binChunk));
+    offset += sizeof(binChunk);
+    if(binChunk.type == GLB_CHUNK_TYPE_BIN && offset + binChunk.length <= header.length)
+    {
+      mBinData = mBuffer.GetData() + offset;
+      mBinSize = binChunk.length;
+    }
+  }
+
+  std::string_view bufferUri;
+  if(ParseJSON(jsonData, jsonChunk.length, filename, bufferUri))
   {
-    GLTF_LOG("GLTF: Error parsing %s, error: %s", jsonFile.c_str(), err.c_str());
+    if(!mBinData)
+    {
+      // the buffer may still be referenced by uri
+      LoadBuffer(filename, bufferUri);
+    }
+    ResolveBufferViews();
+  }
+}
+
+void glTF::LoadBuffer(const std::string& filename, std::string_view uri)
+{
+  // the uri is used in place unless it has escaped characters, e.g. "\\/"
+  std::string unescapedUri;
+  if(uri.find('\\') != std::string_view::npos)
+  {
+    if(!DemoHelper::JsonReader::Unescape(uri, unescapedUri))
+    {
+      GLTF_LOG("GLTF: %s has an invalid buffer uri", filename.c_str());
+      return;
+    }
+    uri = unescapedUri;
+  }
+
+  if(uri.compare(0, DATA_URI_PREFIX.size(), DATA_URI_PREFIX) == 0)
+  {
+    // embedded buffer, decode base64 payload straight from the json string
+    const auto dataStart = uri.find(DATA_URI_BASE64);
+    if(dataStart == std::string_view::npos ||
+       !DemoHelper::Base64::DecodeBase64(uri.data() + dataStart + DATA_URI_BASE64.size(), uri.size() - dataStart - DATA_URI_BASE64.size(), mDecodedBuffer))
+    {
+      GLTF_LOG("GLTF: %s has an invalid data uri", filename.c_str());
+      return;
+    }
+
+    mBinData = mDecodedBuffer.data();
+    mBinSize = mDecodedBuffer.size();
+    GLTF_LOG("GLTF[BIN]: decoded from data uri, size = %d", int(mBinSize));
     return;
   }
+
+  // external buffer, relative to the .gltf file; fall back to the name of the .gltf file
+  std::string binFile;
+  if(!uri.empty())
+  {
+    const auto separator = filename.find_last_of("/\\");
+    binFile              = (separator == std::string::npos) ? std::string(uri) : filename.substr(0, separator + 1) + std::string(uri);
+  }
   else
   {
-    GLTF_LOG("GLTF: %s loaded, size = %d", jsonFile.c_str(), int(jsonBuffer.size()));
+    binFile = filename.substr(0, filename.find_last_of('.')) + BIN_EXTENSION;
+  }
+
+  mBuffer = LoadFile(binFile);
+  if(mBuffer.IsEmpty())
+  {
+    GLTF_LOG("Error, buffer empty!");
+    return;
   }
+
+  mBinData = mBuffer.GetData();
+  mBinSize = mBuffer.GetSize();
+  GLTF_LOG("GLTF[BIN]: %s loaded, size = %d, mapped = %d", binFile.c_str(), int(mBuffer.GetSize()), int(mBuffer.IsMapped()));
 }
 
-bool glTF::ParseJSON()
+void glTF::ResolveBufferViews()
 {
-  if(!jsonNode.is<picojson::object>())
+  // point straight into the loaded buffer
+  for(auto& bufferView : mBufferViews)
   {
-    return false;
+    bufferView.data = (size_t(bufferView.byteOffset) + bufferView.byteLength <= mBinSize) ? mBinData + bufferView.byteOffset : nullptr;
   }
+}
+
+bool glTF::ParseJSON(const uint8_t* data, size_t size, const std::string& filename, std::string_view& bufferUri)
+{
+  // the text is not null terminated, it's read in place
+  const char*            text = reinterpret_cast<const char*>(data);
+  DemoHelper::JsonReader reader(text, text + size);
 
   // Add dummy first node to nodes (scene node)
   mNodes.emplace_back();
@@ -213,220 +336,375 @@ bool glTF::ParseJSON()
   std::vector<uint32_t>     textureSources{};
   std::vector<glTF_Texture> images{};
 
-  for(auto& val : jsonNode.get<picojson::object>())
-  {
-    GLTF_LOG("node: %s", val.first.c_str());
+  bool success = ForEachMember(reader, [&](std::string_view key) {
+    GLTF_LOG("node: %.*s", int(key.size()), key.data());
 
-    // Parse bufferviews
-    if(val.first == "bufferViews")
+    // only the first buffer is supported
+    if(key == "buffers")
     {
-      auto bufferViews = val.second;
-      for(auto& view : bufferViews.get<picojson::array>())
-      {
-        auto bufferIndex = uint32_t(view.get("buffer").get<double>());
-        auto byteLength  = uint32_t(view.get("byteLength").get<double>());
-        auto byteOffset  = uint32_t(view.get("byteOffset").get<double>());
+      auto bufferIndex = 0u;
+      return ForEachElement(reader, [&]() {
+        if(bufferIndex++ != 0u)
+        {
+          return reader.Skip();
+        }
+        return ForEachMember(reader, [&](std::string_view member) {
+          return (member == "uri") ? reader.ReadString(bufferUri) : reader.Skip();
+        });
+      });
+    }
 
+    // Parse bufferviews
+    else if(key == "bufferViews")
+    {
+      return ForEachElement(reader, [&]() {
         glTF_BufferView bufferView{};
-        bufferView.bufferIndex = bufferIndex;
-        bufferView.byteLength  = byteLength;
-        bufferView.byteOffset  = byteOffset;
-
         mBufferViews.emplace_back(bufferView);
-      }
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& view = mBufferViews.back();
+          if(member == "buffer")
+          {
+            return reader.ReadNumber(view.bufferIndex);
+          }
+          else if(member == "byteLength")
+          {
+            return reader.ReadNumber(view.byteLength);
+          }
+          else if(member == "byteOffset")
+          {
+            return reader.ReadNumber(view.byteOffset);
+          }
+          else if(member == "byteStride")
+          {
+            return reader.ReadNumber(view.byteStride);
+          }
+          return reader.Skip();
+        });
+      });
     }
 
     // parse accessors
-    else if(val.first == "accessors")
+    else if(key == "accessors")
     {
-      for(const auto& accessor : val.second.get<picojson::array>())
-      {
-        auto gltfAccessor          = glTF_Accessor{};
-        gltfAccessor.bufferView    = uint32_t(accessor.get("bufferView").get<double>());
-        gltfAccessor.componentType = uint32_t(accessor.get("componentType").get<double>());
-        gltfAccessor.count         = uint32_t(accessor.get("count").get<double>());
-        gltfAccessor.type          = accessor.get("type").get<std::string>();
-        gltfAccessor.componentSize = glTFComponentTypeStrToNum(gltfAccessor.type);
-        mAccessors.emplace_back(gltfAccessor);
-      }
+      return ForEachElement(reader, [&]() {
+        mAccessors.emplace_back();
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& accessor = mAccessors.back();
+          if(member == "bufferView")
+          {
+            return reader.ReadNumber(accessor.bufferView);
+          }
+          else if(member == "byteOffset")
+          {
+            return reader.ReadNumber(accessor.byteOffset);
+          }
+          else if(member == "componentType")
+          {
+            return reader.ReadNumber(accessor.componentType);
+          }
+          else if(member == "count")
+          {
+            return reader.ReadNumber(accessor.count);
+          }
+          else if(member == "type")
+          {
+            std::string_view type;
+            if(!reader.ReadString(type))
+            {
+              return false;
+            }
+            accessor.type          = std::string(type);
+            accessor.componentSize = glTFComponentTypeStrToNum(type);
+            return true;
+          }
+          return reader.Skip();
+        });
+      });
     }
 
     // parse meshes
-    else if(val.first == "meshes")
+    else if(key == "meshes")
     {
-      for(const auto& mesh : val.second.get<picojson::array>())
-      {
+      return ForEachElement(reader, [&]() {
         glTF_Mesh gltfMesh{};
-        gltfMesh.name = mesh.get("name").get<std::string>();
-
-        // get primitives (in this implementation assuming single mesh consists of
-        // one and only one primitive)
-        const auto& primitive = mesh.get("primitives").get<picojson::array>()[0];
-        const auto& attrs     = primitive.get("attributes").get<picojson::object>();
-        for(const auto& attr : attrs)
-        {
-          auto type    = glTFAttributeTypeStrToEnum(attr.first);
-          auto bvIndex = uint32_t(attr.second.get<double>());
-          gltfMesh.attributes.emplace_back(std::make_pair(type, bvIndex));
-          GLTF_LOG("GLTF: ATTR: type: %d, index: %d", int(type), int(bvIndex));
-        }
-
-        gltfMesh.indices  = uint32_t(primitive.get("indices").get<double>());
-        gltfMesh.material = uint32_t(primitive.get("material").get<double>());
+        gltfMesh.indices  = 0xffffffff;
+        gltfMesh.material = 0xffffffff;
         mMeshes.emplace_back(gltfMesh);
-      }
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& mesh = mMeshes.back();
+          if(member == "name")
+          {
+            return reader.ReadString(mesh.name);
+          }
+          else if(member != "primitives")
+          {
+            return reader.Skip();
+          }
+
+          // in this implementation assuming single mesh consists of one and only one primitive
+          auto primitiveIndex = 0u;
+          return ForEachElement(reader, [&]() {
+            if(primitiveIndex++ != 0u)
+            {
+              return reader.Skip();
+            }
+            return ForEachMember(reader, [&](std::string_view primitiveMember) {
+              if(primitiveMember == "indices")
+              {
+                return reader.ReadNumber(mesh.indices);
+              }
+              else if(primitiveMember == "material")
+              {
+                return reader.ReadNumber(mesh.material);
+              }
+              else if(primitiveMember == "attributes")
+              {
+                return ForEachMember(reader, [&](std::string_view attributeName) {
+                  auto type    = glTFAttributeTypeStrToEnum(attributeName);
+                  auto bvIndex = 0u;
+                  if(!reader.ReadNumber(bvIndex))
+                  {
+                    return false;
+                  }
+                  mesh.attributes.emplace_back(std::make_pair(type, bvIndex));
+                  GLTF_LOG("GLTF: ATTR: type: %d, index: %d", int(type), int(bvIndex));
+                  return true;
+                });
+              }
+              return reader.Skip();
+            });
+          });
+        });
+      });
     }
     // parse cameras
-    else if(val.first == "cameras")
+    else if(key == "cameras")
     {
-      glTF_Camera tgifCamera{};
-      for(const auto& camera : val.second.get<picojson::array>())
-      {
-        tgifCamera.name          = camera.get("name").to_str();
-        tgifCamera.isPerspective = (camera.get("type").to_str() == "perspective");
-        if(tgifCamera.isPerspective)
-        {
-          const auto& perspective = camera.get("perspective");
-          tgifCamera.yfov         = static_cast<float>(perspective.get("yfov").get<double>());
-          tgifCamera.zfar         = static_cast<float>(perspective.get("zfar").get<double>());
-          tgifCamera.znear        = static_cast<float>(perspective.get("znear").get<double>());
-        }
-
-        mCameras.emplace_back(tgifCamera);
-      }
+      return ForEachElement(reader, [&]() {
+        mCameras.emplace_back();
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& camera = mCameras.back();
+          if(member == "name")
+          {
+            return reader.ReadString(camera.name);
+          }
+          else if(member == "type")
+          {
+            std::string_view type;
+            camera.isPerspective = reader.ReadString(type) && type == "perspective";
+            return !reader.HasError();
+          }
+          else if(member == "perspective")
+          {
+            return ForEachMember(reader, [&](std::string_view perspectiveMember) {
+              if(perspectiveMember == "yfov")
+              {
+                return reader.ReadNumber(camera.yfov);
+              }
+              else if(perspectiveMember == "zfar")
+              {
+                return reader.ReadNumber(camera.zfar);
+              }
+              else if(perspectiveMember == "znear")
+              {
+                return reader.ReadNumber(camera.znear);
+              }
+              return reader.Skip();
+            });
+          }
+          return reader.Skip();
+        });
+      });
     }
     // parse nodes
-    else if(val.first == "nodes")
+    else if(key == "nodes")
     {
-      auto nodeIndex = 1u;
-      for(const auto& node : val.second.get<picojson::array>())
-      {
+      return ForEachElement(reader, [&]() {
         glTF_Node gltfNode{};
-        gltfNode.name    = node.get("name").to_str();
-        auto rotation    = JsonGetArray<double, float>(node, "rotation", {0.0f, 0.0f, 0.0f, 1.0f});
-        auto translation = JsonGetArray<double, float>(node, "translation", {0.0f, 0.0f, 0.0f});
-        auto scale       = JsonGetArray<double, float>(node, "scale", {1.0f, 1.0f, 1.0f});
-        std::copy(rotation.result.begin(), rotation.result.end(), gltfNode.rotationQuaternion);
-        std::copy(translation.result.begin(), translation.result.end(), gltfNode.translation);
-        std::copy(scale.result.begin(), scale.result.end(), gltfNode.scale);
-
-        auto children = JsonGetArray<double, uint32_t>(node, "children");
-        if(children.success)
-        {
-          gltfNode.children = std::move(children.result);
-        }
-        gltfNode.index    = nodeIndex;
-        gltfNode.cameraId = 0xffffffff;
-        gltfNode.meshId   = 0xffffffff;
-
-        auto cameraId = JsonGetValue<double, uint32_t>(node, "camera", 0xffffffff);
-        if(cameraId.success)
-        {
-          gltfNode.cameraId = cameraId.result;
-        }
-        auto meshId = JsonGetValue<double, uint32_t>(node, "mesh", 0xffffffff);
-        if(meshId.success)
-        {
-          gltfNode.meshId = meshId.result;
-        }
+        gltfNode.index = uint32_t(mNodes.size());
         mNodes.emplace_back(gltfNode);
-        ++nodeIndex;
-      }
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& node = mNodes.back();
+          if(member == "name")
+          {
+            return reader.ReadString(node.name);
+          }
+          else if(member == "rotation")
+          {
+            return ReadFloatArray(reader, node.rotationQuaternion, 4u);
+          }
+          else if(member == "translation")
+          {
+            return ReadFloatArray(reader, node.translation, 3u);
+          }
+          else if(member == "scale")
+          {
+            return ReadFloatArray(reader, node.scale, 3u);
+          }
+          else if(member == "children")
+          {
+            return ReadIndexArray(reader, node.children);
+          }
+          else if(member == "camera")
+          {
+            return reader.ReadNumber(node.cameraId);
+          }
+          else if(member == "mesh")
+          {
+            return reader.ReadNumber(node.meshId);
+          }
+          return reader.Skip();
+        });
+      });
     }
     // parse scenes, note: only first scene is being parsed
-    else if(val.first == "scenes")
+    else if(key == "scenes")
     {
-      auto&       sceneNode = mNodes[0];
-      const auto& scene     = val.second.get<picojson::array>()[0];
-      sceneNode.name        = JsonGetValue<std::string>(scene, "name", std::string());
-      auto result           = JsonGetArray<double, uint32_t>(scene, "nodes");
-      sceneNode.children    = result.result;
-      sceneNode.index       = 0;
+      auto sceneIndex = 0u;
+      return ForEachElement(reader, [&]() {
+        if(sceneIndex++ != 0u)
+        {
+          return reader.Skip();
+        }
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& sceneNode = mNodes[0];
+          if(member == "name")
+          {
+            return reader.ReadString(sceneNode.name);
+          }
+          else if(member == "nodes")
+          {
+            return ReadIndexArray(reader, sceneNode.children);
+          }
+          return reader.Skip();
+        });
+      });
     }
-    else if(val.first == "materials")
+    else if(key == "materials")
     {
-      for(const auto& node : val.second.get<picojson::array>())
-      {
-        // Get pbr material, base color texture
-        glTF_Material material{};
-        material.doubleSided = JsonGetValue<bool>(node, "doubleSided", false).result;
-        material.name        = JsonGetValue<std::string>(node, "name", std::string()).result;
-        if(node.contains("pbrMetallicRoughness"))
-        {
-          const auto& node0 = node.get("pbrMetallicRoughness");
-          if(node0.contains("baseColorTexture"))
+      return ForEachElement(reader, [&]() {
+        mMaterials.emplace_back();
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& material = mMaterials.back();
+          if(member == "doubleSided")
           {
-            const auto& node1                                       = node0.get("baseColorTexture");
-            auto        index                                       = uint32_t(node1.get("index").get<double>());
-            auto        texCoord                                    = uint32_t(node1.get("texCoord").get<double>());
-            material.pbrMetallicRoughness.enabled                   = true;
-            material.pbrMetallicRoughness.baseTextureColor.index    = index;
-            material.pbrMetallicRoughness.baseTextureColor.texCoord = texCoord;
+            return reader.ReadBool(material.doubleSided);
           }
-        }
-        mMaterials.emplace_back(material);
-      }
+          else if(member == "name")
+          {
+            return reader.ReadString(material.name);
+          }
+          else if(member != "pbrMetallicRoughness")
+          {
+            return reader.Skip();
+          }
+
+          // Get pbr material, base color texture
+          return ForEachMember(reader, [&](std::string_view pbrMember) {
+            if(pbrMember != "baseColorTexture")
+            {
+              return reader.Skip();
+            }
+
+            auto& baseTextureColor                = material.pbrMetallicRoughness.baseTextureColor;
+            material.pbrMetallicRoughness.enabled = true;
+            return ForEachMember(reader, [&](std::string_view textureMember) {
+              if(textureMember == "index")
+              {
+                return reader.ReadNumber(baseTextureColor.index);
+              }
+              else if(textureMember == "texCoord")
+              {
+                return reader.ReadNumber(baseTextureColor.texCoord);
+              }
+              return reader.Skip();
+            });
+          });
+        });
+      });
     }
-    else if(val.first == "textures")
+    else if(key == "textures")
     {
-      for(const auto& item : val.second.get<picojson::array>())
-      {
-        auto source = JsonGetValue<double, uint32_t>(item, "source", 0xffffffff);
-        textureSources.emplace_back(source.result);
-      }
+      return ForEachElement(reader, [&]() {
+        textureSources.emplace_back(0xffffffff);
+        return ForEachMember(reader, [&](std::string_view member) {
+          return (member == "source") ? reader.ReadNumber(textureSources.back()) : reader.Skip();
+        });
+      });
     }
-    else if(val.first == "images")
+    else if(key == "images")
     {
-      for(const auto& item : val.second.get<picojson::array>())
-      {
-        glTF_Texture tex{};
-        JsonGetValueOut<std::string>(item, "name", tex.name);
-        JsonGetValueOut<std::string>(item, "uri", tex.uri);
-        images.emplace_back(tex);
-      }
+      return ForEachElement(reader, [&]() {
+        images.emplace_back();
+        return ForEachMember(reader, [&](std::string_view member) {
+          auto& image = images.back();
+          if(member == "name")
+          {
+            return reader.ReadString(image.name);
+          }
+          else if(member == "uri")
+          {
+            return reader.ReadString(image.uri);
+          }
+          return reader.Skip();
+        });
+      });
     }
+
+    return reader.Skip();
+  });
+
+  if(!success)
+  {
+    GLTF_LOG("GLTF: Error parsing %s at offset %d", filename.c_str(), int(reader.GetErrorOffset()));
+    return false;
   }
 
   // Resolve cross-referencing
   for(const auto& source : textureSources)
   {
-    mTextures.emplace_back(images[source]);
+    mTextures.emplace_back(source < images.size() ? images[source] : glTF_Texture{});
   }
 
+  GLTF_LOG("GLTF: %s loaded, size = %d", filename.c_str(), int(size));
   return true;
 }
 
 glTF_Buffer glTF::LoadFile(const std::string& filename)
 {
-  Dali::FileStream           fileStream(filename.c_str(), Dali::FileStream::READ | Dali::FileStream::BINARY);
-  FILE*                      fin = fileStream.GetFile();
-  std::vector<unsigned char> buffer;
-  if(fin)
+  glTF_Buffer buffer(filename);
+  if(buffer.IsEmpty())
   {
-    if(fseek(fin, 0, SEEK_END))
+    GLTF_LOG("LoadFile: Can't open file: errno = %d", errno);
+  }
+
+  return buffer;
+}
+
+uint32_t glTF::GetComponentTypeSize(uint32_t componentType)
+{
+  switch(componentType)
+  {
+    case 0x1400: // GL_BYTE
+    case 0x1401: // GL_UNSIGNED_BYTE
     {
-      return {};
+      return 1u;
     }
-    auto size = ftell(fin);
-    if(fseek(fin, 0, SEEK_SET))
+    case 0x1402: // GL_SHORT
+    case 0x1403: // GL_UNSIGNED_SHORT
     {
-      return {};
+      return 2u;
     }
-    buffer.resize(unsigned(size));
-    auto result = fread(buffer.data(), 1, size_t(size), fin);
-    if(result != size_t(size))
+    case 0x1405: // GL_UNSIGNED_INT
+    case 0x1406: // GL_FLOAT
     {
-      GLTF_LOG("LoadFile: Result: %d", int(result));
-      // return empty buffer
-      return {};
+      return 4u;
+    }
+    default:
+    {
+      return 0u;
     }
   }
-  else
-  {
-    GLTF_LOG("LoadFile: Can't open file: errno = %d", errno);
-  }
-
-  return buffer;
 }
 
 std::vector<const glTF_Mesh*> glTF::GetMeshes() const
@@ -454,9 +732,9 @@ std::vector<unsigned char> glTF::GetMeshAttributeBuffer(const glTF_Mesh& mesh, c
   // find buffer views
   struct Data
   {
-    uint32_t accessorIndex{0u};
-    uint32_t byteStride{0u};
-    char*    srcPtr{nullptr};
+    uint32_t    accessorIndex{0u};
+    uint32_t    byteStride{0u};
+    const char* srcPtr{nullptr};
   };
   std::vector<Data> data{};
   for(const auto& attrType : attrTypes)
@@ -479,7 +757,7 @@ std::vector<unsigned char> glTF::GetMeshAttributeBuffer(const glTF_Mesh& mesh, c
   // number of attributes is same for the whole mesh so using very first
   // accessor
 
-  glTF_Buffer retval{};
+  std::vector<unsigned char> retval{};
 
   // data is interleaved
   if(data.size() > 1)
@@ -495,7 +773,7 @@ std::vector<unsigned char> glTF::GetMeshAttributeBuffer(const glTF_Mesh& mesh, c
       auto& bufferView = mBufferViews[accessor.bufferView];
       item.byteStride  = bufferView.byteLength / attributeCount;
       attributeStride += item.byteStride;
-      item.srcPtr = reinterpret_cast<char*>(mBuffer.data()) + bufferView.byteOffset;
+      item.srcPtr = reinterpret_cast<const char*>(bufferView.data);
     }
 
     // now allocate final buffer and interleave data
@@ -516,10 +794,9 @@ std::vector<unsigned char> glTF::GetMeshAttributeBuffer(const glTF_Mesh& mesh, c
   else // copy data directly as single buffer
   {
     auto& bufferView = mBufferViews[mAccessors[data[0].accessorIndex].bufferView];
+    auto* srcPtr     = reinterpret_cast<const unsigned char*>(bufferView.data);
     retval.resize(bufferView.byteLength);
-    std::copy(mBuffer.begin() + bufferView.byteOffset,
-              mBuffer.begin() + bufferView.byteOffset + bufferView.byteLength,
-              retval.begin());
+    std::copy(srcPtr, srcPtr + bufferView.byteLength, retval.begin());
   }
   return retval;
 }
@@ -541,19 +818,19 @@ uint32_t glTF::GetMeshAttributeCount(const glTF_Mesh* mesh) const
 }
 
 std::vector<uint16_t> glTF::GetMeshIndexBuffer(const glTF_Mesh* mesh) const
+{
+  auto indices = GetMeshIndexView(*mesh);
+  return std::vector<uint16_t>(indices.begin(), indices.end());
+}
+
+glTF_AccessorView<uint16_t> glTF::GetMeshIndexView(const glTF_Mesh& mesh) const
 {
   // check GL component type
-  const auto& accessor = mAccessors[mesh->indices];
-  if(accessor.componentType == 0x1403) // GL_UNSIGNED_SHORT
+  if(mesh.indices >= mAccessors.size() || mAccessors[mesh.indices].componentType != 0x1403) // GL_UNSIGNED_SHORT
   {
-    std::vector<uint16_t> retval{};
-    retval.resize(accessor.count);
-    const auto& bufferView = mBufferViews[accessor.bufferView];
-    const auto* srcPtr     = reinterpret_cast<const uint16_t*>(reinterpret_cast<const char*>(mBuffer.data()) + bufferView.byteOffset);
-    std::copy(srcPtr, srcPtr + accessor.count, retval.data());
-    return retval;
+    return {};
   }
-  return {};
+  return GetAccessorView<uint16_t>(mesh.indices);
 }
 
 const glTF_Node* glTF::FindNodeByName(const std::string& name) const
@@ -20,11 +20,13 @@
 
 
 // EXTERNAL INCLUDES
-#include <string>
 #include <dali/integration-api/debug.h>
+#include <iterator>
+#include <string>
+#include <string_view>
 
 // INTERNAL INCLUDES
-#include "third-party/pico-json.h"
+#include "shared/mapped-file.h"
 
 #define GLTF_LOG(...)                                                                   \
   {                                                                                     \
@@ -53,21 +55,138 @@ struct glTF_Camera
 
 struct glTF_BufferView
 {
-  uint32_t bufferIndex;
-  uint32_t byteLength;
-  uint32_t byteOffset;
-  void*    data;
+  uint32_t    bufferIndex;
+  uint32_t    byteLength;
+  uint32_t    byteOffset;
+  uint32_t    byteStride; ///< 0 if the elements are tightly packed
+  const void* data;       ///< Points into the loaded buffer, nullptr if the view is out of its bounds
 };
 
 struct glTF_Accessor
 {
   uint32_t    bufferView;
+  uint32_t    byteOffset;
   uint32_t    componentType;
   uint32_t    count;
   uint32_t    componentSize;
   std::string type;
 };
 
+/**
+ * Read-only view of the elements of an accessor, stepping through the buffer with the stride of its buffer view.
+ *
+ * The view points straight into the buffer owned by the glTF object, so it must not outlive it.
+ */
+template<class T>
+class glTF_AccessorView
+{
+public:
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    Iterator(const uint8_t* ptr, uint32_t stride)
+    : mPtr(ptr),
+      mStride(stride)
+    {
+    }
+
+    reference operator*() const
+    {
+      return *reinterpret_cast<const T*>(mPtr);
+    }
+
+    pointer operator->() const
+    {
+      return reinterpret_cast<const T*>(mPtr);
+    }
+
+    Iterator& operator++()
+    {
+      mPtr += mStride;
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      Iterator previous(*this);
+      mPtr += mStride;
+      return previous;
+    }
+
+    bool operator==(const Iterator& other) const
+    {
+      return mPtr == other.mPtr;
+    }
+
+    bool operator!=(const Iterator& other) const
+    {
+      return mPtr != other.mPtr;
+    }
+
+  private:
+    const uint8_t* mPtr;
+    uint32_t       mStride;
+  };
+
+  glTF_AccessorView() = default;
+
+  glTF_AccessorView(const uint8_t* data, uint32_t stride, uint32_t count)
+  : mData(data),
+    mStride(stride),
+    mCount(count)
+  {
+  }
+
+  const T& operator[](uint32_t index) const
+  {
+    return *reinterpret_cast<const T*>(mData + size_t(index) * mStride);
+  }
+
+  Iterator begin() const
+  {
+    return Iterator(mData, mStride);
+  }
+
+  Iterator end() const
+  {
+    return Iterator(mData + size_t(mCount) * mStride, mStride);
+  }
+
+  uint32_t size() const
+  {
+    return mCount;
+  }
+
+  bool empty() const
+  {
+    return mCount == 0u;
+  }
+
+  /**
+   * Returns whether the elements are tightly packed, so data() can be used as a plain array
+   */
+  bool IsContiguous() const
+  {
+    return mStride == sizeof(T);
+  }
+
+  const T* data() const
+  {
+    return reinterpret_cast<const T*>(mData);
+  }
+
+private:
+  const uint8_t* mData{nullptr};
+  uint32_t       mStride{0u};
+  uint32_t       mCount{0u};
+};
+
 struct glTF_Mesh
 {
   std::string                                         name;
@@ -112,15 +231,25 @@ struct glTF_Node
   float scale[3]              = {1.0f, 1.0f, 1.0f};
 };
 
-using glTF_Buffer = std::vector<unsigned char>;
+/**
+ * Contents of a .gltf or .bin file, memory mapped where the platform allows it
+ */
+using glTF_Buffer = DemoHelper::MappedFile;
 
 /**
  * Simple glTF parser
  *
- * This implementation requires 2 files (it doesn't decode Base64 embedded in json)
+ * Supports a .gltf file with its buffer in a separate file or embedded as a base64 data uri,
+ * and binary .glb files. Only the first buffer is used.
+ * The binary data is kept mapped for the lifetime of the object, and the buffer views and
+ * accessor views point straight into it.
  */
 struct glTF
 {
+  /**
+   * Loads a glTF scene
+   * @param[in] filename Path of a .gltf or .glb file; a path without extension refers to a .gltf file
+   */
   glTF(const std::string& filename);
   ~glTF() = default;
 
@@ -148,6 +277,26 @@ struct glTF
   uint32_t                   GetMeshAttributeCount(const glTF_Mesh* mesh) const;
   const glTF_Mesh*           FindMeshByName(const std::string& name) const;
 
+  /**
+   * Returns a view of the elements of an accessor without copying them
+   * @return An empty view if the accessor is invalid or its elements are not of type T
+   */
+  template<class T>
+  glTF_AccessorView<T> GetAccessorView(uint32_t accessorIndex) const;
+
+  /**
+   * Returns a view of a mesh attribute without copying it
+   * @return An empty view if the mesh doesn't have the attribute or its elements are not of type T
+   */
+  template<class T>
+  glTF_AccessorView<T> GetMeshAttributeView(const glTF_Mesh& mesh, glTFAttributeType attrType) const;
+
+  /**
+   * Returns a view of the index buffer of a mesh without copying it
+   * @return An empty view if the indices are not unsigned shorts
+   */
+  glTF_AccessorView<uint16_t> GetMeshIndexView(const glTF_Mesh& mesh) const;
+
   /**
    * Returns a copy of index buffer
    * @return
@@ -159,9 +308,30 @@ struct glTF
 private:
   void LoadFromFile(const std::string& filename);
 
+  void LoadFromBinaryFile(const std::string& filename);
+
+  /**
+   * Loads the buffer at uri, relative to filename, or decodes it if uri is a data uri
+   */
+  void LoadBuffer(const std::string& filename, std::string_view uri);
+
+  /**
+   * Points the buffer views into the loaded buffer
+   */
+  void ResolveBufferViews();
+
   glTF_Buffer LoadFile(const std::string& filename);
 
-  bool ParseJSON();
+  /**
+   * Reads the json text in place
+   * @param[out] bufferUri The uri of the first buffer, pointing into the json text
+   */
+  bool ParseJSON(const uint8_t* data, size_t size, const std::string& filename, std::string_view& bufferUri);
+
+  /**
+   * Returns the size in bytes of a single component of the given GL type
+   */
+  static uint32_t GetComponentTypeSize(uint32_t componentType);
 
   std::vector<glTF_Mesh>       mMeshes;
   std::vector<glTF_Camera>     mCameras;
@@ -170,11 +340,49 @@ private:
   std::vector<glTF_Node>       mNodes;
   std::vector<glTF_Material>   mMaterials;
   std::vector<glTF_Texture>    mTextures;
-  glTF_Buffer                  mBuffer;
-  glTF_Buffer                  jsonBuffer;
-
-  // json nodes
-  picojson::value jsonNode;
+  glTF_Buffer                  mBuffer;        ///< The .bin or .glb file
+  std::vector<uint8_t>         mDecodedBuffer; ///< The buffer decoded from a data uri
+  const uint8_t*               mBinData{nullptr};
+  size_t                       mBinSize{0u};
 };
 
+template<class T>
+glTF_AccessorView<T> glTF::GetAccessorView(uint32_t accessorIndex) const
+{
+  if(accessorIndex >= mAccessors.size())
+  {
+    return {};
+  }
+
+  const auto& accessor = mAccessors[accessorIndex];
+  if(accessor.bufferView >= mBufferViews.size() ||
+     accessor.componentSize * GetComponentTypeSize(accessor.componentType) != sizeof(T))
+  {
+    return {};
+  }
+
+  const auto& bufferView = mBufferViews[accessor.bufferView];
+  const auto  stride     = bufferView.byteStride ? bufferView.byteStride : uint32_t(sizeof(T));
+  if(!bufferView.data || !accessor.count ||
+     size_t(accessor.byteOffset) + size_t(accessor.count - 1u) * stride + sizeof(T) > bufferView.byteLength)
+  {
+    return {};
+  }
+
+  return {reinterpret_cast<const uint8_t*>(bufferView.data) + accessor.byteOffset, stride, accessor.count};
+}
+
+template<class T>
+glTF_AccessorView<T> glTF::GetMeshAttributeView(const glTF_Mesh& mesh, glTFAttributeType attrType) const
+{
+  for(const auto& attribute : mesh.attributes)
+  {
+    if(attribute.first == attrType)
+    {
+      return GetAccessorView<T>(attribute.second);
+    }
+  }
+  return {};
+}
+
 #endif //DALI_CMAKE_GLTF_SCENE_H
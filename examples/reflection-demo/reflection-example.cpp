@@ -19,14 +19,33 @@
 #include <dali/devel-api/actors/camera-actor-devel.h>
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 
+#include <stdio.h>
+#include <chrono>
 #include <map>
 
 #include "gltf-scene.h"
+#include "shared/base64.h"
+#include "shared/benchmark-harness.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 
 namespace
 {
+const unsigned int BENCHMARK_RENDER_TIME(2000u); ///< Milliseconds of frames recorded after the load benchmark
+
+unsigned int gLoadRepeats(50u);
+std::string  gModelPath;
+
+/**
+ * Milliseconds elapsed since the given time
+ */
+double GetMillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 // clang-format off
 
 const char* VERTEX_SHADER = DALI_COMPOSE_SHADER(
@@ -238,6 +257,33 @@ Shader CreateShader(const std::string& vsh, const std::string& fsh)
   return Shader::New(std::string(vshShaderSource.data()), std::string(fshShaderSource.data()));
 }
 
+/**
+ * Adds a vertex buffer holding a single attribute of a mesh to the geometry
+ *
+ * When the attribute is tightly packed in the glTF buffer, its data is handed straight from the
+ * mapped file to the vertex buffer, otherwise it's packed first.
+ */
+template<class T>
+void AddVertexAttribute(Geometry& geometry, const glTF_AccessorView<T>& view, const std::string& name, Property::Type type)
+{
+  if(view.empty())
+  {
+    return;
+  }
+
+  auto vertexBuffer = VertexBuffer::New(Property::Map().Add(name, type));
+  if(view.IsContiguous())
+  {
+    vertexBuffer.SetData(view.data(), view.size());
+  }
+  else
+  {
+    std::vector<T> packed(view.begin(), view.end());
+    vertexBuffer.SetData(packed.data(), packed.size());
+  }
+  geometry.AddVertexBuffer(vertexBuffer);
+}
+
 ModelPtr CreateModel(
   glTF&              gltf,
   const glTF_Mesh*   mesh,
@@ -245,29 +291,23 @@ ModelPtr CreateModel(
   const std::string& fragmentShaderSource)
 {
   /*
-   * Obtain interleaved buffer for first mesh with position and normal attributes
-   */
-  auto positionBuffer = gltf.GetMeshAttributeBuffer(*mesh,
-                                                    {glTFAttributeType::POSITION,
-                                                     glTFAttributeType::NORMAL,
-                                                     glTFAttributeType::TEXCOORD_0});
-
-  auto attributeCount = gltf.GetMeshAttributeCount(mesh);
-  /**
-   * Create matching property buffer
+   * Create one vertex buffer per attribute, reading the attributes in place from the glTF buffer
    */
-  auto vertexBuffer = VertexBuffer::New(Property::Map()
-                                          .Add("aPosition", Property::VECTOR3)
-                                          .Add("aNormal", Property::VECTOR3)
-                                          .Add("aTexCoord", Property::VECTOR2));
-
-  // set vertex data
-  vertexBuffer.SetData(positionBuffer.data(), attributeCount);
-
   auto geometry = Geometry::New();
-  geometry.AddVertexBuffer(vertexBuffer);
-  auto indexBuffer = gltf.GetMeshIndexBuffer(mesh);
-  geometry.SetIndexBuffer(indexBuffer.data(), indexBuffer.size());
+  AddVertexAttribute(geometry, gltf.GetMeshAttributeView<Vector3>(*mesh, glTFAttributeType::POSITION), "aPosition", Property::VECTOR3);
+  AddVertexAttribute(geometry, gltf.GetMeshAttributeView<Vector3>(*mesh, glTFAttributeType::NORMAL), "aNormal", Property::VECTOR3);
+  AddVertexAttribute(geometry, gltf.GetMeshAttributeView<Vector2>(*mesh, glTFAttributeType::TEXCOORD_0), "aTexCoord", Property::VECTOR2);
+
+  auto indices = gltf.GetMeshIndexView(*mesh);
+  if(indices.IsContiguous())
+  {
+    geometry.SetIndexBuffer(indices.data(), indices.size());
+  }
+  else
+  {
+    auto indexBuffer = gltf.GetMeshIndexBuffer(mesh);
+    geometry.SetIndexBuffer(indexBuffer.data(), indexBuffer.size());
+  }
   geometry.SetType(Geometry::Type::TRIANGLES);
   ModelPtr retval(new Model());
   retval->shader   = CreateShader(vertexShaderSource, fragmentShaderSource);
@@ -447,11 +487,19 @@ Actor CreateSceneFromGLTF(
 
 // This example shows how to create and display mirrored reflection using CameraActor
 //
+// With --timing-output, it times loading the scene -r times, as well as any .gltf or .glb given with --model=, and
+// decoding the scene's buffer from base64, with and without SIMD. It then records the frame times for a while and quits.
+//
 class ReflectionExample : public ConnectionTracker
 {
 public:
-  ReflectionExample(Application& application)
-  : mApplication(application)
+  /**
+   * @param[in] application The DALi application instance
+   * @param[in] harness Records the load times and the frame times, if given
+   */
+  ReflectionExample(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr)
+  : mApplication(application),
+    mHarness(harness)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &ReflectionExample::Create);
@@ -463,6 +511,8 @@ private:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window   window       = application.GetWindow();
     uint32_t windowWidth  = uint32_t(window.GetSize().GetWidth());
@@ -591,6 +641,83 @@ private:
     window.KeyEventSignal().Connect(this, &ReflectionExample::OnKeyEvent);
 
     mTickTimer.Start();
+
+    if(mHarness)
+    {
+      mHarness->StartRecording(window.GetRootLayer());
+    }
+    if(mHarness && mHarness->IsRecording())
+    {
+      mHarness->StartPhase("load");
+      AddLoadTimes("loadGltf", DEMO_GAME_DIR "/reflection");
+      if(!gModelPath.empty())
+      {
+        AddLoadTimes("loadModel", gModelPath);
+      }
+      AddDecodeTimes(DEMO_GAME_DIR "/reflection.bin");
+
+      mHarness->StartPhase("render");
+      mBenchmarkTimer = Timer::New(BENCHMARK_RENDER_TIME);
+      mBenchmarkTimer.TickSignal().Connect(this, &ReflectionExample::OnBenchmarkFinished);
+      mBenchmarkTimer.Start();
+    }
+  }
+
+  /**
+   * Times loading the glTF scene at path, as many times as requested, and adds the times to the results
+   */
+  void AddLoadTimes(const std::string& name, const std::string& path)
+  {
+    std::vector<double> times;
+    times.reserve(gLoadRepeats);
+    for(unsigned int i = 0u; i < gLoadRepeats; ++i)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      glTF       gltf(path);
+      times.push_back(GetMillisecondsSince(start));
+    }
+    mHarness->AddSamples(name, std::move(times));
+  }
+
+  /**
+   * Times decoding the file at path from base64, with DecodeBase64() and DecodeBase64Scalar(), and adds the times to the results
+   */
+  void AddDecodeTimes(const std::string& path)
+  {
+    DemoHelper::MappedFile file(path);
+    if(file.IsEmpty())
+    {
+      DALI_LOG_ERROR("Unable to read %s\n", path.c_str());
+      return;
+    }
+
+    const std::string    text = DemoHelper::Base64::EncodeBase64(file.GetData(), file.GetSize());
+    std::vector<uint8_t> decoded;
+    std::vector<double>  times;
+    std::vector<double>  scalarTimes;
+    times.reserve(gLoadRepeats);
+    scalarTimes.reserve(gLoadRepeats);
+    for(unsigned int i = 0u; i < gLoadRepeats; ++i)
+    {
+      auto start = std::chrono::steady_clock::now();
+      DemoHelper::Base64::DecodeBase64(text.data(), text.size(), decoded);
+      times.push_back(GetMillisecondsSince(start));
+
+      start = std::chrono::steady_clock::now();
+      DemoHelper::Base64::DecodeBase64Scalar(text.data(), text.size(), decoded);
+      scalarTimes.push_back(GetMillisecondsSince(start));
+    }
+
+    printf("Base64 decode of %zu characters, SIMD: %s\n", text.size(), DemoHelper::Base64::SIMD_NAME);
+    mHarness->AddSamples("decodeBase64", std::move(times));
+    mHarness->AddSamples("decodeBase64Scalar", std::move(scalarTimes));
+  }
+
+  bool OnBenchmarkFinished()
+  {
+    mHarness->FinishRecording();
+    mApplication.Quit();
+    return false;
   }
 
   void OnPan(Actor actor, const PanGesture& panGesture)
@@ -640,7 +767,8 @@ private:
   }
 
 private:
-  Application& mApplication;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness* mHarness;
 
   Layer mLayer3D{};
 
@@ -657,6 +785,7 @@ private:
   PanGestureDetector mPanGestureDetector{};
 
   Timer mTickTimer{};
+  Timer mBenchmarkTimer{};
 
   CameraActor mCamera3D{};
   CameraActor mReflectionCamera3D{};
@@ -664,10 +793,34 @@ private:
   Actor       mCenterHorizActor{};
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application       application = Application::New(&argc, &argv);
-  ReflectionExample test(application);
+  DemoHelper::BenchmarkHarness harness("reflection-demo", "reflection-demo.example");
+  harness.AddOption("loadRepeats", "-r", "Times each load and decode is repeated with --timing-output", gLoadRepeats);
+  harness.AddOption("model", "--model=", "A .gltf or .glb file loaded as well with --timing-output", gModelPath);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  Application application = Application::New(&argc, &argv);
+
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  ReflectionExample test(application, &harness);
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ReflectionExample)
@@ -26,6 +26,8 @@
 #include <sstream>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -245,6 +247,8 @@ private:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window  window     = application.GetWindow();
     Vector2 windowSize = window.GetSize();
 
@@ -599,6 +603,7 @@ private:
 
 /*****************************************************************************/
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application             app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -606,3 +611,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(RefractionEffectExample)
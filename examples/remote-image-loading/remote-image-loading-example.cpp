@@ -21,6 +21,8 @@
 #include <shared/utility.h>
 #include <stdlib.h>
 #include <iostream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -55,6 +57,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     mWindow = application.GetWindow();
     mWindow.SetBackgroundColor(Color::BLACK);
     mWindow.KeyEventSignal().Connect(this, &MyTester::OnKey);
@@ -205,6 +209,7 @@ private:
   Timer     mTimer;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application application = Application::New(&argc, &argv, "");
@@ -212,3 +217,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(MyTester)
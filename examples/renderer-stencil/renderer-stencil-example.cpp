@@ -20,6 +20,8 @@
 
 // INTERNAL INCLUDES
 #include "renderer-stencil-shaders.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -110,6 +112,8 @@ private:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     // Use a gradient visual to render the background gradient.
@@ -741,6 +745,7 @@ private:
   Actor     mCubes[2];          ///< The cube object containers
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application            application = Application::New(&argc, &argv);
@@ -748,3 +753,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(RendererStencilExample)
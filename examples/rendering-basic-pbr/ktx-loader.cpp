@@ -19,17 +19,25 @@
 #include "ktx-loader.h"
 
 // EXTERNAL INCLUDES
-#include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
 #include <memory.h>
 #include <stdint.h>
-#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
 
 namespace PbrDemo
 {
+namespace
+{
+const uint8_t  KTX_IDENTIFIER[12]     = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+const uint32_t KTX_ENDIANNESS         = 0x04030201;
+const uint32_t KTX_ENDIANNESS_SWAPPED = 0x01020304;
+
+const uint32_t CUBE_MAP_FACE_COUNT(6u);
+
 struct KtxFileHeader
 {
-  char     identifier[12];
+  uint8_t  identifier[12];
   uint32_t endianness;
   uint32_t glType; //(UNSIGNED_BYTE, UNSIGNED_SHORT_5_6_5, etc.)
   uint32_t glTypeSize;
@@ -45,41 +53,115 @@ struct KtxFileHeader
   uint32_t bytesOfKeyValueData;
 };
 
+/**
+ * Size of the pixels, or of the 4x4 blocks of compressed formats
+ */
+struct FormatSize
+{
+  uint32_t bytes;
+  bool     compressed;
+};
+
+uint32_t SwapBytes(uint32_t value)
+{
+  return (value >> 24) | ((value >> 8) & 0xff00u) | ((value << 8) & 0xff0000u) | (value << 24);
+}
+
+uint32_t ReadUint32(const uint8_t* data, bool swap)
+{
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return swap ? SwapBytes(value) : value;
+}
+
+uint32_t Align4(uint32_t size)
+{
+  return (size + 3u) & ~3u;
+}
+
 /**
  * Convert KTX format to Dali::Pixel::Format
+ *
+ * Uncompressed files are converted from the format and type of their data, compressed ones (which have a type of 0)
+ * from their internal format.
  */
-bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& format)
+bool ConvertPixelFormat(const KtxFileHeader& header, Dali::Pixel::Format& format, FormatSize& size)
 {
-  switch(ktxPixelFormat)
+  if(header.glType != 0u)
   {
-    case 0x93B0: // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+    const uint32_t type         = header.glType;
+    const bool     unsignedByte = type == 0x1401;                                          // GL_UNSIGNED_BYTE
+    const bool     rgbFormat    = header.glFormat == 0x1907 || header.glFormat == 0x8D98; // GL_RGB, GL_RGB_INTEGER
+    const bool     rgbaFormat   = header.glFormat == 0x1908 || header.glFormat == 0x8D99; // GL_RGBA, GL_RGBA_INTEGER
+    const bool     luminance    = header.glFormat == 0x1909;                               // GL_LUMINANCE
+
+    if(rgbFormat && unsignedByte)
     {
-      format = Dali::Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR;
-      break;
+      format = Dali::Pixel::RGB888;
+      size   = FormatSize{3u, false};
+    }
+    else if(rgbaFormat && unsignedByte)
+    {
+      format = Dali::Pixel::RGBA8888;
+      size   = FormatSize{4u, false};
     }
-    case 0x881B: // GL_RGB16F
+    else if(luminance && unsignedByte)
+    {
+      format = Dali::Pixel::L8;
+      size   = FormatSize{1u, false};
+    }
+    else if(rgbFormat && type == 0x8363) // GL_UNSIGNED_SHORT_5_6_5
+    {
+      format = Dali::Pixel::RGB565;
+      size   = FormatSize{2u, false};
+    }
+    else if(rgbFormat && type == 0x140B) // GL_HALF_FLOAT
     {
       format = Dali::Pixel::RGB16F;
-      break;
+      size   = FormatSize{6u, false};
     }
-    case 0x8815: // GL_RGB32F
+    else if(rgbFormat && type == 0x1406) // GL_FLOAT
     {
       format = Dali::Pixel::RGB32F;
+      size   = FormatSize{12u, false};
+    }
+    else
+    {
+      return false;
+    }
+    return true;
+  }
+
+  switch(header.glInternalFormat)
+  {
+    case 0x8D64: // GL_ETC1_RGB8_OES
+    {
+      format = Dali::Pixel::COMPRESSED_RGB8_ETC1;
+      size   = FormatSize{8u, true};
       break;
     }
-    case 0x8C3A: // GL_R11F_G11F_B10F
+    case 0x9274: // GL_COMPRESSED_RGB8_ETC2
     {
-      format = Dali::Pixel::RGB32F;
+      format = Dali::Pixel::COMPRESSED_RGB8_ETC2;
+      size   = FormatSize{8u, true};
       break;
     }
-    case 0x8D7C: // GL_RGBA8UI
+    case 0x9278: // GL_COMPRESSED_RGBA8_ETC2_EAC
     {
-      format = Dali::Pixel::RGBA8888;
+      format = Dali::Pixel::COMPRESSED_RGBA8_ETC2_EAC;
+      size   = FormatSize{16u, true};
       break;
     }
-    case 0x8D7D: // GL_RGB8UI
+    case 0x93B0: // GL_COMPRESSED_RGBA_ASTC_4x4_KHR
     {
-      format = Dali::Pixel::RGB888;
+      format = Dali::Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR;
+      size   = FormatSize{16u, true};
+      break;
+    }
+    case 0x93D0: // GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR
+    {
+      format = Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR;
+      size   = FormatSize{16u, true};
       break;
     }
     default:
@@ -91,94 +173,333 @@ bool ConvertPixelFormat(const uint32_t ktxPixelFormat, Dali::Pixel::Format& form
   return true;
 }
 
-bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata)
+/**
+ * The size of an image as stored in the file, with rows of uncompressed formats padded to 4 bytes
+ */
+size_t GetImageSize(uint32_t width, uint32_t height, const FormatSize& size)
 {
-  std::unique_ptr<FILE, void (*)(FILE*)> fp(fopen(path.c_str(), "rb"), [](FILE* fp) {
-    if(fp)
-    {
-      fclose(fp);
-    }
-  });
-  if(!fp)
+  if(size.compressed)
+  {
+    return static_cast<size_t>((width + 3u) / 4u) * ((height + 3u) / 4u) * size.bytes;
+  }
+  return static_cast<size_t>(Align4(width * size.bytes)) * height;
+}
+
+} // namespace
+
+KtxFile::KtxFile()
+: mPixelFormat(Pixel::INVALID),
+  mWidth(0u),
+  mHeight(0u),
+  mMipmapLevelCount(0u),
+  mFaceCount(0u),
+  mArrayElementCount(0u),
+  mBytesPerPixel(0u),
+  mTypeSize(1u),
+  mSwapEndianness(false)
+{
+}
+
+bool KtxFile::Load(const std::string& path)
+{
+  Close();
+
+  if(!mFile.Open(path) || mFile.GetSize() < sizeof(KtxFileHeader))
   {
+    DALI_LOG_ERROR("Failed to read %s\n", path.c_str());
+    Close();
     return false;
   }
 
+  const uint8_t* data = mFile.GetData();
+  const size_t   size = mFile.GetSize();
+
   KtxFileHeader header;
-  int           result = fread(&header, sizeof(KtxFileHeader), 1u, fp.get());
-  if(0 == result)
+  memcpy(&header, data, sizeof(header));
+  if(memcmp(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER)) != 0 ||
+     (header.endianness != KTX_ENDIANNESS && header.endianness != KTX_ENDIANNESS_SWAPPED))
   {
+    DALI_LOG_ERROR("%s is not a KTX file\n", path.c_str());
+    Close();
     return false;
   }
 
-  // Skip the key-values:
-  if(fseek(fp.get(), header.bytesOfKeyValueData, SEEK_CUR))
+  mSwapEndianness = header.endianness == KTX_ENDIANNESS_SWAPPED;
+  if(mSwapEndianness)
+  {
+    for(uint32_t* field = &header.glType; field <= &header.bytesOfKeyValueData; ++field)
+    {
+      *field = SwapBytes(*field);
+    }
+  }
+
+  FormatSize formatSize{0u, false};
+  if(!ConvertPixelFormat(header, mPixelFormat, formatSize))
   {
+    DALI_LOG_ERROR("%s has an unsupported format (type 0x%x, format 0x%x, internal format 0x%x)\n", path.c_str(), header.glType, header.glFormat, header.glInternalFormat);
+    Close();
     return false;
   }
 
-  cubedata.img.resize(header.numberOfFaces);
+  mBytesPerPixel = formatSize.compressed ? 0u : formatSize.bytes;
+
+  // Only the components of uncompressed formats are swapped, 16 or 32 bits at a time
+  mTypeSize = (!formatSize.compressed && (header.glTypeSize == 2u || header.glTypeSize == 4u)) ? header.glTypeSize : 1u;
+
+  const bool nonArrayCubeMap = header.numberOfFaces == CUBE_MAP_FACE_COUNT && header.numberOfArrayElements == 0u;
 
-  for(unsigned int face = 0; face < header.numberOfFaces; ++face) //array_element must be 0 or 1
+  mWidth             = header.pixelWidth;
+  mHeight            = std::max(header.pixelHeight, 1u);
+  mFaceCount         = header.numberOfFaces;
+  mArrayElementCount = std::max(header.numberOfArrayElements, 1u);
+  mMipmapLevelCount  = std::max(header.numberOfMipmapLevels, 1u); // 0 asks for the mipmaps to be generated
+
+  if(mWidth == 0u || header.pixelDepth > 1u || (mFaceCount != 1u && mFaceCount != CUBE_MAP_FACE_COUNT) ||
+     mMipmapLevelCount > 32u || (std::max(mWidth, mHeight) >> (mMipmapLevelCount - 1u)) == 0u)
   {
-    cubedata.img[face].resize(header.numberOfMipmapLevels);
+    DALI_LOG_ERROR("%s has unsupported dimensions (%ux%ux%u, %u faces, %u levels)\n", path.c_str(), header.pixelWidth, header.pixelHeight, header.pixelDepth, header.numberOfFaces, header.numberOfMipmapLevels);
+    Close();
+    return false;
   }
 
-  if(0 == header.numberOfMipmapLevels)
+  // Key-value data: keyAndValueByteSize, the key and the value, padded to 4 bytes
+  size_t offset = sizeof(KtxFileHeader);
+  if(header.bytesOfKeyValueData > size - offset)
   {
-    header.numberOfMipmapLevels = 1u;
+    DALI_LOG_ERROR("%s is truncated\n", path.c_str());
+    Close();
+    return false;
   }
 
-  if(0 == header.numberOfArrayElements)
+  const size_t keyValueEnd = offset + header.bytesOfKeyValueData;
+  while(offset + sizeof(uint32_t) <= keyValueEnd)
   {
-    header.numberOfArrayElements = 1u;
+    const uint32_t keyAndValueByteSize = ReadUint32(data + offset, mSwapEndianness);
+    offset += sizeof(uint32_t);
+    if(keyAndValueByteSize > keyValueEnd - offset)
+    {
+      DALI_LOG_ERROR("%s has invalid key-value data\n", path.c_str());
+      Close();
+      return false;
+    }
+
+    const char* keyAndValue = reinterpret_cast<const char*>(data + offset);
+    const char* keyEnd      = static_cast<const char*>(memchr(keyAndValue, '\0', keyAndValueByteSize));
+    if(keyEnd)
+    {
+      // the value is usually null terminated too, which isn't part of it
+      const char* valueEnd = keyAndValue + keyAndValueByteSize;
+      if(valueEnd > keyEnd + 1 && *(valueEnd - 1) == '\0')
+      {
+        --valueEnd;
+      }
+      mKeyValues.emplace_back(std::string(keyAndValue, keyEnd), std::string(keyEnd + 1, valueEnd));
+    }
+    offset += Align4(keyAndValueByteSize);
   }
+  offset = keyValueEnd;
 
-  if(0 == header.pixelDepth)
+  // Images: for each level, imageSize then the images of every array element and face, each padded to 4 bytes
+  mImages.reserve(static_cast<size_t>(mMipmapLevelCount) * mArrayElementCount * mFaceCount);
+  for(uint32_t mipmapLevel = 0u; mipmapLevel < mMipmapLevelCount; ++mipmapLevel)
   {
-    header.pixelDepth = 1u;
+    const size_t imageCount = static_cast<size_t>(mArrayElementCount) * mFaceCount;
+    const size_t faceSize   = GetImageSize(GetWidth(mipmapLevel), GetHeight(mipmapLevel), formatSize);
+    const size_t paddedSize = (faceSize + 3u) & ~size_t(3u);
+    if(size - offset < sizeof(uint32_t))
+    {
+      DALI_LOG_ERROR("%s is truncated at level %u\n", path.c_str(), mipmapLevel);
+      Close();
+      return false;
+    }
+
+    // imageSize is the size of one face for cube maps that aren't arrays, and of the whole level otherwise
+    const uint32_t imageSize = ReadUint32(data + offset, mSwapEndianness);
+    offset += sizeof(uint32_t);
+    if(imageSize != (nonArrayCubeMap ? faceSize : faceSize * imageCount))
+    {
+      DALI_LOG_ERROR("%s has an unexpected image size %u at level %u\n", path.c_str(), imageSize, mipmapLevel);
+      Close();
+      return false;
+    }
+
+    if(paddedSize * imageCount > size - offset)
+    {
+      DALI_LOG_ERROR("%s is truncated at level %u\n", path.c_str(), mipmapLevel);
+      Close();
+      return false;
+    }
+
+    for(size_t i = 0u; i < imageCount; ++i)
+    {
+      mImages.push_back(Image{offset, faceSize});
+      offset += paddedSize;
+    }
   }
 
-  if(0 == header.pixelHeight)
+  return true;
+}
+
+void KtxFile::Close()
+{
+  mFile.Close();
+  mImages.clear();
+  mKeyValues.clear();
+  mPixelFormat       = Pixel::INVALID;
+  mWidth             = 0u;
+  mHeight            = 0u;
+  mMipmapLevelCount  = 0u;
+  mFaceCount         = 0u;
+  mArrayElementCount = 0u;
+  mBytesPerPixel     = 0u;
+  mTypeSize          = 1u;
+  mSwapEndianness    = false;
+}
+
+uint32_t KtxFile::GetWidth(uint32_t mipmapLevel) const
+{
+  return std::max(mWidth >> mipmapLevel, 1u);
+}
+
+uint32_t KtxFile::GetHeight(uint32_t mipmapLevel) const
+{
+  return std::max(mHeight >> mipmapLevel, 1u);
+}
+
+uint32_t KtxFile::GetMipmapLevelCount() const
+{
+  return mMipmapLevelCount;
+}
+
+uint32_t KtxFile::GetFaceCount() const
+{
+  return mFaceCount;
+}
+
+uint32_t KtxFile::GetArrayElementCount() const
+{
+  return mArrayElementCount;
+}
+
+Pixel::Format KtxFile::GetPixelFormat() const
+{
+  return mPixelFormat;
+}
+
+bool KtxFile::GetKeyValue(const std::string& key, std::string& value) const
+{
+  for(const auto& keyValue : mKeyValues)
   {
-    header.pixelHeight = 1u;
+    if(keyValue.first == key)
+    {
+      value = keyValue.second;
+      return true;
+    }
   }
+  return false;
+}
 
-  Dali::Pixel::Format daliformat = Pixel::RGB888;
+PixelData KtxFile::GetPixelData(uint32_t mipmapLevel, uint32_t face, uint32_t arrayElement) const
+{
+  if(mipmapLevel >= mMipmapLevelCount || face >= mFaceCount || arrayElement >= mArrayElementCount)
+  {
+    return PixelData();
+  }
+
+  const Image&   image  = mImages[(static_cast<size_t>(mipmapLevel) * mArrayElementCount + arrayElement) * mFaceCount + face];
+  const uint8_t* source = mFile.GetData() + image.offset;
+  const uint32_t width  = GetWidth(mipmapLevel);
+  const uint32_t height = GetHeight(mipmapLevel);
+
+  // PixelData takes ownership of a buffer it frees itself, so the image is copied out of the mapping;
+  // the rows of uncompressed formats are unpadded and their components put in the host order on the way.
+  size_t   size      = image.size;
+  uint32_t rowSize   = 0u;
+  uint32_t paddedRow = 0u;
+  if(mBytesPerPixel > 0u)
+  {
+    rowSize   = width * mBytesPerPixel;
+    paddedRow = Align4(rowSize);
+    size      = static_cast<size_t>(rowSize) * height;
+  }
 
-  ConvertPixelFormat(header.glInternalFormat, daliformat);
+  uint8_t* buffer = static_cast<uint8_t*>(malloc(size)); // resources will be freed when the PixelData is destroyed.
+  if(!buffer)
+  {
+    return PixelData();
+  }
 
-  for(unsigned int mipmapLevel = 0; mipmapLevel < header.numberOfMipmapLevels; ++mipmapLevel)
+  if(rowSize == paddedRow)
+  {
+    memcpy(buffer, source, size);
+  }
+  else
   {
-    uint32_t byteSize = 0;
-    if(fread(&byteSize, sizeof(byteSize), 1u, fp.get()) != 1)
+    for(uint32_t row = 0u; row < height; ++row)
     {
-      return false;
+      memcpy(buffer + static_cast<size_t>(row) * rowSize, source + static_cast<size_t>(row) * paddedRow, rowSize);
     }
+  }
 
-    if(0 != byteSize % 4u)
+  if(mSwapEndianness && mTypeSize > 1u)
+  {
+    for(uint8_t* component = buffer; component + mTypeSize <= buffer + size; component += mTypeSize)
     {
-      byteSize += 4u - byteSize % 4u;
+      std::reverse(component, component + mTypeSize);
     }
+  }
+
+  return PixelData::New(buffer, static_cast<uint32_t>(size), width, height, mPixelFormat, PixelData::FREE);
+}
+
+bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata)
+{
+  KtxFile file;
+  if(!file.Load(path))
+  {
+    return false;
+  }
 
-    for(unsigned int arrayElement = 0; arrayElement < header.numberOfArrayElements; ++arrayElement) // arrayElement must be 0 or 1
+  const uint32_t faceCount = file.GetFaceCount();
+  cubedata.img.assign(file.GetArrayElementCount() * faceCount, std::vector<PixelData>(file.GetMipmapLevelCount()));
+  for(uint32_t mipmapLevel = 0u; mipmapLevel < file.GetMipmapLevelCount(); ++mipmapLevel)
+  {
+    for(uint32_t arrayElement = 0u; arrayElement < file.GetArrayElementCount(); ++arrayElement)
     {
-      for(unsigned int face = 0; face < header.numberOfFaces; ++face)
+      for(uint32_t face = 0u; face < faceCount; ++face)
       {
-        std::unique_ptr<uint8_t, void (*)(void*)> img(static_cast<unsigned char*>(malloc(byteSize)), free); // resources will be freed when the PixelData is destroyed.
-        if(fread(img.get(), byteSize, 1u, fp.get()) != 1)
-        {
-          return false;
-        }
-        cubedata.img[face][mipmapLevel] = PixelData::New(img.release(), byteSize, header.pixelWidth, header.pixelHeight, daliformat, PixelData::FREE);
+        cubedata.img[arrayElement * faceCount + face][mipmapLevel] = file.GetPixelData(mipmapLevel, face, arrayElement);
       }
     }
-
-    header.pixelHeight /= 2u;
-    header.pixelWidth /= 2u;
   }
 
   return true;
 }
 
+Texture CreateCubeMapTexture(const KtxFile& file, uint32_t firstMipmapLevel)
+{
+  if(file.GetFaceCount() != CUBE_MAP_FACE_COUNT || firstMipmapLevel >= file.GetMipmapLevelCount())
+  {
+    return Texture();
+  }
+
+  Texture texture = Texture::New(TextureType::TEXTURE_CUBE, file.GetPixelFormat(), file.GetWidth(firstMipmapLevel), file.GetHeight(firstMipmapLevel));
+  for(uint32_t mipmapLevel = firstMipmapLevel; mipmapLevel < file.GetMipmapLevelCount(); ++mipmapLevel)
+  {
+    for(uint32_t face = 0u; face < CUBE_MAP_FACE_COUNT; ++face)
+    {
+      texture.Upload(file.GetPixelData(mipmapLevel, face), CubeMapLayer::POSITIVE_X + face, mipmapLevel - firstMipmapLevel, 0u, 0u, file.GetWidth(mipmapLevel), file.GetHeight(mipmapLevel));
+    }
+  }
+  return texture;
+}
+
+void UploadCubeMapLevel(const KtxFile& file, Texture texture, uint32_t mipmapLevel)
+{
+  for(uint32_t face = 0u; face < file.GetFaceCount(); ++face)
+  {
+    texture.Upload(file.GetPixelData(mipmapLevel, face), CubeMapLayer::POSITIVE_X + face, mipmapLevel, 0u, 0u, file.GetWidth(mipmapLevel), file.GetHeight(mipmapLevel));
+  }
+}
+
 } // namespace PbrDemo
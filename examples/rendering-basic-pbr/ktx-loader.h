@@ -21,6 +21,13 @@
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/images/pixel-data.h>
+#include <dali/public-api/rendering/texture.h>
+#include <stdint.h>
+#include <string>
+#include <utility>
+
+// INTERNAL INCLUDES
+#include "shared/mapped-file.h"
 
 using namespace Dali;
 
@@ -28,12 +35,98 @@ namespace PbrDemo
 {
 /**
  * @brief Stores the pixel data objects for each face of the cube texture and their mipmaps.
+ *
+ * The faces of array textures follow each other, i.e. img[arrayElement * numberOfFaces + face][mipmapLevel].
  */
 struct CubeData
 {
   std::vector<std::vector<Dali::PixelData> > img;
 };
 
+/**
+ * @brief Reads the images of a KTX (version 1) file.
+ *
+ * The file is mapped once and its header, key-value data and the sizes of every image are validated by Load(),
+ * so that no image read afterwards can go past the end of the file. The images are only copied out of the
+ * mapping when their PixelData is asked for, so uploading them one by one never needs more than one image
+ * in memory besides the mapping.
+ */
+class KtxFile
+{
+public:
+  KtxFile();
+
+  /**
+   * @brief Maps and validates a KTX file.
+   *
+   * @param[in] path The file path.
+   * @return true if the file is a valid 2D or cube map texture, with or without array elements, in a supported format.
+   */
+  bool Load(const std::string& path);
+
+  /**
+   * @brief Releases the file.
+   */
+  void Close();
+
+  uint32_t GetWidth(uint32_t mipmapLevel = 0u) const;
+
+  uint32_t GetHeight(uint32_t mipmapLevel = 0u) const;
+
+  uint32_t GetMipmapLevelCount() const;
+
+  /**
+   * @brief The number of faces, 6 for cube maps and 1 otherwise.
+   */
+  uint32_t GetFaceCount() const;
+
+  /**
+   * @brief The number of array elements, 1 for textures that are not arrays.
+   */
+  uint32_t GetArrayElementCount() const;
+
+  Pixel::Format GetPixelFormat() const;
+
+  /**
+   * @brief Retrieves a value of the key-value data, e.g. "KTXorientation".
+   *
+   * @param[in] key The key.
+   * @param[out] value The value, which may contain binary data.
+   * @return true if the key is in the file.
+   */
+  bool GetKeyValue(const std::string& key, std::string& value) const;
+
+  /**
+   * @brief Copies an image out of the file.
+   *
+   * @param[in] mipmapLevel The mipmap level.
+   * @param[in] face The face, in the order +X, -X, +Y, -Y, +Z, -Z for cube maps.
+   * @param[in] arrayElement The array element.
+   * @return The pixel data, or an empty handle if the file isn't loaded or the image doesn't exist.
+   */
+  PixelData GetPixelData(uint32_t mipmapLevel, uint32_t face, uint32_t arrayElement = 0u) const;
+
+private:
+  struct Image
+  {
+    size_t offset; ///< Within the file
+    size_t size;   ///< Including the padding of the rows
+  };
+
+  DemoHelper::MappedFile                            mFile;
+  std::vector<Image>                                mImages; ///< Indexed by (mipmapLevel * arrayElements + arrayElement) * faces + face
+  std::vector<std::pair<std::string, std::string> > mKeyValues;
+  Pixel::Format                                     mPixelFormat;
+  uint32_t                                          mWidth;
+  uint32_t                                          mHeight;
+  uint32_t                                          mMipmapLevelCount;
+  uint32_t                                          mFaceCount;
+  uint32_t                                          mArrayElementCount;
+  uint32_t                                          mBytesPerPixel;  ///< 0 for compressed formats
+  uint32_t                                          mTypeSize;       ///< Size of the components to swap, 1 if none
+  bool                                              mSwapEndianness; ///< Whether the file was written with the other endianness
+};
+
 /**
  * @brief Loads a cube map texture from a ktx file.
  *
@@ -42,6 +135,25 @@ struct CubeData
  */
 bool LoadCubeMapFromKtxFile(const std::string& path, CubeData& cubedata);
 
+/**
+ * @brief Creates a cube map texture from the first array element of a ktx file.
+ *
+ * @param[in] file The loaded file, with 6 faces.
+ * @param[in] firstMipmapLevel The level of the file uploaded as the first level of the texture; only this level and
+ *                             the smaller ones are uploaded, so a higher level makes a smaller, quicker texture.
+ * @return The texture, or an empty handle if the file isn't a cube map.
+ */
+Texture CreateCubeMapTexture(const KtxFile& file, uint32_t firstMipmapLevel = 0u);
+
+/**
+ * @brief Uploads one mipmap level of all the faces of a cube map from the first array element of a ktx file.
+ *
+ * @param[in] file The loaded file, with 6 faces.
+ * @param[in] texture A cube map texture with the size of the first level of @p file.
+ * @param[in] mipmapLevel The level uploaded.
+ */
+void UploadCubeMapLevel(const KtxFile& file, Texture texture, uint32_t mipmapLevel);
+
 } // namespace PbrDemo
 
 #endif //KTX_LOADER_H
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "mesh-cache.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/rendering/vertex-buffer.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// INTERNAL INCLUDES
+#include "obj-loader.h"
+#include "shared/mapped-file.h"
+
+namespace PbrDemo
+{
+namespace MeshCache
+{
+namespace
+{
+const char     CACHE_MAGIC[4]    = {'D', 'P', 'M', 'C'};
+const uint32_t CACHE_VERSION     = 2u;
+const char*    CACHE_EXTENSION   = ".dali-mesh";
+const char*    TEMPORARY_SUFFIX  = ".tmp";
+const uint32_t POSITION_FLOATS   = 3u;
+const uint32_t NORMAL_FLOATS     = 3u;
+const uint32_t TANGENT_FLOATS    = 3u;
+const uint32_t TEXTURE_UV_FLOATS = 2u;
+
+/**
+ * @brief The header at the start of a cache file.
+ *
+ * It is followed by the interleaved vertex data and then by the indices.
+ * Its size is a multiple of 8 so the data following it is suitably aligned in a mapping.
+ */
+struct CacheHeader
+{
+  char     magic[4];
+  uint32_t version;
+  uint64_t sourceSize;
+  int64_t  sourceModifiedTime;
+  uint32_t objectProperties;
+  uint32_t useSoftNormals;
+  uint32_t attributes;
+  uint32_t vertexCount;
+  uint32_t indexCount;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(CacheHeader) % 8 == 0, "CacheHeader must keep the vertex data aligned");
+
+uint32_t GetFloatsPerVertex(uint32_t attributes)
+{
+  uint32_t floats = POSITION_FLOATS + NORMAL_FLOATS;
+  if(attributes & ObjLoader::TANGENTS)
+  {
+    floats += TANGENT_FLOATS;
+  }
+  if(attributes & ObjLoader::TEXTURE_COORDINATES)
+  {
+    floats += TEXTURE_UV_FLOATS;
+  }
+  return floats;
+}
+
+bool GetSourceStatus(const std::string& modelUrl, uint64_t& size, int64_t& modifiedTime)
+{
+  struct stat status;
+  if(stat(modelUrl.c_str(), &status) != 0)
+  {
+    return false;
+  }
+
+  size         = static_cast<uint64_t>(status.st_size);
+  modifiedTime = static_cast<int64_t>(status.st_mtime);
+  return true;
+}
+
+} // namespace
+
+std::string GetCachePath(const std::string& modelUrl)
+{
+  return modelUrl + CACHE_EXTENSION;
+}
+
+Geometry Load(const std::string& modelUrl, int objectProperties, bool useSoftNormals)
+{
+  uint64_t sourceSize;
+  int64_t  sourceModifiedTime;
+  if(!GetSourceStatus(modelUrl, sourceSize, sourceModifiedTime))
+  {
+    return Geometry();
+  }
+
+  DemoHelper::MappedFile view(GetCachePath(modelUrl));
+  if(view.GetSize() < sizeof(CacheHeader))
+  {
+    return Geometry();
+  }
+
+  const CacheHeader& header = *reinterpret_cast<const CacheHeader*>(view.GetData());
+  if(memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+     header.version != CACHE_VERSION ||
+     header.sourceSize != sourceSize ||
+     header.sourceModifiedTime != sourceModifiedTime ||
+     header.objectProperties != static_cast<uint32_t>(objectProperties) ||
+     header.useSoftNormals != static_cast<uint32_t>(useSoftNormals))
+  {
+    return Geometry();
+  }
+
+  const size_t vertexBytes = static_cast<size_t>(header.vertexCount) * GetFloatsPerVertex(header.attributes) * sizeof(float);
+  const size_t indexBytes  = static_cast<size_t>(header.indexCount) * sizeof(unsigned short);
+  if(view.GetSize() != sizeof(CacheHeader) + vertexBytes + indexBytes)
+  {
+    DALI_LOG_ERROR("Mesh cache %s is truncated, ignoring it\n", GetCachePath(modelUrl).c_str());
+    return Geometry();
+  }
+
+  const uint8_t* vertexData = view.GetData() + sizeof(CacheHeader);
+  const uint8_t* indexData  = vertexData + vertexBytes;
+
+  return CreateGeometry(reinterpret_cast<const float*>(vertexData),
+                        header.vertexCount,
+                        reinterpret_cast<const unsigned short*>(indexData),
+                        header.indexCount,
+                        header.attributes);
+}
+
+bool Save(const std::string& modelUrl, int objectProperties, bool useSoftNormals, const MeshData& meshData)
+{
+  CacheHeader header;
+  memset(&header, 0, sizeof(header));
+  if(!GetSourceStatus(modelUrl, header.sourceSize, header.sourceModifiedTime))
+  {
+    return false;
+  }
+
+  memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  header.version          = CACHE_VERSION;
+  header.objectProperties = static_cast<uint32_t>(objectProperties);
+  header.useSoftNormals   = static_cast<uint32_t>(useSoftNormals);
+  header.attributes       = meshData.attributes;
+  header.vertexCount      = meshData.vertexCount;
+  header.indexCount       = meshData.indices.Count();
+
+  // Write to a temporary file first so that a reader never maps a partially written cache.
+  const std::string cachePath     = GetCachePath(modelUrl);
+  const std::string temporaryPath = cachePath + TEMPORARY_SUFFIX;
+
+  FILE* file = fopen(temporaryPath.c_str(), "wb");
+  if(!file)
+  {
+    return false;
+  }
+
+  bool written = (fwrite(&header, sizeof(header), 1u, file) == 1u);
+  if(written && meshData.vertices.Count())
+  {
+    written = (fwrite(meshData.vertices.Begin(), sizeof(float), meshData.vertices.Count(), file) == meshData.vertices.Count());
+  }
+  if(written && meshData.indices.Count())
+  {
+    written = (fwrite(meshData.indices.Begin(), sizeof(unsigned short), meshData.indices.Count(), file) == meshData.indices.Count());
+  }
+  written = (fclose(file) == 0) && written;
+
+  if(!written || rename(temporaryPath.c_str(), cachePath.c_str()) != 0)
+  {
+    remove(temporaryPath.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+Geometry CreateGeometry(const float* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount, unsigned int attributes)
+{
+  // The order of insertion defines the layout of the interleaved vertex.
+  Property::Map vertexFormat;
+  vertexFormat["aPosition"] = Property::VECTOR3;
+  vertexFormat["aNormal"]   = Property::VECTOR3;
+  if(attributes & ObjLoader::TANGENTS)
+  {
+    vertexFormat["aTangent"] = Property::VECTOR3;
+  }
+  if(attributes & ObjLoader::TEXTURE_COORDINATES)
+  {
+    vertexFormat["aTexCoord"] = Property::VECTOR2;
+  }
+
+  VertexBuffer vertexBuffer = VertexBuffer::New(vertexFormat);
+  vertexBuffer.SetData(vertices, vertexCount);
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+
+  //If indices are required, we set them.
+  if(indexCount)
+  {
+    geometry.SetIndexBuffer(indices, indexCount);
+  }
+
+  return geometry;
+}
+
+} // namespace MeshCache
+
+} // namespace PbrDemo
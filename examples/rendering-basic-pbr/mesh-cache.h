@@ -0,0 +1,94 @@
+#ifndef DALI_DEMO_PBR_MESH_CACHE_H
+#define DALI_DEMO_PBR_MESH_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/rendering/geometry.h>
+#include <string>
+
+using namespace Dali;
+
+namespace PbrDemo
+{
+/**
+ * @brief Interleaved vertex data and indices ready to be uploaded to a Geometry.
+ *
+ * Every vertex holds a position and a normal, followed by a tangent and texture coordinates
+ * when the corresponding ObjLoader::ObjectProperties bits are set in @e attributes.
+ */
+struct MeshData
+{
+  Dali::Vector<float>          vertices;
+  Dali::Vector<unsigned short> indices;
+  unsigned int                 attributes{0u};
+  unsigned int                 vertexCount{0u};
+};
+
+namespace MeshCache
+{
+/**
+ * @brief Retrieves the path of the cache file written next to a model.
+ *
+ * @param[in] modelUrl The path of the source model.
+ * @return The path of the cache file.
+ */
+std::string GetCachePath(const std::string& modelUrl);
+
+/**
+ * @brief Creates a geometry from the cache file of a model.
+ *
+ * The cache is memory mapped and its vertex data and indices are passed straight to the vertex and index buffers.
+ * The cache is only used if it was created from a source file with the same size and modification time,
+ * with the same @p objectProperties and @p useSoftNormals.
+ *
+ * @param[in] modelUrl The path of the source model.
+ * @param[in] objectProperties The ObjLoader::ObjectProperties the geometry was requested with.
+ * @param[in] useSoftNormals Whether the geometry was requested with soft normals.
+ * @return The geometry, or an empty handle if there is no valid cache.
+ */
+Geometry Load(const std::string& modelUrl, int objectProperties, bool useSoftNormals);
+
+/**
+ * @brief Writes the cache file of a model.
+ *
+ * @param[in] modelUrl The path of the source model.
+ * @param[in] objectProperties The ObjLoader::ObjectProperties the geometry was requested with.
+ * @param[in] useSoftNormals Whether the geometry was requested with soft normals.
+ * @param[in] meshData The data to store.
+ * @return true if the cache was written, false otherwise (e.g. the model directory is read-only).
+ */
+bool Save(const std::string& modelUrl, int objectProperties, bool useSoftNormals, const MeshData& meshData);
+
+/**
+ * @brief Creates a geometry with a single interleaved vertex buffer.
+ *
+ * @param[in] vertices The interleaved vertex data.
+ * @param[in] vertexCount The number of vertices.
+ * @param[in] indices The indices, may be null if @p indexCount is zero.
+ * @param[in] indexCount The number of indices.
+ * @param[in] attributes The ObjLoader::ObjectProperties present in each vertex.
+ * @return The geometry.
+ */
+Geometry CreateGeometry(const float* vertices, unsigned int vertexCount, const unsigned short* indices, unsigned int indexCount, unsigned int attributes);
+
+} // namespace MeshCache
+
+} // namespace PbrDemo
+
+#endif // DALI_DEMO_PBR_MESH_CACHE_H
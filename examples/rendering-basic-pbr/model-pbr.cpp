@@ -20,10 +20,12 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <dali/integration-api/debug.h>
 #include <string.h>
 #include <cstdio>
 
 // INTERNAL INCLUDES
+#include "mesh-cache.h"
 #include "obj-loader.h"
 
 namespace
@@ -38,6 +40,11 @@ struct Vertices
   Vector<Vector2> texCoords;
 };
 
+#if defined(DEBUG_ENABLED)
+// Export LOG_PBR_MESH_CACHE=1 to see when the mesh cache of a model can't be written.
+Debug::Filter* gMeshCacheFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_PBR_MESH_CACHE");
+#endif
+
 } // namespace
 
 ModelPbr::ModelPbr()
@@ -93,6 +100,11 @@ void ModelPbr::InitTexture(Texture albedoM, Texture normalR, Texture texDiffuse,
   mTextureSet.SetSampler(3, sampler);
 }
 
+void ModelPbr::SetSpecularTexture(Texture texSpecular)
+{
+  mTextureSet.SetTexture(3u, texSpecular);
+}
+
 Actor& ModelPbr::GetActor()
 {
   return mActor;
@@ -100,14 +112,23 @@ Actor& ModelPbr::GetActor()
 
 /**
  * Create geometry from OBJ path file
+ *
+ * The parsed model is cached in a binary file next to it, which is used instead on later launches.
  */
 Geometry ModelPbr::CreateGeometry(const std::string& url)
 {
+  const int  objectProperties = PbrDemo::ObjLoader::TEXTURE_COORDINATES | PbrDemo::ObjLoader::TANGENTS;
+  const bool useSoftNormals   = true;
+
+  Geometry geometry = PbrDemo::MeshCache::Load(url, objectProperties, useSoftNormals);
+  if(geometry)
+  {
+    return geometry;
+  }
+
   std::streampos     fileSize;
   Dali::Vector<char> fileContent;
 
-  Geometry geometry;
-
   if(FileLoader::ReadFile(url, fileSize, fileContent, FileLoader::TEXT))
   {
     PbrDemo::ObjLoader objLoader;
@@ -115,7 +136,16 @@ Geometry ModelPbr::CreateGeometry(const std::string& url)
     objLoader.ClearArrays();
     objLoader.LoadObject(fileContent.Begin(), fileSize);
 
-    geometry = objLoader.CreateGeometry(PbrDemo::ObjLoader::TEXTURE_COORDINATES | PbrDemo::ObjLoader::TANGENTS, true);
+    PbrDemo::MeshData meshData;
+    objLoader.CreateMeshData(objectProperties, useSoftNormals, meshData);
+
+    geometry = PbrDemo::MeshCache::CreateGeometry(meshData.vertices.Begin(), meshData.vertexCount, meshData.indices.Begin(), meshData.indices.Count(), meshData.attributes);
+
+
+    if(!PbrDemo::MeshCache::Save(url, objectProperties, useSoftNormals, meshData))
+    {
+      DALI_LOG_INFO(gMeshCacheFilter, Debug::General, "Unable to write mesh cache %s\n", PbrDemo::MeshCache::GetCachePath(url).c_str());
+    }
   }
 
   return geometry;
@@ -69,6 +69,13 @@ public:
    */
   void InitTexture(Texture albedoMetalTexture, Texture normalRoughTexture, Texture diffuseTexture, Texture specularTexture);
 
+  /**
+   * @brief Replaces the specular texture set by InitTexture().
+   *
+   * @param[in] specularTexture The specular texture.
+   */
+  void SetSpecularTexture(Texture specularTexture);
+
   /**
    * @brief Retrieves the actor created by calling the Init() method.
    *
@@ -76,15 +83,17 @@ public:
    */
   Actor& GetActor();
 
-private:
   /**
-   * @brief Creates a geometry from a @e obj model.
+   * @brief Creates a geometry from a @e obj model, from its mesh cache if it's valid, otherwise by parsing the model
+   * and writing the cache.
    *
    * @param[in] url A url pointing a file with a @e obj model.
    *
    * @return The geometry.
    */
-  Geometry CreateGeometry(const std::string& url);
+  static Geometry CreateGeometry(const std::string& url);
+
+private:
 
   Actor      mActor;
   TextureSet mTextureSet;
@@ -69,6 +69,13 @@ public:
    */
   void InitTexture(Texture texSkybox);
 
+  /**
+   * @brief Replaces the texture set by InitTexture().
+   *
+   * @param[in] texSkybox The skybox texture.
+   */
+  void SetTexture(Texture texSkybox);
+
   /**
    * @brief Retrieves the actor created by calling the Init() method.
    *
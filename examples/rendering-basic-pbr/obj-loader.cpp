@@ -21,15 +21,322 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <string.h>
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/decimal-number.h"
+#include "shared/worker-pool.h"
 
 namespace PbrDemo
 {
 namespace
 {
 const int MAX_POINT_INDICES = 4;
+
+const unsigned int MIN_ELEMENTS_PER_THREAD = 4096u; ///< Below this many triangles or vertices per thread, normals and tangents are calculated serially.
+
+/**
+ * @brief Number of each element found in the file, used to reserve the arrays before parsing.
+ */
+struct ElementCount
+{
+  unsigned int points{0u};
+  unsigned int normals{0u};
+  unsigned int tangents{0u};
+  unsigned int biTangents{0u};
+  unsigned int textures{0u};
+  unsigned int textures2{0u};
+  unsigned int triangles{0u};
+};
+
+inline bool IsSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsEndOfLine(char c)
+{
+  return c == '\n';
+}
+
+inline bool IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline const char* SkipSpaces(const char* it, const char* end)
+{
+  while(it < end && IsSpace(*it))
+  {
+    ++it;
+  }
+  return it;
+}
+
+/**
+ * @brief Moves to the first character after the current whitespace separated token.
+ */
+inline const char* SkipToken(const char* it, const char* end)
+{
+  while(it < end && !IsSpace(*it) && !IsEndOfLine(*it))
+  {
+    ++it;
+  }
+  return it;
+}
+
+/**
+ * @brief Moves to the first character of the next line.
+ */
+inline const char* SkipLine(const char* it, const char* end)
+{
+  const char* newLine = static_cast<const char*>(memchr(it, '\n', end - it));
+  return newLine ? newLine + 1 : end;
+}
+
+/**
+ * @brief Checks whether the token at @p it is exactly @p tag and, if so, moves @p it past it.
+ */
+inline bool MatchTag(const char*& it, const char* end, const char* tag)
+{
+  const char* cursor = it;
+  while(*tag != '\0')
+  {
+    if(cursor == end || *cursor != *tag)
+    {
+      return false;
+    }
+    ++cursor;
+    ++tag;
+  }
+
+  if(cursor < end && !IsSpace(*cursor) && !IsEndOfLine(*cursor))
+  {
+    return false;
+  }
+
+  it = cursor;
+  return true;
+}
+
+/**
+ * @brief Parses a signed decimal integer, leaving @p value as zero if there are no digits.
+ */
+inline const char* ParseInt(const char* it, const char* end, int& value)
+{
+  it = SkipSpaces(it, end);
+
+  bool negative = false;
+  if(it < end && (*it == '-' || *it == '+'))
+  {
+    negative = (*it == '-');
+    ++it;
+  }
+
+  int result = 0;
+  for(; it < end && IsDigit(*it); ++it)
+  {
+    result = result * 10 + (*it - '0');
+  }
+
+  value = negative ? -result : result;
+  return it;
 }
 
+/**
+ * @brief Parses a floating point number in plain or scientific notation, as the JSON reader does.
+ */
+inline const char* ParseFloat(const char* it, const char* end, float& value)
+{
+  DemoHelper::DecimalNumber number;
+  it    = DemoHelper::ParseDecimal(SkipSpaces(it, end), end, number);
+  value = DemoHelper::ToFloat(number);
+  return it;
+}
+
+/**
+ * @brief Counts the vertex attributes and triangles in the buffer without storing anything.
+ */
+void CountElements(const char* begin, const char* end, ElementCount& count)
+{
+  for(const char* line = begin; line < end; line = SkipLine(line, end))
+  {
+    const char* it = SkipSpaces(line, end);
+
+    if(MatchTag(it, end, "v"))
+    {
+      ++count.points;
+    }
+    else if(MatchTag(it, end, "vn"))
+    {
+      ++count.normals;
+    }
+    else if(MatchTag(it, end, "vt"))
+    {
+      ++count.textures;
+    }
+    else if(MatchTag(it, end, "f"))
+    {
+      int numIndices = 0;
+      for(it = SkipSpaces(it, end); (numIndices < MAX_POINT_INDICES) && (it < end) && !IsEndOfLine(*it); it = SkipSpaces(it, end))
+      {
+        it = SkipToken(it, end);
+        ++numIndices;
+      }
+      count.triangles += (numIndices == 4) ? 2u : (numIndices == 3) ? 1u : 0u;
+    }
+    else if(MatchTag(it, end, "#_#tangent"))
+    {
+      ++count.tangents;
+    }
+    else if(MatchTag(it, end, "#_#binormal"))
+    {
+      ++count.biTangents;
+    }
+    else if(MatchTag(it, end, "#_#vt1"))
+    {
+      ++count.textures2;
+    }
+  }
+}
+
+/**
+ * @brief The triangles using each vertex, stored contiguously per vertex in increasing triangle order.
+ *
+ * The triangles of vertex i are triangles[offsets[i]] to triangles[offsets[i + 1] - 1].
+ */
+struct TriangleAdjacency
+{
+  std::vector<unsigned int> offsets;
+  std::vector<unsigned int> triangles;
+};
+
+/**
+ * @brief Builds the adjacency between vertices and the triangles using them.
+ *
+ * @param[in] triangles The triangles of the object.
+ * @param[in] indices The member of ObjLoader::TriIndex holding the vertex indices to use.
+ * @param[in] numVertices The number of vertices.
+ * @param[out] adjacency The triangles using each vertex.
+ */
+void BuildTriangleAdjacency(const Dali::Vector<ObjLoader::TriIndex>& triangles, int (ObjLoader::TriIndex::*indices)[3], unsigned int numVertices, TriangleAdjacency& adjacency)
+{
+  const unsigned int numTriangles = triangles.Size();
+
+  adjacency.offsets.assign(numVertices + 1u, 0u);
+  adjacency.triangles.resize(3u * numTriangles);
+
+  for(unsigned int i = 0u; i < numTriangles; ++i)
+  {
+    for(unsigned int j = 0u; j < 3u; ++j)
+    {
+      ++adjacency.offsets[(triangles[i].*indices)[j] + 1];
+    }
+  }
+
+  for(unsigned int i = 0u; i < numVertices; ++i)
+  {
+    adjacency.offsets[i + 1u] += adjacency.offsets[i];
+  }
+
+  std::vector<unsigned int> cursor(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+  for(unsigned int i = 0u; i < numTriangles; ++i)
+  {
+    for(unsigned int j = 0u; j < 3u; ++j)
+    {
+      adjacency.triangles[cursor[(triangles[i].*indices)[j]]++] = i;
+    }
+  }
+}
+
+/**
+ * @brief Retrieves the number of threads worth using to process @p count elements.
+ */
+unsigned int GetThreadCount(unsigned int count)
+{
+  const unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  return std::min(maxThreads, count / MIN_ELEMENTS_PER_THREAD);
+}
+
+/**
+ * @brief Calls @p function(begin, end) over ranges of [0, count), split between the threads of a pool kept for the
+ * lifetime of the process.
+ *
+ * Small inputs are processed on the calling thread, as waking the workers would cost more than the work itself.
+ */
+template<typename Function>
+void ParallelFor(unsigned int count, Function function)
+{
+  if(GetThreadCount(count) <= 1u)
+  {
+    function(0u, count);
+    return;
+  }
+
+  // A pool runs one loop at a time, whichever thread the objects are loaded on
+  static DemoHelper::WorkerPool workerPool(std::max(1u, std::thread::hardware_concurrency()));
+  static std::mutex             workerPoolMutex;
+
+  std::lock_guard<std::mutex> lock(workerPoolMutex);
+  workerPool.Run(count, MIN_ELEMENTS_PER_THREAD, function);
+}
+
+/**
+ * @brief Adds the value of each triangle to the values of its three vertices, then calls @p finalise(vertex) for each vertex.
+ *
+ * When there are enough triangles to use several threads, each vertex gathers the values of its triangles instead of
+ * every triangle scattering its value. The triangles are visited in the same order either way, so the result is
+ * bit-identical to the serial calculation.
+ *
+ * @param[in] triangles The triangles of the object.
+ * @param[in] indices The member of ObjLoader::TriIndex holding the vertex indices to use.
+ * @param[in] faceValues The value of each triangle.
+ * @param[in, out] values The value of each vertex, usually initialised to zero.
+ * @param[in] finalise Called once per vertex after its value is accumulated.
+ */
+template<typename Finalise>
+void AccumulateFaceValues(const Dali::Vector<ObjLoader::TriIndex>& triangles, int (ObjLoader::TriIndex::*indices)[3], const Dali::Vector<Vector3>& faceValues, Dali::Vector<Vector3>& values, Finalise finalise)
+{
+  if(GetThreadCount(triangles.Size()) <= 1u)
+  {
+    for(unsigned int i = 0u; i < triangles.Size(); ++i)
+    {
+      for(unsigned int j = 0u; j < 3u; ++j)
+      {
+        values[(triangles[i].*indices)[j]] += faceValues[i];
+      }
+    }
+
+    for(unsigned int i = 0u; i < values.Size(); ++i)
+    {
+      finalise(i);
+    }
+    return;
+  }
+
+  TriangleAdjacency adjacency;
+  BuildTriangleAdjacency(triangles, indices, values.Size(), adjacency);
+
+  ParallelFor(values.Size(), [&adjacency, &faceValues, &values, &finalise](unsigned int begin, unsigned int end) {
+    for(unsigned int i = begin; i < end; ++i)
+    {
+      for(unsigned int k = adjacency.offsets[i]; k < adjacency.offsets[i + 1u]; ++k)
+      {
+        values[i] += faceValues[adjacency.triangles[k]];
+      }
+      finalise(i);
+    }
+  });
+}
+
+} // namespace
+
 ObjLoader::ObjLoader()
 : mSceneLoaded(false),
   mMaterialLoaded(false),
@@ -59,125 +366,130 @@ bool ObjLoader::IsMaterialLoaded()
 void ObjLoader::CalculateHardFaceNormals(const Dali::Vector<Vector3>& points, Dali::Vector<TriIndex>& triangles, Dali::Vector<Vector3>& normals)
 {
   int numFaceVertices = 3 * triangles.Size(); //Vertices per face, as each vertex has different normals instance for each face.
-  int normalIndex     = 0;                    //Tracks progress through the array of normals.
 
   normals.Clear();
   normals.Resize(numFaceVertices);
 
   //For each triangle, calculate the normal by crossing two vectors on the triangle's plane.
-  for(unsigned long i = 0; i < triangles.Size(); i++)
-  {
-    //Triangle vertices.
-    const Vector3& v0 = points[triangles[i].pointIndex[0]];
-    const Vector3& v1 = points[triangles[i].pointIndex[1]];
-    const Vector3& v2 = points[triangles[i].pointIndex[2]];
+  //Every triangle writes only its own three normals, so the triangles can be split freely between threads.
+  ParallelFor(triangles.Size(), [&points, &triangles, &normals](unsigned int begin, unsigned int end) {
+    for(unsigned int i = begin; i < end; i++)
+    {
+      //Triangle vertices.
+      const Vector3& v0 = points[triangles[i].pointIndex[0]];
+      const Vector3& v1 = points[triangles[i].pointIndex[1]];
+      const Vector3& v2 = points[triangles[i].pointIndex[2]];
 
-    //Triangle edges.
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
+      //Triangle edges.
+      Vector3 edge1 = v1 - v0;
+      Vector3 edge2 = v2 - v0;
 
-    //Using edges as vectors on the plane, cross product to get the normal.
-    Vector3 normalVector = edge1.Cross(edge2);
-    normalVector.Normalize();
+      //Using edges as vectors on the plane, cross product to get the normal.
+      Vector3 normalVector = edge1.Cross(edge2);
+      normalVector.Normalize();
 
-    //Assign normal index to triangle vertex and set the normal vector to the list of normals.
-    for(unsigned long j = 0; j < 3; j++, normalIndex++)
-    {
-      triangles[i].normalIndex[j] = normalIndex;
-      normals[normalIndex]        = normalVector;
+      //Assign normal index to triangle vertex and set the normal vector to the list of normals.
+      for(unsigned int j = 0, normalIndex = 3 * i; j < 3; j++, normalIndex++)
+      {
+        triangles[i].normalIndex[j] = normalIndex;
+        normals[normalIndex]        = normalVector;
+      }
     }
-  }
+  });
 }
 
 void ObjLoader::CalculateSoftFaceNormals(const Dali::Vector<Vector3>& points, Dali::Vector<TriIndex>& triangles, Dali::Vector<Vector3>& normals)
 {
-  int normalIndex = 0; //Tracks progress through the array of normals.
+  const unsigned int numTriangles = triangles.Size();
 
   normals.Clear();
   normals.Resize(points.Size()); //One (averaged) normal per point.
 
-  //For each triangle, calculate the normal by crossing two vectors on the triangle's plane
-  //We then add the triangle's normal to the cumulative normals at each point of it
-  for(unsigned long i = 0; i < triangles.Size(); i++)
-  {
-    //Triangle points.
-    const Vector3& v0 = points[triangles[i].pointIndex[0]];
-    const Vector3& v1 = points[triangles[i].pointIndex[1]];
-    const Vector3& v2 = points[triangles[i].pointIndex[2]];
+  //For each triangle, calculate the normal by crossing two vectors on the triangle's plane.
+  Dali::Vector<Vector3> faceNormals;
+  faceNormals.Resize(numTriangles);
 
-    //Triangle edges.
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
+  ParallelFor(numTriangles, [&points, &triangles, &faceNormals](unsigned int begin, unsigned int end) {
+    for(unsigned int i = begin; i < end; i++)
+    {
+      //Triangle points.
+      const Vector3& v0 = points[triangles[i].pointIndex[0]];
+      const Vector3& v1 = points[triangles[i].pointIndex[1]];
+      const Vector3& v2 = points[triangles[i].pointIndex[2]];
 
-    //Using edges as vectors on the plane, cross to get the normal.
-    Vector3 normalVector = edge1.Cross(edge2);
+      //Triangle edges.
+      Vector3 edge1 = v1 - v0;
+      Vector3 edge2 = v2 - v0;
 
-    //Add this triangle's normal to the cumulative normal of each constituent triangle point and set the index of the normal accordingly.
-    for(unsigned long j = 0; j < 3; j++)
-    {
-      normalIndex                 = triangles[i].pointIndex[j];
-      triangles[i].normalIndex[j] = normalIndex; //Normal index matches up to vertex index, as one normal per vertex.
-      normals[normalIndex] += normalVector;
+      //Using edges as vectors on the plane, cross to get the normal.
+      faceNormals[i] = edge1.Cross(edge2);
+
+      //Normal index matches up to vertex index, as one normal per vertex.
+      for(unsigned int j = 0; j < 3; j++)
+      {
+        triangles[i].normalIndex[j] = triangles[i].pointIndex[j];
+      }
     }
-  }
+  });
 
-  //Normalise the normals.
-  for(unsigned long i = 0; i < normals.Size(); i++)
-  {
+  //Add the normal of each triangle to the cumulative normal of its points, then normalise.
+  AccumulateFaceValues(triangles, &TriIndex::pointIndex, faceNormals, normals, [&normals](unsigned int i) {
     normals[i].Normalize();
-  }
+  });
 }
 
 void ObjLoader::CalculateTangentFrame()
 {
+  const unsigned int numTriangles = mTriangles.Size();
+
   //Reset tangent vector to hold new values.
   mTangents.Clear();
   mTangents.Resize(mNormals.Size());
 
-  //For each triangle, calculate the tangent vector and then add it to the total tangent vector of each normal.
-  for(unsigned long a = 0; a < mTriangles.Size(); a++)
-  {
-    Vector3 tangentVector;
+  //For each triangle, calculate the tangent vector.
+  Dali::Vector<Vector3> faceTangents;
+  faceTangents.Resize(numTriangles);
 
-    const Vector3& v0 = mPoints[mTriangles[a].pointIndex[0]];
-    const Vector3& v1 = mPoints[mTriangles[a].pointIndex[1]];
-    const Vector3& v2 = mPoints[mTriangles[a].pointIndex[2]];
+  ParallelFor(numTriangles, [this, &faceTangents](unsigned int begin, unsigned int end) {
+    for(unsigned int a = begin; a < end; a++)
+    {
+      Vector3& tangentVector = faceTangents[a];
 
-    Vector3 edge1 = v1 - v0;
-    Vector3 edge2 = v2 - v0;
+      const Vector3& v0 = mPoints[mTriangles[a].pointIndex[0]];
+      const Vector3& v1 = mPoints[mTriangles[a].pointIndex[1]];
+      const Vector3& v2 = mPoints[mTriangles[a].pointIndex[2]];
 
-    const Vector2& w0 = mTextureUv[mTriangles[a].textureIndex[0]];
-    const Vector2& w1 = mTextureUv[mTriangles[a].textureIndex[1]];
-    const Vector2& w2 = mTextureUv[mTriangles[a].textureIndex[2]];
+      Vector3 edge1 = v1 - v0;
+      Vector3 edge2 = v2 - v0;
 
-    float deltaU1 = w1.x - w0.x;
-    float deltaV1 = w1.y - w0.y;
-    float deltaU2 = w2.x - w0.x;
-    float deltaV2 = w2.y - w0.y;
+      const Vector2& w0 = mTextureUv[mTriangles[a].textureIndex[0]];
+      const Vector2& w1 = mTextureUv[mTriangles[a].textureIndex[1]];
+      const Vector2& w2 = mTextureUv[mTriangles[a].textureIndex[2]];
 
-    // 1.0/f could cause division by zero in some cases, this factor will act
-    // as a weight of the tangent vector and it is fixed when it is normalised.
-    float f = (deltaU1 * deltaV2 - deltaU2 * deltaV1);
+      float deltaU1 = w1.x - w0.x;
+      float deltaV1 = w1.y - w0.y;
+      float deltaU2 = w2.x - w0.x;
+      float deltaV2 = w2.y - w0.y;
 
-    tangentVector.x = f * (deltaV2 * edge1.x - deltaV1 * edge2.x);
-    tangentVector.y = f * (deltaV2 * edge1.y - deltaV1 * edge2.y);
-    tangentVector.z = f * (deltaV2 * edge1.z - deltaV1 * edge2.z);
+      // 1.0/f could cause division by zero in some cases, this factor will act
+      // as a weight of the tangent vector and it is fixed when it is normalised.
+      float f = (deltaU1 * deltaV2 - deltaU2 * deltaV1);
 
-    mTangents[mTriangles[a].normalIndex[0]] += tangentVector;
-    mTangents[mTriangles[a].normalIndex[1]] += tangentVector;
-    mTangents[mTriangles[a].normalIndex[2]] += tangentVector;
-  }
+      tangentVector.x = f * (deltaV2 * edge1.x - deltaV1 * edge2.x);
+      tangentVector.y = f * (deltaV2 * edge1.y - deltaV1 * edge2.y);
+      tangentVector.z = f * (deltaV2 * edge1.z - deltaV1 * edge2.z);
+    }
+  });
 
-  //Orthogonalize tangents.
-  for(unsigned long a = 0; a < mTangents.Size(); a++)
-  {
+  //Add the tangent vector of each triangle to the total tangent vector of each of its normals, then orthogonalize.
+  AccumulateFaceValues(mTriangles, &TriIndex::normalIndex, faceTangents, mTangents, [this](unsigned int a) {
     const Vector3& n = mNormals[a];
     const Vector3& t = mTangents[a];
 
     // Gram-Schmidt orthogonalize
     mTangents[a] = t - n * n.Dot(t);
     mTangents[a].Normalize();
-  }
+  });
 }
 
 void ObjLoader::CenterAndScale(bool center, Dali::Vector<Vector3>& points)
@@ -318,154 +630,125 @@ void ObjLoader::CreateGeometryArray(Dali::Vector<Vector3>&        positions,
 
 bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
 {
-  Vector3     point;
-  Vector2     texture;
-  std::string vet[MAX_POINT_INDICES], name;
-  int         ptIdx[MAX_POINT_INDICES];
-  int         nrmIdx[MAX_POINT_INDICES];
-  int         texIdx[MAX_POINT_INDICES];
-  TriIndex    triangle, triangle2;
-  int         pntAcum = 0, texAcum = 0, nrmAcum = 0;
-  bool        iniObj     = false;
-  bool        hasTexture = false;
-  int         face       = 0;
+  const char* begin = objBuffer;
+  const char* end   = objBuffer + static_cast<std::ptrdiff_t>(fileSize);
+
+  //The first line of the file is ignored.
+  begin = SkipLine(begin, end);
+
+  //Count the elements first so that each array is allocated only once.
+  ElementCount count;
+  CountElements(begin, end, count);
+
+  mPoints.Reserve(mPoints.Count() + count.points);
+  mNormals.Reserve(mNormals.Count() + count.normals);
+  mTangents.Reserve(mTangents.Count() + count.tangents);
+  mBiTangents.Reserve(mBiTangents.Count() + count.biTangents);
+  mTextureUv.Reserve(mTextureUv.Count() + count.textures);
+  mTextureUv2.Reserve(mTextureUv2.Count() + count.textures2);
+  mTriangles.Reserve(mTriangles.Count() + count.triangles);
+
+  Vector3  point;
+  Vector2  texture;
+  int      ptIdx[MAX_POINT_INDICES];
+  int      nrmIdx[MAX_POINT_INDICES];
+  int      texIdx[MAX_POINT_INDICES];
+  TriIndex triangle, triangle2;
+  int      pntAcum = 0, texAcum = 0, nrmAcum = 0;
+  bool     iniObj     = false;
+  bool     hasTexture = false;
 
   //Init AABB for the file
   mSceneAABB.Init();
 
-  std::string strMatActual;
-
-  std::string        input(objBuffer, fileSize);
-  std::istringstream ss(input);
-  ss.imbue(std::locale("C"));
-
-  std::string line;
-  std::getline(ss, line);
-
-  while(std::getline(ss, line))
+  for(const char* line = begin; line < end; line = SkipLine(line, end))
   {
-    std::istringstream isline(line, std::istringstream::in);
-    std::string        tag;
+    const char* it = SkipSpaces(line, end);
 
-    isline >> tag;
-
-    if(tag == "v")
+    if(MatchTag(it, end, "v"))
     {
-      //Two different objects in the same file
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      it = ParseFloat(it, end, point.x);
+      it = ParseFloat(it, end, point.y);
+      it = ParseFloat(it, end, point.z);
       mPoints.PushBack(point);
 
       mSceneAABB.ConsiderNewPointInVolume(point);
     }
-    else if(tag == "vn")
+    else if(MatchTag(it, end, "vn"))
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      it = ParseFloat(it, end, point.x);
+      it = ParseFloat(it, end, point.y);
+      it = ParseFloat(it, end, point.z);
 
       mNormals.PushBack(point);
     }
-    else if(tag == "#_#tangent")
+    else if(MatchTag(it, end, "#_#tangent"))
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      it = ParseFloat(it, end, point.x);
+      it = ParseFloat(it, end, point.y);
+      it = ParseFloat(it, end, point.z);
 
       mTangents.PushBack(point);
     }
-    else if(tag == "#_#binormal")
+    else if(MatchTag(it, end, "#_#binormal"))
     {
-      isline >> point.x;
-      isline >> point.y;
-      isline >> point.z;
+      it = ParseFloat(it, end, point.x);
+      it = ParseFloat(it, end, point.y);
+      it = ParseFloat(it, end, point.z);
 
       mBiTangents.PushBack(point);
     }
-    else if(tag == "vt")
+    else if(MatchTag(it, end, "vt"))
     {
-      isline >> texture.x;
-      isline >> texture.y;
+      it        = ParseFloat(it, end, texture.x);
+      it        = ParseFloat(it, end, texture.y);
       texture.y = 1.0 - texture.y;
       mTextureUv.PushBack(texture);
     }
-    else if(tag == "#_#vt1")
+    else if(MatchTag(it, end, "#_#vt1"))
     {
-      isline >> texture.x;
-      isline >> texture.y;
+      it = ParseFloat(it, end, texture.x);
+      it = ParseFloat(it, end, texture.y);
 
       texture.y = 1.0 - texture.y;
       mTextureUv2.PushBack(texture);
     }
-    else if(tag == "s")
-    {
-    }
-    else if(tag == "f")
+    else if(MatchTag(it, end, "f"))
     {
-      if(!iniObj)
-      {
-        //name assign
-
-        iniObj = true;
-      }
+      iniObj = true;
 
+      //Each index is of the form A, A/B, A/B/C or A//C; missing attributes are left as zero.
       int numIndices = 0;
-      while((numIndices < MAX_POINT_INDICES) && (isline >> vet[numIndices]))
+      for(it = SkipSpaces(it, end); (numIndices < MAX_POINT_INDICES) && (it < end) && !IsEndOfLine(*it); it = SkipSpaces(it, end))
       {
-        numIndices++;
-      }
-
-      //Hold slashes that separate attributes of the same point.
-      char separator;
-      char separator2;
-
-      const char* subString; //A pointer to the position in the string as we move through it.
+        bool hasTextureIndex = false;
 
-      subString = strstr(vet[0].c_str(), "/"); //Search for the first '/'
+        texIdx[numIndices] = 0;
+        nrmIdx[numIndices] = 0;
 
-      if(subString)
-      {
-        if(subString[1] == '/') // Of the form A//C, so has points and normals but no texture coordinates.
+        it = ParseInt(it, end, ptIdx[numIndices]);
+        if(it < end && *it == '/')
         {
-          for(int i = 0; i < numIndices; i++)
+          ++it;
+          if(it < end && *it != '/')
           {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> separator2 >> nrmIdx[i];
-            texIdx[i] = 0;
+            it              = ParseInt(it, end, texIdx[numIndices]);
+            hasTextureIndex = true;
           }
-        }
-        else if(strstr(subString, "/")) // Of the form A/B/C, so has points, textures and normals.
-        {
-          for(int i = 0; i < numIndices; i++)
+          if(it < end && *it == '/')
           {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> texIdx[i] >> separator2 >> nrmIdx[i];
+            it = ParseInt(it + 1, end, nrmIdx[numIndices]);
           }
-
-          hasTexture = true;
         }
-        else // Of the form A/B, so has points and textures but no normals.
-        {
-          for(int i = 0; i < numIndices; i++)
-          {
-            std::istringstream isindex(vet[i]);
-            isindex >> ptIdx[i] >> separator >> texIdx[i];
-            nrmIdx[i] = 0;
-          }
 
-          hasTexture = true;
-        }
-      }
-      else // Simply of the form A, as in, point indices only.
-      {
-        for(int i = 0; i < numIndices; i++)
+        //As the file is expected to use the same layout for every index, the first one decides.
+        if(numIndices == 0 && hasTextureIndex)
         {
-          std::istringstream isindex(vet[i]);
-          isindex >> ptIdx[i];
-          texIdx[i] = 0;
-          nrmIdx[i] = 0;
+          hasTexture = true;
         }
+
+        it = SkipToken(it, end);
+        numIndices++;
       }
 
       //If it is a triangle
@@ -478,7 +761,6 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
           triangle.textureIndex[i] = texIdx[i] - 1 - texAcum;
         }
         mTriangles.PushBack(triangle);
-        face++;
       }
       //If on the other hand it is a quad, we will create two triangles
       else if(numIndices == 4)
@@ -490,7 +772,6 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
           triangle.textureIndex[i] = texIdx[i] - 1 - texAcum;
         }
         mTriangles.PushBack(triangle);
-        face++;
 
         for(int i = 0; i < 3; i++)
         {
@@ -500,21 +781,8 @@ bool ObjLoader::LoadObject(char* objBuffer, std::streampos fileSize)
           triangle2.textureIndex[i] = texIdx[idx] - 1 - texAcum;
         }
         mTriangles.PushBack(triangle2);
-        face++;
       }
     }
-    else if(tag == "usemtl")
-    {
-      isline >> strMatActual;
-    }
-    else if(tag == "mtllib")
-    {
-      isline >> strMatActual;
-    }
-    else if(tag == "g")
-    {
-      isline >> name;
-    }
   }
 
   if(iniObj)
@@ -597,62 +865,66 @@ void ObjLoader::LoadMaterial(char*          objBuffer,
   mMaterialLoaded = true;
 }
 
-Geometry ObjLoader::CreateGeometry(int objectProperties, bool useSoftNormals)
+void ObjLoader::CreateMeshData(int objectProperties, bool useSoftNormals, MeshData& meshData)
 {
-  Geometry surface = Geometry::New();
-
-  Dali::Vector<Vector3>        positions;
-  Dali::Vector<Vector3>        normals;
-  Dali::Vector<Vector3>        tangents;
-  Dali::Vector<Vector2>        textures;
-  Dali::Vector<unsigned short> indices;
-
-  CreateGeometryArray(positions, normals, tangents, textures, indices, useSoftNormals);
-
-  //All vertices need at least Position and Normal
+  Dali::Vector<Vector3> positions;
+  Dali::Vector<Vector3> normals;
+  Dali::Vector<Vector3> tangents;
+  Dali::Vector<Vector2> textures;
 
-  Property::Map positionMap;
-  positionMap["aPosition"]    = Property::VECTOR3;
-  VertexBuffer positionBuffer = VertexBuffer::New(positionMap);
-  positionBuffer.SetData(positions.Begin(), positions.Count());
+  CreateGeometryArray(positions, normals, tangents, textures, meshData.indices, useSoftNormals);
 
-  Property::Map normalMap;
-  normalMap["aNormal"]      = Property::VECTOR3;
-  VertexBuffer normalBuffer = VertexBuffer::New(normalMap);
-  normalBuffer.SetData(normals.Begin(), normals.Count());
-
-  surface.AddVertexBuffer(positionBuffer);
-  surface.AddVertexBuffer(normalBuffer);
-
-  //Some need tangent
+  //All vertices need at least Position and Normal, some need tangent and texture coordinates.
+  meshData.attributes = 0u;
   if((objectProperties & TANGENTS) && mHasTextureUv)
   {
-    Property::Map tangentMap;
-    tangentMap["aTangent"]     = Property::VECTOR3;
-    VertexBuffer tangentBuffer = VertexBuffer::New(tangentMap);
-    tangentBuffer.SetData(tangents.Begin(), tangents.Count());
-
-    surface.AddVertexBuffer(tangentBuffer);
+    meshData.attributes |= TANGENTS;
   }
-
-  //Some need texture coordinates
   if((objectProperties & TEXTURE_COORDINATES) && mHasTextureUv)
   {
-    Property::Map textCoordMap;
-    textCoordMap["aTexCoord"]   = Property::VECTOR2;
-    VertexBuffer texCoordBuffer = VertexBuffer::New(textCoordMap);
-    texCoordBuffer.SetData(textures.Begin(), textures.Count());
-
-    surface.AddVertexBuffer(texCoordBuffer);
+    meshData.attributes |= TEXTURE_COORDINATES;
   }
 
-  //If indices are required, we set them.
-  if(indices.Size())
+  const bool         hasTangents     = meshData.attributes & TANGENTS;
+  const bool         hasTextures     = meshData.attributes & TEXTURE_COORDINATES;
+  const unsigned int floatsPerVertex = 6u + (hasTangents ? 3u : 0u) + (hasTextures ? 2u : 0u);
+  const unsigned int numVertices     = positions.Count();
+
+  meshData.vertexCount = numVertices;
+  meshData.vertices.Resize(numVertices * floatsPerVertex);
+
+  //Interleave the attributes in the order expected by MeshCache::CreateGeometry().
+  float* vertex = meshData.vertices.Begin();
+  for(unsigned int ui = 0; ui < numVertices; ++ui)
   {
-    surface.SetIndexBuffer(&indices[0], indices.Size());
+    *vertex++ = positions[ui].x;
+    *vertex++ = positions[ui].y;
+    *vertex++ = positions[ui].z;
+    *vertex++ = normals[ui].x;
+    *vertex++ = normals[ui].y;
+    *vertex++ = normals[ui].z;
+
+    if(hasTangents)
+    {
+      *vertex++ = tangents[ui].x;
+      *vertex++ = tangents[ui].y;
+      *vertex++ = tangents[ui].z;
+    }
+
+    if(hasTextures)
+    {
+      *vertex++ = textures[ui].x;
+      *vertex++ = textures[ui].y;
+    }
   }
+}
+
+Geometry ObjLoader::CreateGeometry(int objectProperties, bool useSoftNormals)
+{
+  MeshData meshData;
+  CreateMeshData(objectProperties, useSoftNormals, meshData);
 
-  return surface;
+  return MeshCache::CreateGeometry(meshData.vertices.Begin(), meshData.vertexCount, meshData.indices.Begin(), meshData.indices.Count(), meshData.attributes);
 }
 
 Vector3 ObjLoader::GetCenter()
@@ -22,6 +22,9 @@
 #include <dali/public-api/rendering/geometry.h>
 #include <limits>
 
+// INTERNAL INCLUDES
+#include "mesh-cache.h"
+
 using namespace Dali;
 
 namespace PbrDemo
@@ -77,6 +80,15 @@ public:
 
   void LoadMaterial(char* objBuffer, std::streampos fileSize, std::string& diffuseTextureUrl, std::string& normalTextureUrl, std::string& glossTextureUrl);
 
+  /**
+   * @brief Creates the interleaved vertex data and indices of the loaded object.
+   *
+   * @param[in] objectProperties The ObjectProperties requested for each vertex.
+   * @param[in] useSoftNormals Indicates whether we should average the normals at each point to smooth the surface or not.
+   * @param[out] meshData The vertex data and indices of the object.
+   */
+  void CreateMeshData(int objectProperties, bool useSoftNormals, MeshData& meshData);
+
   Geometry CreateGeometry(int objectProperties, bool useSoftNormals);
 
   Vector3 GetCenter();
@@ -19,14 +19,21 @@
 #include <dali-toolkit/dali-toolkit.h>
 
 #include <stdio.h>
+#include <chrono>
 #include <sstream>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 #include <dali/integration-api/debug.h>
 #include "ktx-loader.h"
+#include "mesh-cache.h"
 #include "model-pbr.h"
 #include "model-skybox.h"
+#include "obj-loader.h"
+#include "shared/benchmark-harness.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Toolkit;
@@ -62,6 +69,23 @@ const float   CAMERA_DEFAULT_NEAR(0.1f);
 const float   CAMERA_DEFAULT_FAR(1000.0f);
 const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
 
+const uint32_t     PREVIEW_CUBEMAP_SIZE(16u);        ///< Largest size of the specular cube map shown while the full one is uploaded
+const unsigned int PROGRESSIVE_UPLOAD_INTERVAL(16u); ///< Milliseconds between the uploads of two levels, about one frame
+
+const unsigned int BENCHMARK_RENDER_TIME(2000u); ///< Milliseconds of frames recorded after the parse benchmark
+
+bool         gProgressiveUpload(false);
+unsigned int gParseRepeats(20u);
+std::string  gParseModel;
+
+/**
+ * Milliseconds elapsed since the given time
+ */
+double GetMillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 } // namespace
 
 /*
@@ -73,13 +97,28 @@ const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
  * - Pan up/down on right side of screen to change metalness
  * - Pan anywhere else to rotate scene
  *
+ * Run with --progressive to show a small version of the environment straight away, while the full one
+ * is uploaded from its smallest mipmap level to its largest.
+ *
+ * With --timing-output, it times how long ObjLoader::LoadObject takes to parse each model, -r times over, then how
+ * long creating the geometry of each model takes without its mesh cache (cold, parsing the model and writing the
+ * cache) and with it (warm), as many times. It then records the frame times for a while and quits, e.g. to parse a
+ * larger model as well:
+ *
+ * ./rendering-basic-pbr.example --timing-output=pbr.json --obj=/path/to/large.obj -r50
+ *
 */
 
 class BasicPbrController : public ConnectionTracker
 {
 public:
-  BasicPbrController(Application& application)
+  /**
+   * @param[in] application The DALi application instance
+   * @param[in] harness Records the parse times of the models and the frame times, if given
+   */
+  BasicPbrController(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr)
   : mApplication(application),
+    mHarness(harness),
     mLabel(),
     m3dRoot(),
     mUiRoot(),
@@ -88,7 +127,8 @@ public:
     mRoughness(1.f),
     mMetalness(0.f),
     mDoubleTap(false),
-    mTeapotView(true)
+    mTeapotView(true),
+    mNextSpecularLevel(0u)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &BasicPbrController::Create);
@@ -102,6 +142,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     // Get a handle to the window
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::BLACK);
@@ -131,6 +173,108 @@ public:
 
     mDoubleTapTime = Timer::New(150);
     mDoubleTapTime.TickSignal().Connect(this, &BasicPbrController::OnDoubleTapTime);
+
+    if(mHarness)
+    {
+      mHarness->StartRecording(window.GetRootLayer());
+    }
+    if(mHarness && mHarness->IsRecording())
+    {
+      mHarness->StartPhase("parse");
+      AddParseTimes("parseSphere", SPHERE_URL);
+      AddParseTimes("parseTeapot", TEAPOT_URL);
+      if(!gParseModel.empty())
+      {
+        AddParseTimes("parseModel", gParseModel);
+      }
+
+      mHarness->StartPhase("meshCold");
+      AddMeshLoadTimes("coldLoadSphere", SPHERE_URL, false);
+      AddMeshLoadTimes("coldLoadTeapot", TEAPOT_URL, false);
+      if(!gParseModel.empty())
+      {
+        AddMeshLoadTimes("coldLoadModel", gParseModel, false);
+      }
+
+      mHarness->StartPhase("meshWarm");
+      AddMeshLoadTimes("warmLoadSphere", SPHERE_URL, true);
+      AddMeshLoadTimes("warmLoadTeapot", TEAPOT_URL, true);
+      if(!gParseModel.empty())
+      {
+        AddMeshLoadTimes("warmLoadModel", gParseModel, true);
+      }
+
+      mHarness->StartPhase("render");
+      mBenchmarkTimer = Timer::New(BENCHMARK_RENDER_TIME);
+      mBenchmarkTimer.TickSignal().Connect(this, &BasicPbrController::OnBenchmarkFinished);
+      mBenchmarkTimer.Start();
+    }
+  }
+
+  /**
+   * Times the parse of a model from memory, as many times as requested, and adds the times to the results
+   */
+  void AddParseTimes(const std::string& name, const std::string& url)
+  {
+    std::streampos     fileSize;
+    Dali::Vector<char> fileContent;
+    if(!FileLoader::ReadFile(url, fileSize, fileContent, FileLoader::TEXT))
+    {
+      DALI_LOG_ERROR("Unable to read %s\n", url.c_str());
+      return;
+    }
+
+    std::vector<double> times;
+    times.reserve(gParseRepeats);
+    for(unsigned int i = 0u; i < gParseRepeats; ++i)
+    {
+      PbrDemo::ObjLoader objLoader;
+      const auto         start = std::chrono::steady_clock::now();
+      objLoader.LoadObject(fileContent.Begin(), fileSize);
+      times.push_back(GetMillisecondsSince(start));
+    }
+    mHarness->AddSamples(name, std::move(times));
+  }
+
+  /**
+   * Times the creation of the geometry of a model, from its mesh cache if @p warm, otherwise after removing the cache,
+   * as many times as requested, and adds the times to the results
+   */
+  void AddMeshLoadTimes(const std::string& name, const std::string& url, bool warm)
+  {
+    const std::string cachePath = PbrDemo::MeshCache::GetCachePath(url);
+
+    std::vector<double> times;
+    times.reserve(gParseRepeats);
+    for(unsigned int i = 0u; i < gParseRepeats; ++i)
+    {
+      if(!warm)
+      {
+        remove(cachePath.c_str());
+      }
+      else if(FILE* cache = fopen(cachePath.c_str(), "rb"))
+      {
+        fclose(cache);
+      }
+      else
+      {
+        // Without a cache, a warm load would parse the model again
+        DALI_LOG_ERROR("Unable to write the mesh cache %s\n", cachePath.c_str());
+        return;
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+      ModelPbr::CreateGeometry(url);
+      times.push_back(GetMillisecondsSince(start));
+    }
+    mHarness->AddSamples(name, std::move(times));
+  }
+
+  bool OnBenchmarkFinished()
+  {
+    mHarness->FinishRecording();
+    mApplication.Quit();
+    return false;
   }
 
   bool OnDoubleTapTime()
@@ -348,29 +492,48 @@ public:
     textureNormalRough.Upload(normalPixelData, 0, 0, 0, 0, normalPixelData.GetWidth(), normalPixelData.GetHeight());
 
     // This texture should have 6 faces and only one mipmap
-    PbrDemo::CubeData diffuse;
-    PbrDemo::LoadCubeMapFromKtxFile(CUBEMAP_DIFFUSE_TEXTURE_URL, diffuse);
-
-    Texture diffuseTexture = Texture::New(TextureType::TEXTURE_CUBE, diffuse.img[0][0].GetPixelFormat(), diffuse.img[0][0].GetWidth(), diffuse.img[0][0].GetHeight());
-    for(unsigned int midmapLevel = 0; midmapLevel < diffuse.img[0].size(); ++midmapLevel)
+    PbrDemo::KtxFile diffuseFile;
+    Texture          diffuseTexture;
+    if(diffuseFile.Load(CUBEMAP_DIFFUSE_TEXTURE_URL))
     {
-      for(unsigned int i = 0; i < diffuse.img.size(); ++i)
-      {
-        diffuseTexture.Upload(diffuse.img[i][midmapLevel], CubeMapLayer::POSITIVE_X + i, midmapLevel, 0, 0, diffuse.img[i][midmapLevel].GetWidth(), diffuse.img[i][midmapLevel].GetHeight());
-      }
+      diffuseTexture = PbrDemo::CreateCubeMapTexture(diffuseFile);
+    }
+    else
+    {
+      DALI_LOG_ERROR("Failed to load %s\n", CUBEMAP_DIFFUSE_TEXTURE_URL);
     }
 
     // This texture should have 6 faces and 6 mipmaps
-    PbrDemo::CubeData specular;
-    PbrDemo::LoadCubeMapFromKtxFile(CUBEMAP_SPECULAR_TEXTURE_URL, specular);
-
-    Texture specularTexture = Texture::New(TextureType::TEXTURE_CUBE, specular.img[0][0].GetPixelFormat(), specular.img[0][0].GetWidth(), specular.img[0][0].GetHeight());
-    for(unsigned int midmapLevel = 0; midmapLevel < specular.img[0].size(); ++midmapLevel)
+    Texture specularTexture;
+    if(mSpecularFile.Load(CUBEMAP_SPECULAR_TEXTURE_URL))
     {
-      for(unsigned int i = 0; i < specular.img.size(); ++i)
+      if(gProgressiveUpload)
       {
-        specularTexture.Upload(specular.img[i][midmapLevel], CubeMapLayer::POSITIVE_X + i, midmapLevel, 0, 0, specular.img[i][midmapLevel].GetWidth(), specular.img[i][midmapLevel].GetHeight());
+        // Show the smallest levels straight away, and upload the full texture from its smallest level to its
+        // largest over the next frames; it replaces the preview once complete.
+        const uint32_t levelCount   = mSpecularFile.GetMipmapLevelCount();
+        uint32_t       previewLevel = 0u;
+        while(previewLevel + 1u < levelCount && mSpecularFile.GetWidth(previewLevel) > PREVIEW_CUBEMAP_SIZE)
+        {
+          ++previewLevel;
+        }
+        specularTexture = PbrDemo::CreateCubeMapTexture(mSpecularFile, previewLevel);
+
+        mSpecularTexture   = Texture::New(TextureType::TEXTURE_CUBE, mSpecularFile.GetPixelFormat(), mSpecularFile.GetWidth(), mSpecularFile.GetHeight());
+        mNextSpecularLevel = levelCount;
+        mUploadTimer       = Timer::New(PROGRESSIVE_UPLOAD_INTERVAL);
+        mUploadTimer.TickSignal().Connect(this, &BasicPbrController::OnUploadTimer);
+        mUploadTimer.Start();
       }
+      else
+      {
+        specularTexture = PbrDemo::CreateCubeMapTexture(mSpecularFile);
+        mSpecularFile.Close();
+      }
+    }
+    else
+    {
+      DALI_LOG_ERROR("Failed to load %s\n", CUBEMAP_SPECULAR_TEXTURE_URL);
     }
 
     mModel[0].InitTexture(textureAlbedoMetal, textureNormalRough, diffuseTexture, specularTexture);
@@ -378,6 +541,25 @@ public:
     mSkybox.InitTexture(specularTexture);
   }
 
+  /**
+   * Uploads the next larger level of the specular texture, and shows the texture once it is complete
+   */
+  bool OnUploadTimer()
+  {
+    --mNextSpecularLevel;
+    PbrDemo::UploadCubeMapLevel(mSpecularFile, mSpecularTexture, mNextSpecularLevel);
+    if(mNextSpecularLevel > 0u)
+    {
+      return true;
+    }
+
+    mModel[0].SetSpecularTexture(mSpecularTexture);
+    mModel[1].SetSpecularTexture(mSpecularTexture);
+    mSkybox.SetTexture(mSpecularTexture);
+    mSpecularFile.Close();
+    return false;
+  }
+
   /**
   * @brief Load a shader source file
   * @param[in] The path of the source file
@@ -434,7 +616,10 @@ public:
   }
 
 private:
-  Application& mApplication;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness* mHarness;
+  Timer                         mBenchmarkTimer;
+
   TextLabel    mLabel;
   Actor        m3dRoot;
   Actor        mUiRoot;
@@ -445,6 +630,11 @@ private:
   ModelSkybox mSkybox;
   ModelPbr    mModel[2];
 
+  PbrDemo::KtxFile mSpecularFile;      ///< Kept while the specular texture is uploaded progressively
+  Texture          mSpecularTexture;   ///< The full specular texture, while it is uploaded progressively
+  Timer            mUploadTimer;
+  uint32_t         mNextSpecularLevel; ///< The level uploaded after the next one
+
   Vector2 mPointZ;
   Vector2 mStartTouch;
 
@@ -455,10 +645,35 @@ private:
   bool       mTeapotView;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application        application = Application::New(&argc, &argv);
-  BasicPbrController test(application);
+  DemoHelper::BenchmarkHarness harness("rendering-basic-pbr", "rendering-basic-pbr.example");
+  harness.AddFlag("progressive", "--progressive", "Shows a small environment while the full one is uploaded", gProgressiveUpload);
+  harness.AddOption("parseRepeats", "-r", "Times each model is parsed with --timing-output", gParseRepeats);
+  harness.AddOption("parseModel", "--obj=", "An OBJ model parsed as well with --timing-output", gParseModel);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  Application application = Application::New(&argc, &argv);
+
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  BasicPbrController test(application, &harness);
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(BasicPbrController)
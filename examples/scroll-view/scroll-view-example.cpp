@@ -21,6 +21,8 @@
 // INTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -161,6 +163,8 @@ public:
    */
   void OnInit(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     Window window = app.GetWindow();
     window.KeyEventSignal().Connect(this, &ExampleController::OnKeyEvent);
 
@@ -582,6 +586,7 @@ private:
   Toolkit::PushButton mEffectChangeButton;        ///< Effect Change Button
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -589,3 +594,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ExampleController)
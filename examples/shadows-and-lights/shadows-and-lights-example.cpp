@@ -16,6 +16,8 @@
  */
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -141,6 +143,8 @@ public:
    */
   void Create(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     srand(0); // Want repeatable path
 
     app.GetWindow().KeyEventSignal().Connect(this, &TestApp::OnKeyEvent);
@@ -506,6 +510,7 @@ private:
 
 /*****************************************************************************/
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -513,3 +518,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(TestApp)
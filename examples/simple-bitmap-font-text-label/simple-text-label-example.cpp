@@ -26,6 +26,7 @@
 #include <dali-toolkit/devel-api/text/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -53,6 +54,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     window.KeyEventSignal().Connect(this, &SimpleTextLabelExample::OnKeyEvent);
@@ -18,6 +18,8 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali/dali.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -56,6 +58,8 @@ private:
    */
   void OnInit(Application& app)
   {
+    DemoHelper::StartExample(app);
+
     Window  window     = app.GetWindow();
     Vector2 windowSize = window.GetSize();
     window.SetBackgroundColor(Color::WHITE);
@@ -161,6 +165,7 @@ private:
   Application& mApplication; ///< Application instance
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application       app = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -168,3 +173,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   app.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(ExampleController)
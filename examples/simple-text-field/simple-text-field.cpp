@@ -24,6 +24,7 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/text-controls/text-field-devel.h>
 #include <iostream>
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -51,6 +52,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
     window.KeyEventSignal().Connect(this, &SimpleTextFieldExample::OnKeyEvent);
     window.SetBackgroundColor(Vector4(0.04f, 0.345f, 0.392f, 1.0f));
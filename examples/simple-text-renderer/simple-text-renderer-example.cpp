@@ -25,6 +25,8 @@
 #include <dali-toolkit/devel-api/text/text-utils-devel.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace std;
 using namespace Dali;
@@ -265,6 +267,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
     window.SetBackgroundColor(Vector4(0.04f, 0.345f, 0.392f, 1.0f));
@@ -331,6 +335,7 @@ private:
   Application& mApplication;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 /** Entry point for Linux & Tizen applications */
 int DALI_EXPORT_API main(int argc, char** argv)
 {
@@ -342,3 +347,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
 
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(SimpleTextRendererExample)
@@ -27,6 +27,7 @@
 
 // INTERNAL INCLUDES
 #include "simple-visuals-application.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -98,6 +99,8 @@ void SimpleVisualsApplication::OnKeyEvent(const KeyEvent& keyEvent)
 
 void SimpleVisualsApplication::Create(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   Window window = application.GetWindow();
   window.SetBackgroundColor(Vector4(0.1f, 0.1f, 0.1f, 1.0f));
 
@@ -24,6 +24,7 @@
 
 // INTERNAL INCLUDES
 #include "simple-visuals-application.h"
+#include "shared/example-plugin.h"
 
 namespace
 {
@@ -31,6 +32,7 @@ namespace
 const char* SIMPLE_DEMO_THEME(DEMO_STYLE_DIR "simple-example-theme.json");
 } // namespace
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                    application = Application::New(&argc, &argv, SIMPLE_DEMO_THEME); // Use the above defined style sheet for this application.
@@ -38,3 +40,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(Demo::SimpleVisualsApplication)
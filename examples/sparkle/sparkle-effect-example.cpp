@@ -20,10 +20,14 @@
 
 #include <algorithm>
 #include <chrono> // std::chrono::system_clock
+#include <iostream>
 #include <map>
 #include <random> // std::default_random_engine
 #include <sstream>
 
+#include "shared/benchmark-harness.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/utility.h"
 #include "sparkle-effect.h"
 
@@ -58,19 +62,40 @@ float Mix(const Vector2& range, float a)
 
 const Vector4 BACKGROUND_COLOR(0.f, 0.f, 0.05f, 1.f);
 
+const unsigned int BENCHMARK_WANDER_TIME(2000u); // milliseconds recorded before the fade animation
+
+unsigned int gParticleCount(NUM_PARTICLE);
+bool         gOpacityUniforms(false);
+
+/**
+ * Milliseconds elapsed since the given time
+ */
+double GetMillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 } // unnamed namespace
 
 // This example shows a sparkle particle effect
 //
+// With --timing-output, it records the frame times of the wander, fade and break animations, and how long
+// creating the effect and setting up the fade and break animations take, then quits, e.g. to compare the opacity
+// computed from one time uniform with an opacity uniform per particle:
+//
+// ./sparkle.example --sweep=particles=111,1000,10000 --sweep=opacityUniforms=0,1
+//
 class SparkleEffectExample : public ConnectionTracker
 {
 public:
   /**
    * Create the SparkleEffectExample
    * @param[in] application The DALi application instance
+   * @param[in] harness Records the frame times and the setup costs, if given
    */
-  SparkleEffectExample(Application& application)
+  SparkleEffectExample(Application& application, DemoHelper::BenchmarkHarness* harness = nullptr)
   : mApplication(application),
+    mHarness(harness),
     mAnimationIndex(0u),
     mShaking(false)
   {
@@ -84,19 +109,28 @@ private:
    */
   void OnInit(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
     window.KeyEventSignal().Connect(this, &SparkleEffectExample::OnKeyEvent);
     window.SetBackgroundColor(BACKGROUND_COLOR);
 
+    if(mHarness)
+    {
+      mHarness->StartRecording(window.GetRootLayer());
+    }
+
     mCircleBackground = ImageView::New(CIRCLE_BACKGROUND_IMAGE);
     mCircleBackground.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
     mCircleBackground.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
 
     window.Add(mCircleBackground);
 
-    mEffect = SparkleEffect::New();
+    const auto createStart = std::chrono::steady_clock::now();
+    mEffect                = SparkleEffect::New(gParticleCount, gOpacityUniforms);
 
     mMeshActor = CreateMeshActor();
+    AddSetupTime("createSetup", createStart);
 
     window.Add(mMeshActor);
 
@@ -112,6 +146,36 @@ private:
     mPanGestureDetector.Attach(mCircleBackground);
 
     PlayWanderAnimation(35.f);
+
+    if(mHarness && mHarness->IsRecording())
+    {
+      // Wander for a while, then fade out, then break; see OnFadeAnimationFinished and OnBreakAnimationFinished
+      mHarness->StartPhase("wander");
+      mBenchmarkTimer = Timer::New(BENCHMARK_WANDER_TIME);
+      mBenchmarkTimer.TickSignal().Connect(this, &SparkleEffectExample::OnBenchmarkWanderFinished);
+      mBenchmarkTimer.Start();
+    }
+  }
+
+  /**
+   * Callback of the benchmark timer, once the wander animation has been recorded
+   */
+  bool OnBenchmarkWanderFinished()
+  {
+    mHarness->StartPhase("fade");
+    PlayParticleFadeAnimation(0.f, 3.f);
+    return false;
+  }
+
+  /**
+   * Adds how long a setup took to the results, when recording
+   */
+  void AddSetupTime(const std::string& name, std::chrono::steady_clock::time_point start)
+  {
+    if(mHarness && mHarness->IsRecording())
+    {
+      mHarness->AddSamples(name, {GetMillisecondsSince(start)});
+    }
   }
 
   /**
@@ -120,23 +184,23 @@ private:
   Actor CreateMeshActor()
   {
     // shuffling to assign the color in random order
-    unsigned int* shuffleArray = new unsigned int[NUM_PARTICLE];
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+    unsigned int* shuffleArray = new unsigned int[gParticleCount];
+    for(unsigned int i = 0; i < gParticleCount; i++)
     {
-      shuffleArray[i] = i;
+      shuffleArray[i] = i % NUM_PARTICLE;
     }
     const unsigned int seed = std::chrono::system_clock::now().time_since_epoch().count();
-    std::shuffle(&shuffleArray[0], &shuffleArray[NUM_PARTICLE], std::default_random_engine(seed));
+    std::shuffle(&shuffleArray[0], &shuffleArray[gParticleCount], std::default_random_engine(seed));
 
     // Create vertices
 
     std::vector<Vertex>         vertices;
     std::vector<unsigned short> faces;
 
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+    for(unsigned int i = 0; i < gParticleCount; i++)
     {
       float colorIndex = GetColorIndex(shuffleArray[i]);
-      AddParticletoMesh(vertices, faces, PATHS[i], colorIndex);
+      AddParticletoMesh(vertices, faces, PATHS[i % NUM_PARTICLE], colorIndex);
     }
 
     delete[] shuffleArray;
@@ -275,7 +339,7 @@ private:
       {
         case 0:
         {
-          PlayParticleFadeAnimation(0, NUM_PARTICLE, 0.f, 3.f);
+          PlayParticleFadeAnimation(0.f, 3.f);
           break;
         }
         case 1:
@@ -364,29 +428,37 @@ private:
     breakAnimation.AnimateTo(Property(mMeshActor, Actor::Property::POSITION), ACTOR_POSITION, EaseOutSquare);
     breakAnimation.FinishedSignal().Connect(this, &SparkleEffectExample::OnBreakAnimationFinished);
 
-    float              timeUnit = duration / (NUM_PARTICLE + 1) / (NUM_PARTICLE + 1);
-    std::ostringstream oss;
-    for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+    // particle i appears from timeUnit*i*i/2, over timeUnit*i*i
+    const auto setupStart = std::chrono::steady_clock::now();
+    float      timeUnit   = duration / (gParticleCount + 1) / (gParticleCount + 1);
+    if(gOpacityUniforms)
+    {
+      std::ostringstream oss;
+      for(unsigned int i = 0; i < gParticleCount; i++)
+      {
+        oss.str("");
+        oss << OPACITY_UNIFORM_NAME << i << "]";
+        mEffect.SetProperty(mEffect.GetPropertyIndex(oss.str()), 0.01f);
+        float timeSlice = timeUnit * i * i;
+        breakAnimation.AnimateTo(Property(mEffect, oss.str()), 1.f, AlphaFunction::EASE_IN_OUT_SINE, TimePeriod(timeSlice * 0.5f, timeSlice));
+      }
+    }
+    else
     {
-      oss.str("");
-      oss << OPACITY_UNIFORM_NAME << i << "]";
-      mEffect.SetProperty(mEffect.GetPropertyIndex(oss.str()), 0.01f);
-      float timeSlice = timeUnit * i * i;
-      breakAnimation.AnimateTo(Property(mEffect, oss.str()), 1.f, AlphaFunction::EASE_IN_OUT_SINE, TimePeriod(timeSlice * 0.5f, timeSlice));
+      AnimateOpacity(breakAnimation, 0.01f, 1.f, Vector2(0.f, timeUnit * 0.5f), Vector2(0.f, timeUnit), true);
     }
+    AddSetupTime("breakSetup", setupStart);
 
     breakAnimation.Play();
   }
 
   /**
    * Animate the particle opacity
-   * Particles with index between startIndex ~ startIndex+numParticle-1 fade to the target opacity one after another
-   * @param[in] startIndex The index of the first particle
-   * @param[in] numParticle The number of particle to change opacity
+   * The particles fade to the target opacity one after another
    * @param[in] targetValue The final opacity
    * @param[in] duration The duration for the animation
    */
-  void PlayParticleFadeAnimation(unsigned int startIndex, unsigned int numParticle, float targetValue, float duration)
+  void PlayParticleFadeAnimation(float targetValue, float duration)
   {
     if(GetFloatUniformValue(BREAK_UNIFORM_NAME) > 0.f)
     {
@@ -394,25 +466,55 @@ private:
     }
 
     // start the opacity animation one particle after another gradually
-    float timeSlice    = duration / (numParticle + 1);
+    float timeSlice    = duration / (gParticleCount + 1);
     float fadeDuration = timeSlice > 0.5f ? timeSlice : 0.5f;
 
-    Animation          fadeAnimation = Animation::New(duration + fadeDuration * 2.f);
-    std::ostringstream oss;
-    for(unsigned int i = startIndex; i < numParticle; i++)
+    const auto setupStart    = std::chrono::steady_clock::now();
+    Animation  fadeAnimation = Animation::New(duration + fadeDuration * 2.f);
+    if(gOpacityUniforms)
     {
-      if(i >= NUM_PARTICLE) break; // out of bound
-
-      oss.str("");
-      oss << OPACITY_UNIFORM_NAME << i << "]";
-      fadeAnimation.AnimateTo(Property(mEffect, oss.str()), targetValue, TimePeriod(timeSlice * i, fadeDuration * 2.f));
+      std::ostringstream oss;
+      for(unsigned int i = 0; i < gParticleCount; i++)
+      {
+        oss.str("");
+        oss << OPACITY_UNIFORM_NAME << i << "]";
+        fadeAnimation.AnimateTo(Property(mEffect, oss.str()), targetValue, TimePeriod(timeSlice * i, fadeDuration * 2.f));
+      }
     }
+    else
+    {
+      // the previous opacity animation has finished, as the break animation is not playing
+      Vector2 range;
+      mEffect.GetProperty(mEffect.GetPropertyIndex(OPACITY_RANGE_UNIFORM_NAME)).Get(range);
+      AnimateOpacity(fadeAnimation, range.y, targetValue, Vector2(timeSlice, 0.f), Vector2(fadeDuration * 2.f, 0.f), false);
+    }
+    AddSetupTime("fadeSetup", setupStart);
 
     fadeAnimation.Play();
     mFadeAnimation = fadeAnimation;
     mFadeAnimation.FinishedSignal().Connect(this, &SparkleEffectExample::OnFadeAnimationFinished);
   }
 
+  /**
+   * Animate the opacity of all the particles through the time uniform
+   * Particle i changes opacity from delay.x*i + delay.y*i*i, over duration.x + duration.y*i*i
+   * @param[in] animation The animation, which drives the time uniform over its duration
+   * @param[in] from The opacity before the particle changes
+   * @param[in] to The opacity after the particle has changed
+   * @param[in] delay The coefficients of the delay
+   * @param[in] duration The coefficients of the duration
+   * @param[in] easeInOutSine Whether the change is eased as AlphaFunction::EASE_IN_OUT_SINE, linear otherwise
+   */
+  void AnimateOpacity(Animation& animation, float from, float to, const Vector2& delay, const Vector2& duration, bool easeInOutSine)
+  {
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_RANGE_UNIFORM_NAME), Vector2(from, to));
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_DELAY_UNIFORM_NAME), delay);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_DURATION_UNIFORM_NAME), duration);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_EASE_UNIFORM_NAME), easeInOutSine ? 1.f : 0.f);
+    mEffect.SetProperty(mEffect.GetPropertyIndex(OPACITY_TIME_UNIFORM_NAME), 0.f);
+    animation.AnimateTo(Property(mEffect, OPACITY_TIME_UNIFORM_NAME), animation.GetDuration());
+  }
+
   /**
    * Push the particles to the edge all around the circle then bounce back
    * @param[in] duration The duration for the animation
@@ -467,6 +569,12 @@ private:
   {
     mFadeAnimation.Clear();
     mFadeAnimation.Reset();
+
+    if(mHarness && mHarness->IsRecording())
+    {
+      mHarness->StartPhase("break");
+      PlayBreakAnimation(2.0f);
+    }
   }
 
   /**
@@ -475,6 +583,12 @@ private:
   void OnBreakAnimationFinished(Animation& animation)
   {
     mEffect.SetProperty(mEffect.GetPropertyIndex(BREAK_UNIFORM_NAME), 0.f);
+
+    if(mHarness && mHarness->IsRecording())
+    {
+      mHarness->FinishRecording();
+      mApplication.Quit();
+    }
   }
 
   /**
@@ -528,8 +642,9 @@ private:
   }
 
 private:
-  Application& mApplication;
-  Shader       mEffect;
+  Application&                  mApplication;
+  DemoHelper::BenchmarkHarness* mHarness;
+  Shader                        mEffect;
   ImageView    mCircleBackground;
   Actor        mMeshActor;
 
@@ -539,6 +654,7 @@ private:
   Animation mFadeAnimation;
   Animation mTapAnimation;
   Animation mTapAnimationAux;
+  Timer     mBenchmarkTimer;
 
   Vector2      mTapIndices;
   unsigned int mAnimationIndex;
@@ -547,10 +663,40 @@ private:
   std::map<Animation, int> mTapAnimationIndexPair;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application          application = Application::New(&argc, &argv);
-  SparkleEffectExample theApp(application);
+  DemoHelper::BenchmarkHarness harness("sparkle", "sparkle.example");
+  harness.AddOption("particles", "--particles=", "Number of particles", gParticleCount);
+  harness.AddFlag("opacityUniforms", "--opacity-uniforms", "Gives every particle its own opacity uniform, as many as the GPU allows", gOpacityUniforms);
+  if(!harness.Parse(argc, argv))
+  {
+    return 1;
+  }
+
+  if(gParticleCount < 1u || gParticleCount > MAXIMUM_PARTICLE_COUNT)
+  {
+    std::cerr << "The number of particles must be from 1 to " << MAXIMUM_PARTICLE_COUNT << std::endl;
+    return 1;
+  }
+
+  if(harness.IsSweep() && !harness.IsHelpRequested())
+  {
+    return harness.RunSweep();
+  }
+
+  Application application = Application::New(&argc, &argv);
+
+  if(harness.IsHelpRequested())
+  {
+    harness.PrintHelp();
+    return 0;
+  }
+
+  SparkleEffectExample theApp(application, &harness);
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(SparkleEffectExample)
@@ -34,8 +34,17 @@ namespace SparkleEffect
 const std::string PERCENTAGE_UNIFORM_NAME("uPercentage");
 // uniform array of particle color, set their value as the PARTICLE_COLORS given below
 const std::string PARTICLE_COLOR_UNIFORM_NAME("uParticleColors[");
-// uniform array of particle opacity
+// uniform array of particle opacity, only with the opacity uniforms, see New()
 const std::string OPACITY_UNIFORM_NAME("uOpacity[");
+// uniform which drives the opacity of every particle, the time in seconds since the opacity animation started
+const std::string OPACITY_TIME_UNIFORM_NAME("uOpacityTime");
+// uniform giving the opacity of the particles before and after the opacity animation
+const std::string OPACITY_RANGE_UNIFORM_NAME("uOpacityRange");
+// uniforms giving when each particle starts to change opacity and for how long, from its index i: x*i + y*i*i for the delay and x + y*i*i for the duration
+const std::string OPACITY_DELAY_UNIFORM_NAME("uOpacityDelay");
+const std::string OPACITY_DURATION_UNIFORM_NAME("uOpacityDuration");
+// uniform which eases the change of opacity in and out, as AlphaFunction::EASE_IN_OUT_SINE, when set to 1.0
+const std::string OPACITY_EASE_UNIFORM_NAME("uOpacityEase");
 // uniform which offsets the path control point, with this values >=0, the paths are squeezed towards the GatheringPoint
 const std::string ACCELARATION_UNIFORM_NAME("uAcceleration");
 // uniform which indicates the ongoing tap animations
@@ -188,6 +197,9 @@ MovingPath PATHS[] =
     {339, 348, 361, 465, 382, 477, 406, 442, 430, 406, 269, 369}};
 const unsigned int NUM_PARTICLE(sizeof(PATHS) / sizeof(PATHS[0]));
 
+// the particles beyond the number of paths reuse them; the four vertices of each are indexed by unsigned short
+const unsigned int MAXIMUM_PARTICLE_COUNT(65536u / 4u);
+
 const float PARTICLE_SIZE = 13.f;
 
 const float   ACTOR_SCALE = 0.704f; // resize 500*500 to 352*352, a bit smaller than 360*360
@@ -226,9 +238,16 @@ struct Vertex
 
 /**
    * Create a SparkleEffect object.
+   *
+   * The opacity of every particle is computed by the shader from its index and the opacity uniforms, driven by the
+   * single OPACITY_TIME_UNIFORM_NAME uniform. With @p opacityUniforms, every particle has its own opacity uniform
+   * instead, which limits the number of particles to the uniforms the GPU has.
+   *
+   * @param[in] particleCount The number of particles, up to MAXIMUM_PARTICLE_COUNT
+   * @param[in] opacityUniforms Whether the opacity of each particle is an element of the OPACITY_UNIFORM_NAME array
    * @return A handle to a newly allocated SparkleEffect
    */
-Shader New()
+Shader New(unsigned int particleCount = NUM_PARTICLE, bool opacityUniforms = false)
 {
   // clang-format off
     std::string vertexShader = DALI_COMPOSE_SHADER(
@@ -248,7 +267,6 @@ Shader New()
       uniform float uPercentage;\n
       uniform float uPercentageMarked;\n
       uniform vec3  uParticleColors[NUM_COLOR];\n
-      uniform float uOpacity[NUM_PARTICLE];\n
       uniform vec2  uTapIndices;
       uniform float uTapOffset[MAXIMUM_ANIMATION_COUNT];\n
       uniform vec2  uTapPoint[MAXIMUM_ANIMATION_COUNT];\n
@@ -265,7 +283,8 @@ Shader New()
         float idx = abs(aTexCoord.y)-1.0;\n
         \n
         // early out if the particle is invisible
-        if(uOpacity[int(idx)]<1e-5)\n
+        float opacity = GetOpacity(idx);\n
+        if(opacity<1e-5)\n
         {\n
           gl_Position = vec4(0.0);\n
           vColor = vec4(0.0);\n
@@ -306,7 +325,7 @@ Shader New()
           position = mix( position, edgePoint, uTapOffset[id] ) ;\n
         }\n
         \n
-        position = mix( position, vec2( 250.0,250.0 ),uBreak*(1.0-uOpacity[int(idx)]) ) ;
+        position = mix( position, vec2( 250.0,250.0 ),uBreak*(1.0-opacity) ) ;
         \n
         // vertex position on the mesh: (sign(aTexCoord.x), sign(aTexCoord.y))*PARTICLE_HALF_SIZE
         gl_Position = uMvpMatrix * vec4( position.x+sign(aTexCoord.x)*PARTICLE_HALF_SIZE/uScale,
@@ -316,7 +335,7 @@ Shader New()
         // we store the color index inside texCoord attribute
         float colorIndex = abs(aTexCoord.x);
         vColor.rgb = uParticleColors[int(colorIndex)-1];\n
-        vColor.a = fract(colorIndex) * uOpacity[int(idx)];\n
+        vColor.a = fract(colorIndex) * opacity;\n
         \n
         // produce a 'seemingly' random fade in/out
         percentage = mod(uPercentage+increment+0.15, 1.0);\n
@@ -327,6 +346,34 @@ Shader New()
       }\n
     );
 
+    // the opacity of each particle, as set in its own uniform
+    std::string opacityUniformsShader = DALI_COMPOSE_SHADER(
+      uniform float uOpacity[NUM_PARTICLE];\n
+      \n
+      float GetOpacity(float idx)\n
+      {\n
+        return uOpacity[int(idx)];\n
+      }\n
+    );
+
+    // the opacity of each particle, computed from its index and the time since the opacity animation started
+    std::string opacityTimeShader = DALI_COMPOSE_SHADER(
+      uniform float uOpacityTime;\n
+      uniform vec2  uOpacityRange;\n
+      uniform vec2  uOpacityDelay;\n
+      uniform vec2  uOpacityDuration;\n
+      uniform float uOpacityEase;\n
+      \n
+      float GetOpacity(float idx)\n
+      {\n
+        float delay = uOpacityDelay.x*idx + uOpacityDelay.y*idx*idx;\n
+        float duration = uOpacityDuration.x + uOpacityDuration.y*idx*idx;\n
+        float progress = duration > 0.0 ? clamp((uOpacityTime-delay)/duration, 0.0, 1.0) : step(delay, uOpacityTime);\n
+        progress = mix(progress, 0.5-0.5*cos(progress*3.14159265), uOpacityEase);\n
+        return mix(uOpacityRange.x, uOpacityRange.y, progress);\n
+      }\n
+    );
+
     std::string fragmentShader = DALI_COMPOSE_SHADER(
         precision highp float;\n
         uniform sampler2D sTexture;\n
@@ -344,9 +391,10 @@ Shader New()
 
   std::ostringstream vertexShaderStringStream;
   vertexShaderStringStream << "#define NUM_COLOR " << NUM_COLOR << "\n"
-                           << "#define NUM_PARTICLE " << NUM_PARTICLE << "\n"
+                           << "#define NUM_PARTICLE " << particleCount << "\n"
                            << "#define PARTICLE_HALF_SIZE " << PARTICLE_SIZE * ACTOR_SCALE / 2.f << "\n"
                            << "#define MAXIMUM_ANIMATION_COUNT " << MAXIMUM_ANIMATION_COUNT << "\n"
+                           << (opacityUniforms ? opacityUniformsShader : opacityTimeShader)
                            << vertexShader;
 
   Shader handle = Shader::New(vertexShaderStringStream.str(), fragmentShader);
@@ -364,11 +412,22 @@ Shader New()
 
   // set the initial uniform values
 
-  for(unsigned int i = 0; i < NUM_PARTICLE; i++)
+  if(opacityUniforms)
   {
-    oss.str("");
-    oss << OPACITY_UNIFORM_NAME << i << "]";
-    handle.RegisterProperty(oss.str(), 1.f);
+    for(unsigned int i = 0; i < particleCount; i++)
+    {
+      oss.str("");
+      oss << OPACITY_UNIFORM_NAME << i << "]";
+      handle.RegisterProperty(oss.str(), 1.f);
+    }
+  }
+  else
+  {
+    handle.RegisterProperty(OPACITY_TIME_UNIFORM_NAME, 0.f);
+    handle.RegisterProperty(OPACITY_RANGE_UNIFORM_NAME, Vector2(1.f, 1.f));
+    handle.RegisterProperty(OPACITY_DELAY_UNIFORM_NAME, Vector2::ZERO);
+    handle.RegisterProperty(OPACITY_DURATION_UNIFORM_NAME, Vector2::ZERO);
+    handle.RegisterProperty(OPACITY_EASE_UNIFORM_NAME, 0.f);
   }
   handle.RegisterProperty(PERCENTAGE_UNIFORM_NAME, 0.f);
   handle.RegisterProperty(ACCELARATION_UNIFORM_NAME, 0.f);
@@ -24,7 +24,9 @@
 
 // Internal includes
 #include "styling-application.h"
+#include "shared/example-plugin.h"
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   const char* themeName = Demo::StylingApplication::DEMO_THEME_ONE_PATH;
@@ -49,3 +51,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   }
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(Demo::StylingApplication)
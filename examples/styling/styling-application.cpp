@@ -30,6 +30,7 @@
 #include <cstdio>
 #include <sstream>
 #include "image-channel-control.h"
+#include "shared/example-startup.h"
 
 // Internal includes
 
@@ -114,6 +115,8 @@ StylingApplication::~StylingApplication()
 
 void StylingApplication::Create(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   Window window = application.GetWindow();
   window.KeyEventSignal().Connect(this, &StylingApplication::OnKeyEvent);
   window.SetBackgroundColor(Vector4(0.1f, 0.1f, 0.1f, 1.0f));
@@ -26,6 +26,8 @@
 #include <iostream>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -65,6 +67,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     window.SetBackgroundColor(Vector4(0.04f, 0.345f, 0.392f, 1.0f));
@@ -204,6 +208,7 @@ private:
   Popup     mPopup;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   // DALI_DEMO_THEME_PATH not passed to Application so TextField example uses default Toolkit style sheet.
@@ -212,3 +217,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(TextFieldExample)
@@ -31,6 +31,8 @@
 #include <iostream>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -147,6 +149,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window  window     = application.GetWindow();
     Vector2 windowSize = window.GetSize();
 
@@ -245,6 +249,7 @@ private:
   bool mToggle;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application      application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -252,3 +257,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(TextFontsExample)
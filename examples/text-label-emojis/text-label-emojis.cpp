@@ -22,6 +22,8 @@
 
 // INTERNAL INCLUDES
 #include "emoji-strings.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -55,6 +57,8 @@ public:
   // The Init signal is received once (only) during the Application lifetime
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
     window.SetBackgroundColor(Color::WHITE);
     window.KeyEventSignal().Connect(this, &EmojiExample::OnKeyEvent);
@@ -131,6 +135,7 @@ private:
   float        mLastPoint;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application  application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -138,3 +143,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(EmojiExample)
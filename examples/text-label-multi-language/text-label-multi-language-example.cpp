@@ -25,6 +25,8 @@
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -56,6 +58,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     window.KeyEventSignal().Connect(this, &TextLabelMultiLanguageExample::OnKeyEvent);
@@ -133,6 +137,7 @@ private:
   float        mLastPoint;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                   application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -140,3 +145,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(TextLabelMultiLanguageExample)
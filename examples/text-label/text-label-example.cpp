@@ -30,6 +30,8 @@
 
 // INTERNAL INCLUDES
 #include "expanding-buttons.h"
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/multi-language-strings.h"
 #include "shared/view.h"
 
@@ -198,6 +200,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     window.KeyEventSignal().Connect(this, &TextLabelExample::OnKeyEvent);
@@ -776,6 +780,7 @@ private:
   bool mCollapseColorsAndStyles;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application      application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -783,3 +788,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(TextLabelExample)
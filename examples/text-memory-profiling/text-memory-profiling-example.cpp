@@ -26,6 +26,8 @@
 #include <dali/dali.h>
 
 // INTERNAL INCLUDES
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -272,6 +274,8 @@ public:
    */
   void Create(Application& application)
   {
+    DemoHelper::StartExample(application);
+
     Window window = application.GetWindow();
 
     window.KeyEventSignal().Connect(this, &TextMemoryProfilingExample::OnKeyEvent);
@@ -417,6 +421,7 @@ private:
   unsigned int mCurrentTextStyle;
 };
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   Application                application = Application::New(&argc, &argv, DEMO_THEME_PATH);
@@ -424,3 +429,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(TextMemoryProfilingExample)
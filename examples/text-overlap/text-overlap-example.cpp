@@ -20,6 +20,8 @@
 #include <dali/devel-api/actors/actor-devel.h>
 
 #include <iostream>
+#include "shared/example-plugin.h"
+#include "shared/example-startup.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -38,6 +40,8 @@ TextOverlapController::TextOverlapController(Application& app)
 
 void TextOverlapController::Create(Application& app)
 {
+  DemoHelper::StartExample(app);
+
   Window window = app.GetWindow();
   window.KeyEventSignal().Connect(this, &TextOverlapController::OnKeyEvent);
 
@@ -151,6 +155,7 @@ void TextOverlapController::OnKeyEvent(const KeyEvent& keyEvent)
 
 } // namespace Demo
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   {
@@ -160,3 +165,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   }
   exit(0);
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(Demo::TextOverlapController)
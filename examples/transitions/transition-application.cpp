@@ -29,6 +29,7 @@
 #include <cstdio>
 #include <sstream>
 #include "shadow-button.h"
+#include "shared/example-startup.h"
 
 // Internal includes
 
@@ -66,6 +67,8 @@ TransitionApplication::~TransitionApplication()
 
 void TransitionApplication::Create(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   Window window = application.GetWindow();
   window.KeyEventSignal().Connect(this, &TransitionApplication::OnKeyEvent);
   window.SetBackgroundColor(Vector4(0.1f, 0.1f, 0.1f, 1.0f));
@@ -28,6 +28,7 @@
 #include <cstdio>
 #include <sstream>
 #include "beat-control.h"
+#include "shared/example-startup.h"
 
 // Internal includes
 
@@ -67,6 +68,8 @@ TransitionApplication::~TransitionApplication()
 
 void TransitionApplication::Create(Application& application)
 {
+  DemoHelper::StartExample(application);
+
   Window window = application.GetWindow();
   window.KeyEventSignal().Connect(this, &TransitionApplication::OnKeyEvent);
   window.SetBackgroundColor(Vector4(0.1f, 0.1f, 0.1f, 1.0f));
@@ -24,7 +24,9 @@
 
 // Internal includes
 #include "transition-application.h"
+#include "shared/example-plugin.h"
 
+#ifndef DALI_DEMO_BUILD_PLUGIN
 int DALI_EXPORT_API main(int argc, char** argv)
 {
   const char* themeName = Demo::TransitionApplication::DEMO_THEME_ONE_PATH;
@@ -34,3 +36,6 @@ int DALI_EXPORT_API main(int argc, char** argv)
   application.MainLoop();
   return 0;
 }
+#endif
+
+DALI_DEMO_EXAMPLE_PLUGIN(Demo::TransitionApplication)
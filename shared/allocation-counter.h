@@ -0,0 +1,151 @@
+#ifndef DALI_DEMO_ALLOCATION_COUNTER_H
+#define DALI_DEMO_ALLOCATION_COUNTER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+
+namespace DemoHelper
+{
+/**
+ * @brief Counts the heap allocations made with operator new, per thread, when an example executable is built with
+ * ENABLE_ALLOCATION_COUNTING, which defines DALI_DEMO_COUNT_ALLOCATIONS.
+ *
+ * The example replaces the global operator new with DALI_DEMO_ALLOCATION_COUNTER(), next to its main. Replacing it in
+ * the executable also counts the allocations DALi makes on behalf of the example. Plugins are built without the flag,
+ * as only the executable may replace operator new for the process.
+ *
+ * Allocations are counted on the thread that makes them, so the count of the event thread isn't disturbed by the
+ * update and render threads:
+ * @code
+ * const uint64_t before = DemoHelper::AllocationCounter::GetThreadAllocationCount();
+ * DoSomething();
+ * const uint64_t allocations = DemoHelper::AllocationCounter::GetThreadAllocationCount() - before;
+ * @endcode
+ */
+namespace AllocationCounter
+{
+inline thread_local uint64_t gThreadAllocationCount = 0u;
+
+/**
+ * @brief Whether the allocations are counted; if not, GetThreadAllocationCount() is always 0.
+ */
+constexpr bool IsEnabled()
+{
+#ifdef DALI_DEMO_COUNT_ALLOCATIONS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief The number of allocations made with operator new on the calling thread so far.
+ */
+inline uint64_t GetThreadAllocationCount()
+{
+  return gThreadAllocationCount;
+}
+
+} // namespace AllocationCounter
+
+} // namespace DemoHelper
+
+#ifdef DALI_DEMO_COUNT_ALLOCATIONS
+
+namespace DemoHelper
+{
+namespace AllocationCounter
+{
+inline void* Allocate(std::size_t size) noexcept
+{
+  ++gThreadAllocationCount;
+  return malloc(size ? size : 1u);
+}
+
+inline void* AllocateOrThrow(std::size_t size)
+{
+  void* memory = Allocate(size);
+  if(!memory)
+  {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+} // namespace AllocationCounter
+
+} // namespace DemoHelper
+
+/**
+ * @brief Replaces the global operator new and delete with ones counting the allocations, in the executable of an example.
+ *
+ * The aligned forms of the standard library aren't replaced; they allocate with aligned_alloc(), which free() releases.
+ */
+#define DALI_DEMO_ALLOCATION_COUNTER()                                                  \
+  void* operator new(std::size_t size)                                                  \
+  {                                                                                     \
+    return DemoHelper::AllocationCounter::AllocateOrThrow(size);                        \
+  }                                                                                     \
+  void* operator new[](std::size_t size)                                                \
+  {                                                                                     \
+    return DemoHelper::AllocationCounter::AllocateOrThrow(size);                        \
+  }                                                                                     \
+  void* operator new(std::size_t size, const std::nothrow_t&) noexcept                  \
+  {                                                                                     \
+    return DemoHelper::AllocationCounter::Allocate(size);                               \
+  }                                                                                     \
+  void* operator new[](std::size_t size, const std::nothrow_t&) noexcept                \
+  {                                                                                     \
+    return DemoHelper::AllocationCounter::Allocate(size);                               \
+  }                                                                                     \
+  void operator delete(void* memory) noexcept                                           \
+  {                                                                                     \
+    free(memory);                                                                       \
+  }                                                                                     \
+  void operator delete[](void* memory) noexcept                                         \
+  {                                                                                     \
+    free(memory);                                                                       \
+  }                                                                                     \
+  void operator delete(void* memory, std::size_t) noexcept                              \
+  {                                                                                     \
+    free(memory);                                                                       \
+  }                                                                                     \
+  void operator delete[](void* memory, std::size_t) noexcept                            \
+  {                                                                                     \
+    free(memory);                                                                       \
+  }                                                                                     \
+  void operator delete(void* memory, const std::nothrow_t&) noexcept                    \
+  {                                                                                     \
+    free(memory);                                                                       \
+  }                                                                                     \
+  void operator delete[](void* memory, const std::nothrow_t&) noexcept                  \
+  {                                                                                     \
+    free(memory);                                                                       \
+  }
+
+#else
+
+#define DALI_DEMO_ALLOCATION_COUNTER()
+
+#endif // DALI_DEMO_COUNT_ALLOCATIONS
+
+#endif // DALI_DEMO_ALLOCATION_COUNTER_H
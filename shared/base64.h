@@ -0,0 +1,327 @@
+#ifndef DALI_DEMO_BASE64_H
+#define DALI_DEMO_BASE64_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DEMO_BASE64_NEON
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define DEMO_BASE64_SSSE3
+#endif
+
+namespace DemoHelper
+{
+/**
+ * @brief Decoding of base64 text, e.g. the payload of a data uri.
+ *
+ * DecodeBase64() decodes blocks of characters with NEON (64 at a time) or SSSE3 (16 at a time), whichever the
+ * target is compiled for, and the rest with DecodeBase64Scalar(). Both give the same output and accept the
+ * same text: the standard alphabet, optionally padded with '='.
+ */
+namespace Base64
+{
+/**
+ * @brief The instruction set DecodeBase64() uses for its blocks, if any.
+ */
+#if defined(DEMO_BASE64_NEON)
+const char* const SIMD_NAME("NEON");
+#elif defined(DEMO_BASE64_SSSE3)
+const char* const SIMD_NAME("SSSE3");
+#else
+const char* const SIMD_NAME("none");
+#endif
+
+namespace Detail
+{
+/**
+ * @brief Maps base64 characters to their 6 bit value, anything else to 0xff.
+ */
+struct Table
+{
+  constexpr Table()
+  : values()
+  {
+    for(auto& value : values)
+    {
+      value = 0xff;
+    }
+    for(uint8_t i = 0u; i < 26u; ++i)
+    {
+      values['A' + i] = i;
+      values['a' + i] = 26u + i;
+    }
+    for(uint8_t i = 0u; i < 10u; ++i)
+    {
+      values['0' + i] = 52u + i;
+    }
+    values[uint8_t('+')] = 62u;
+    values[uint8_t('/')] = 63u;
+  }
+
+  uint8_t values[256];
+};
+
+constexpr Table TABLE{};
+
+const char* const ALPHABET("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+
+/**
+ * @brief Removes the padding and sizes the output for the rest of the text.
+ * @return False if the text can't be base64.
+ */
+inline bool Prepare(const char* text, size_t& length, std::vector<uint8_t>& output)
+{
+  while(length && text[length - 1u] == '=')
+  {
+    --length;
+  }
+  if(length % 4u == 1u)
+  {
+    return false;
+  }
+
+  output.resize(length / 4u * 3u + (length % 4u ? length % 4u - 1u : 0u));
+  return true;
+}
+
+/**
+ * @brief Decodes 4 characters into 3 bytes; invalid characters set bits 6 or 7 of @p invalid.
+ */
+inline void DecodeGroup(const uint8_t* in, uint8_t* out, uint32_t& invalid)
+{
+  const uint32_t a = TABLE.values[in[0]];
+  const uint32_t b = TABLE.values[in[1]];
+  const uint32_t c = TABLE.values[in[2]];
+  const uint32_t d = TABLE.values[in[3]];
+  invalid |= a | b | c | d;
+
+  const uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+  out[0]                = uint8_t(triple >> 16);
+  out[1]                = uint8_t(triple >> 8);
+  out[2]                = uint8_t(triple);
+}
+
+/**
+ * @brief Decodes the characters from @p src to @p end, which don't have to be a whole number of groups.
+ * @return False if any character is invalid.
+ */
+inline bool DecodeTail(const uint8_t* src, const uint8_t* end, uint8_t* dst)
+{
+  uint32_t invalid = 0u;
+  for(; end - src >= 4; src += 4, dst += 3)
+  {
+    DecodeGroup(src, dst, invalid);
+  }
+
+  // 2 or 3 characters remaining encode 1 or 2 bytes
+  if(end != src)
+  {
+    uint8_t tail[4] = {'A', 'A', 'A', 'A'};
+    uint8_t bytes[3];
+    std::copy(src, end, tail);
+    DecodeGroup(tail, bytes, invalid);
+    std::copy(bytes, bytes + (end - src) - 1, dst);
+  }
+
+  return (invalid & 0xc0u) == 0u;
+}
+
+#if defined(DEMO_BASE64_NEON)
+
+/**
+ * @brief Maps 16 characters to their 6 bit values, by the range each is in; invalid characters set their lane of @p invalid.
+ */
+inline uint8x16_t Translate(uint8x16_t characters, uint8x16_t& invalid)
+{
+  const uint8x16_t upper = vandq_u8(vcgeq_u8(characters, vdupq_n_u8('A')), vcleq_u8(characters, vdupq_n_u8('Z')));
+  const uint8x16_t lower = vandq_u8(vcgeq_u8(characters, vdupq_n_u8('a')), vcleq_u8(characters, vdupq_n_u8('z')));
+  const uint8x16_t digit = vandq_u8(vcgeq_u8(characters, vdupq_n_u8('0')), vcleq_u8(characters, vdupq_n_u8('9')));
+  const uint8x16_t plus  = vceqq_u8(characters, vdupq_n_u8('+'));
+  const uint8x16_t slash = vceqq_u8(characters, vdupq_n_u8('/'));
+
+  // the offsets wrap around, e.g. 'A' + 191 == 0
+  uint8x16_t offset = vandq_u8(upper, vdupq_n_u8(uint8_t(0u - 'A')));
+  offset            = vorrq_u8(offset, vandq_u8(lower, vdupq_n_u8(uint8_t(26u - 'a'))));
+  offset            = vorrq_u8(offset, vandq_u8(digit, vdupq_n_u8(uint8_t(52u - '0'))));
+  offset            = vorrq_u8(offset, vandq_u8(plus, vdupq_n_u8(uint8_t(62u - '+'))));
+  offset            = vorrq_u8(offset, vandq_u8(slash, vdupq_n_u8(uint8_t(63u - '/'))));
+
+  const uint8x16_t valid = vorrq_u8(vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, plus)), slash);
+  invalid                = vorrq_u8(invalid, vmvnq_u8(valid));
+  return vaddq_u8(characters, offset);
+}
+
+/**
+ * @brief Decodes as many blocks of 64 characters as there are, into 48 bytes each.
+ * @return False if any character is invalid.
+ */
+inline bool DecodeBlocks(const uint8_t*& src, const uint8_t* end, uint8_t*& dst)
+{
+  uint8x16_t invalid = vdupq_n_u8(0u);
+  for(; end - src >= 64; src += 64, dst += 48)
+  {
+    // the first, second, third and fourth characters of 16 groups
+    uint8x16x4_t characters = vld4q_u8(src);
+    const uint8x16_t a      = Translate(characters.val[0], invalid);
+    const uint8x16_t b      = Translate(characters.val[1], invalid);
+    const uint8x16_t c      = Translate(characters.val[2], invalid);
+    const uint8x16_t d      = Translate(characters.val[3], invalid);
+
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+    vst3q_u8(dst, bytes);
+  }
+
+  const uint64x2_t lanes = vreinterpretq_u64_u8(invalid);
+  return (vgetq_lane_u64(lanes, 0) | vgetq_lane_u64(lanes, 1)) == 0u;
+}
+
+#elif defined(DEMO_BASE64_SSSE3)
+
+/**
+ * @brief Whether each of the characters is within [first, last]; the signed comparisons reject characters over 127.
+ */
+inline __m128i InRange(__m128i characters, char first, char last)
+{
+  return _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8(char(first - 1))), _mm_cmplt_epi8(characters, _mm_set1_epi8(char(last + 1))));
+}
+
+/**
+ * @brief Maps 16 characters to their 6 bit values, by the range each is in; invalid characters set their lane of @p invalid.
+ */
+inline __m128i Translate(__m128i characters, __m128i& invalid)
+{
+  const __m128i upper = InRange(characters, 'A', 'Z');
+  const __m128i lower = InRange(characters, 'a', 'z');
+  const __m128i digit = InRange(characters, '0', '9');
+  const __m128i plus  = _mm_cmpeq_epi8(characters, _mm_set1_epi8('+'));
+  const __m128i slash = _mm_cmpeq_epi8(characters, _mm_set1_epi8('/'));
+
+  __m128i offset = _mm_and_si128(upper, _mm_set1_epi8(char(0 - 'A')));
+  offset         = _mm_or_si128(offset, _mm_and_si128(lower, _mm_set1_epi8(char(26 - 'a'))));
+  offset         = _mm_or_si128(offset, _mm_and_si128(digit, _mm_set1_epi8(char(52 - '0'))));
+  offset         = _mm_or_si128(offset, _mm_and_si128(plus, _mm_set1_epi8(char(62 - '+'))));
+  offset         = _mm_or_si128(offset, _mm_and_si128(slash, _mm_set1_epi8(char(63 - '/'))));
+
+  const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, plus)), slash);
+  invalid             = _mm_or_si128(invalid, _mm_andnot_si128(valid, _mm_set1_epi8(char(0xff))));
+  return _mm_add_epi8(characters, offset);
+}
+
+/**
+ * @brief Decodes blocks of 16 characters into 12 bytes each, while at least 24 characters are left.
+ *
+ * Each block is stored as 16 bytes, so the last 4 are overwritten by the next block or the tail; 24 characters
+ * decode to at least 16 bytes, so the store stays within the output.
+ *
+ * @return False if any character is invalid.
+ */
+inline bool DecodeBlocks(const uint8_t*& src, const uint8_t* end, uint8_t*& dst)
+{
+  __m128i invalid = _mm_setzero_si128();
+  for(; end - src >= 24; src += 16, dst += 12)
+  {
+    const __m128i values = Translate(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), invalid);
+
+    // a * 64 + b and c * 64 + d in 16 bits, then the 24 bits of each group in 32 bits
+    const __m128i pairs  = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+    // the three bytes of each group, most significant first
+    const __m128i bytes = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+  }
+
+  return _mm_movemask_epi8(invalid) == 0;
+}
+
+#endif
+
+} // namespace Detail
+
+/**
+ * @brief Decodes base64 text into @p output, one group of 4 characters at a time.
+ * @return False if the text isn't valid base64; the output is then undefined.
+ */
+inline bool DecodeBase64Scalar(const char* text, size_t length, std::vector<uint8_t>& output)
+{
+  if(!Detail::Prepare(text, length, output))
+  {
+    return false;
+  }
+
+  const auto* src = reinterpret_cast<const uint8_t*>(text);
+  return Detail::DecodeTail(src, src + length, output.data());
+}
+
+/**
+ * @brief Decodes base64 text into @p output, which is sized once up front, with SIMD_NAME instructions where available.
+ * @return False if the text isn't valid base64; the output is then undefined.
+ */
+inline bool DecodeBase64(const char* text, size_t length, std::vector<uint8_t>& output)
+{
+  if(!Detail::Prepare(text, length, output))
+  {
+    return false;
+  }
+
+  const auto* src   = reinterpret_cast<const uint8_t*>(text);
+  const auto* end   = src + length;
+  auto*       dst   = output.data();
+  bool        valid = true;
+#if defined(DEMO_BASE64_NEON) || defined(DEMO_BASE64_SSSE3)
+  valid = Detail::DecodeBlocks(src, end, dst);
+#endif
+  return Detail::DecodeTail(src, end, dst) && valid;
+}
+
+/**
+ * @brief Encodes @p data as padded base64 text.
+ */
+inline std::string EncodeBase64(const uint8_t* data, size_t size)
+{
+  std::string text;
+  text.reserve((size + 2u) / 3u * 4u);
+  for(size_t i = 0u; i < size; i += 3u)
+  {
+    const size_t   count  = std::min<size_t>(3u, size - i);
+    const uint32_t triple = (uint32_t(data[i]) << 16) | (count > 1u ? uint32_t(data[i + 1u]) << 8 : 0u) | (count > 2u ? uint32_t(data[i + 2u]) : 0u);
+    for(size_t character = 0u; character < 4u; ++character)
+    {
+      text += character <= count ? Detail::ALPHABET[(triple >> (18u - character * 6u)) & 0x3fu] : '=';
+    }
+  }
+  return text;
+}
+
+} // namespace Base64
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_BASE64_H
@@ -0,0 +1,1016 @@
+#ifndef DALI_DEMO_BENCHMARK_HARNESS_H
+#define DALI_DEMO_BENCHMARK_HARNESS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/stage-devel.h>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/common/stage.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/execute-process.h"
+#include "shared/frame-timing-recorder.h"
+#include "shared/json-reader.h"
+#include "shared/mapped-file.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief Command line options, frame timing and parameter sweeps shared by the benchmark examples.
+ *
+ * The example registers its own options and calls Parse() before creating the application. A normal run records
+ * the frame times of the phases the example starts and writes them to the path given by --timing-output.
+ *
+ * With --sweep, the example instead runs itself once per combination of the swept values, each run in a new
+ * process so that no run inherits the caches or the fragmentation of the previous ones. Every configuration is
+ * run --warm-up times, with the results discarded, then --repeat times. All the results, and their median for
+ * each configuration, are written to one report: CSV if its path ends with ".csv", JSON otherwise.
+ *
+ * @code
+ * ./benchmark.example -r25 -c25 --sweep=pages=1..160*2 --repeat=5 --report=scaling.csv
+ * @endcode
+ *
+ * The sweep also finds, for every phase and every combination of the other swept values, the largest value of the
+ * first swept option whose median p95 frame time stays within --frame-budget, e.g. how many pages each mode can
+ * scroll smoothly:
+ *
+ * @code
+ * ./benchmark.example --sweep=pages=1..256*2 --sweep=useMesh=0,1 --sweep=instanced=0,1
+ * @endcode
+ */
+class BenchmarkHarness
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] name The name of the benchmark, written in the results
+   * @param[in] processName The name of the example executable, used to run the configurations of a sweep
+   */
+  BenchmarkHarness(const std::string& name, const std::string& processName)
+  : mName(name),
+    mProcessName(processName),
+    mReportPath(name + "-sweep.json")
+  {
+  }
+
+  /**
+   * @brief Adds an option taking a value, e.g. prefix "-r" for "-r25".
+   * @param[in] name The name of the option, used in the results and by --sweep
+   * @param[in] prefix The text preceding the value on the command line
+   * @param[in] description The help text
+   * @param[in,out] value The default value, set when the option is parsed
+   */
+  void AddOption(const std::string& name, const std::string& prefix, const std::string& description, int& value)
+  {
+    mOptions.push_back(Option{name, prefix, description, Option::INTEGER, &value, false});
+  }
+
+  void AddOption(const std::string& name, const std::string& prefix, const std::string& description, unsigned int& value)
+  {
+    mOptions.push_back(Option{name, prefix, description, Option::UNSIGNED_INTEGER, &value, false});
+  }
+
+  void AddOption(const std::string& name, const std::string& prefix, const std::string& description, float& value)
+  {
+    mOptions.push_back(Option{name, prefix, description, Option::FLOAT, &value, false});
+  }
+
+  /**
+   * @brief Adds an option taking text, e.g. a path; it can't be swept.
+   */
+  void AddOption(const std::string& name, const std::string& prefix, const std::string& description, std::string& value)
+  {
+    mOptions.push_back(Option{name, prefix, description, Option::STRING, &value, false});
+  }
+
+  /**
+   * @brief Adds an option without value, e.g. "--use-mesh"; it is swept with the values 0 and 1.
+   * @param[in] name The name of the option, used in the results and by --sweep
+   * @param[in] flag The option on the command line
+   * @param[in] description The help text
+   * @param[in,out] value Set to @p valueWhenSet when the option is parsed
+   * @param[in] valueWhenSet The value of @p value when the option is given
+   */
+  void AddFlag(const std::string& name, const std::string& flag, const std::string& description, bool& value, bool valueWhenSet = true)
+  {
+    mOptions.push_back(Option{name, flag, description, Option::FLAG, &value, valueWhenSet});
+  }
+
+  /**
+   * @brief Parses the command line, once all the options are added; arguments that are not options are ignored.
+   * @return false if an option of the harness is invalid
+   */
+  bool Parse(int argc, char** argv)
+  {
+    mArguments.assign(argv + 1, argv + argc);
+    for(const std::string& argument : mArguments)
+    {
+      if(argument == "--help")
+      {
+        mHelpRequested = true;
+      }
+      else if(HasPrefix(argument, TIMING_OUTPUT_OPTION))
+      {
+        mTimingOutputPath = argument.substr(strlen(TIMING_OUTPUT_OPTION));
+      }
+      else if(HasPrefix(argument, REPORT_OPTION))
+      {
+        mReportPath = argument.substr(strlen(REPORT_OPTION));
+      }
+      else if(HasPrefix(argument, WARM_UP_OPTION))
+      {
+        mWarmUpRuns = atoi(argument.c_str() + strlen(WARM_UP_OPTION));
+      }
+      else if(HasPrefix(argument, REPEAT_OPTION))
+      {
+        mRepeats = atoi(argument.c_str() + strlen(REPEAT_OPTION));
+      }
+      else if(HasPrefix(argument, FRAME_BUDGET_OPTION))
+      {
+        mFrameBudget = atof(argument.c_str() + strlen(FRAME_BUDGET_OPTION));
+      }
+      else if(HasPrefix(argument, SWEEP_OPTION))
+      {
+        if(!ParseSweep(argument.substr(strlen(SWEEP_OPTION))))
+        {
+          std::cerr << "Invalid sweep: " << argument << std::endl;
+          return false;
+        }
+      }
+      else if(const Option* option = FindOption(argument))
+      {
+        SetValue(*option, argument);
+      }
+    }
+
+    if(mWarmUpRuns < 0 || mRepeats < 1)
+    {
+      std::cerr << "Invalid number of runs, needs --warm-up >= 0 and --repeat >= 1" << std::endl;
+      return false;
+    }
+    if(!(mFrameBudget > 0.0))
+    {
+      std::cerr << "Invalid frame budget, needs --frame-budget > 0" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Whether --help was given.
+   */
+  bool IsHelpRequested() const
+  {
+    return mHelpRequested;
+  }
+
+  /**
+   * @brief Prints the options of the benchmark and of the harness.
+   */
+  void PrintHelp() const
+  {
+    for(const Option& option : mOptions)
+    {
+      PrintOption(option.type == Option::FLAG ? option.prefix : option.prefix + "<" + option.name + ">", option.description);
+    }
+    PrintOption(std::string(TIMING_OUTPUT_OPTION) + "<path>", "Writes the frame time statistics as JSON");
+    PrintOption(std::string(SWEEP_OPTION) + "<name>=<values>", "Runs every value, e.g. pages=1,2,4 or pages=1..64*2 or rows=5..50+5");
+    PrintOption(std::string(WARM_UP_OPTION) + "<runs>", "Runs discarded before each configuration of a sweep (default 1)");
+    PrintOption(std::string(REPEAT_OPTION) + "<runs>", "Runs measured for each configuration of a sweep (default 3)");
+    PrintOption(std::string(REPORT_OPTION) + "<path>", "Report of the sweep, CSV if it ends with .csv (default " + mName + "-sweep.json)");
+    PrintOption(std::string(FRAME_BUDGET_OPTION) + "<ms>", "p95 frame time the limits of a sweep are found for (default 16.667)");
+  }
+
+  /**
+   * @brief Whether the benchmark should run a sweep rather than itself.
+   */
+  bool IsSweep() const
+  {
+    return !mSweeps.empty();
+  }
+
+  /**
+   * @brief Runs every configuration of the sweep in a new process and writes the report.
+   * @return The exit code for the benchmark, 0 if every run succeeded
+   */
+  int RunSweep()
+  {
+    // The arguments kept for every run, minus the options of the sweep and the swept options
+    std::vector<std::string> baseArguments;
+    for(const std::string& argument : mArguments)
+    {
+      const Option* option = FindOption(argument);
+      if(!HasPrefix(argument, TIMING_OUTPUT_OPTION) && !HasPrefix(argument, REPORT_OPTION) && !HasPrefix(argument, WARM_UP_OPTION) &&
+         !HasPrefix(argument, REPEAT_OPTION) && !HasPrefix(argument, SWEEP_OPTION) && !HasPrefix(argument, FRAME_BUDGET_OPTION) &&
+         !(option && FindSweep(option->name)))
+      {
+        baseArguments.push_back(argument);
+      }
+    }
+
+    const std::string timingOutputPath = mReportPath + ".run.json";
+
+    size_t configurationCount = 1u;
+    for(const Sweep& sweep : mSweeps)
+    {
+      configurationCount *= sweep.values.size();
+    }
+
+    std::vector<Configuration> configurations(configurationCount);
+    bool                       succeeded = true;
+    for(size_t i = 0u; i < configurationCount; ++i)
+    {
+      Configuration&           configuration = configurations[i];
+      std::vector<std::string> arguments     = baseArguments;
+      std::string              description;
+
+      // the first sweep given varies the slowest
+      size_t remainder = i;
+      configuration.values.resize(mSweeps.size());
+      for(auto sweep = mSweeps.rbegin(); sweep != mSweeps.rend(); ++sweep)
+      {
+        const double value = sweep->values[remainder % sweep->values.size()];
+        remainder /= sweep->values.size();
+        configuration.values[static_cast<size_t>(mSweeps.rend() - sweep - 1)] = value;
+
+        const Option& option = *sweep->option;
+        if(option.type == Option::FLAG)
+        {
+          if(value != 0.0)
+          {
+            arguments.push_back(option.prefix);
+          }
+        }
+        else
+        {
+          arguments.push_back(option.prefix + FormatValue(option, value));
+        }
+        description = option.name + "=" + FormatValue(option, value) + (description.empty() ? "" : " ") + description;
+      }
+      arguments.push_back(TIMING_OUTPUT_OPTION + timingOutputPath);
+
+      for(int run = 0; run < mWarmUpRuns + mRepeats; ++run)
+      {
+        const bool warmUp = run < mWarmUpRuns;
+        std::cout << "[" << i + 1u << "/" << configurationCount << "] " << description << (warmUp ? " warm-up " : " run ")
+                  << (warmUp ? run + 1 : run - mWarmUpRuns + 1) << "/" << (warmUp ? mWarmUpRuns : mRepeats) << std::endl;
+
+        remove(timingOutputPath.c_str());
+        const int                    exitCode = ExecuteProcessAndWait(mProcessName, arguments);
+        std::vector<PhaseStatistics> phases;
+        if(exitCode != 0 || !ReadTimings(timingOutputPath, configuration.parameters, phases))
+        {
+          std::cerr << mProcessName << " failed with " << description << " (exit code " << exitCode << ")" << std::endl;
+          ++configuration.failedRunCount;
+          succeeded = false;
+        }
+        else if(!warmUp)
+        {
+          configuration.runs.push_back(std::move(phases));
+        }
+      }
+      configuration.median = GetMedian(configuration.runs);
+    }
+    remove(timingOutputPath.c_str());
+
+    const std::vector<Limit> limits = GetLimits(configurations);
+    for(const Limit& limit : limits)
+    {
+      std::cout << limit.phase << (limit.others.empty() ? "" : " with ") << limit.others << ": ";
+      if(limit.reached)
+      {
+        std::cout << mSweeps.front().option->name << "=" << FormatValue(*mSweeps.front().option, limit.value);
+      }
+      else
+      {
+        std::cout << "none";
+      }
+      std::cout << " within " << FormatValue(mFrameBudget) << " ms" << std::endl;
+    }
+
+    const bool csv = mReportPath.size() >= 4u && mReportPath.compare(mReportPath.size() - 4u, 4u, ".csv") == 0;
+    if(!(csv ? WriteCsv(configurations) : WriteJson(configurations, limits)))
+    {
+      std::cerr << "Failed to write the report to " << mReportPath << std::endl;
+      return 1;
+    }
+    std::cout << "Report written to " << mReportPath << std::endl;
+    return succeeded ? 0 : 1;
+  }
+
+  /**
+   * @brief Starts recording the frame times if --timing-output was given; call once the scene is created.
+   * @param[in] rootActor The actor the frame callback is added to
+   */
+  void StartRecording(Dali::Actor rootActor)
+  {
+    if(mTimingOutputPath.empty() || mRecording)
+    {
+      return;
+    }
+
+    for(const Option& option : mOptions)
+    {
+      switch(option.type)
+      {
+        case Option::INTEGER:
+          mRecorder.SetParameter(option.name, static_cast<double>(*static_cast<int*>(option.value)));
+          break;
+        case Option::UNSIGNED_INTEGER:
+          mRecorder.SetParameter(option.name, static_cast<double>(*static_cast<unsigned int*>(option.value)));
+          break;
+        case Option::FLOAT:
+          mRecorder.SetParameter(option.name, static_cast<double>(*static_cast<float*>(option.value)));
+          break;
+        case Option::FLAG:
+          mRecorder.SetParameter(option.name, *static_cast<bool*>(option.value) == option.valueWhenSet);
+          break;
+        case Option::STRING:
+          mRecorder.SetParameter(option.name, *static_cast<std::string*>(option.value));
+          break;
+      }
+    }
+
+    Dali::DevelStage::AddFrameCallback(Dali::Stage::GetCurrent(), mRecorder, rootActor);
+    mRecording = true;
+  }
+
+  /**
+   * @brief Whether the frame times are being recorded, i.e. --timing-output was given and recording has started.
+   */
+  bool IsRecording() const
+  {
+    return mRecording;
+  }
+
+  /**
+   * @brief Adds a count measured by the run, e.g. of the objects it created, written along with the options.
+   */
+  void SetParameter(const std::string& name, double value)
+  {
+    mRecorder.SetParameter(name, value);
+  }
+
+  /**
+   * @brief Attributes the frames from now on to a new phase, e.g. when the next animation is played.
+   */
+  void StartPhase(const std::string& name)
+  {
+    mRecorder.StartPhase(name);
+  }
+
+  /**
+   * @brief Adds durations measured by the example, e.g. the update time of its frame callback, to the results.
+   * @see FrameTimingRecorder::AddSamples()
+   */
+  void AddSamples(const std::string& name, std::vector<double> samples)
+  {
+    mRecorder.AddSamples(name, std::move(samples));
+  }
+
+  /**
+   * @brief Stops recording and writes the frame times; call when the benchmark completes, before quitting.
+   * @return false if the frame times couldn't be written
+   */
+  bool FinishRecording()
+  {
+    if(!mRecording)
+    {
+      return true;
+    }
+
+    // stop the update thread from recording before reading the frames
+    Dali::DevelStage::RemoveFrameCallback(Dali::Stage::GetCurrent(), mRecorder);
+    mRecording = false;
+    if(!mRecorder.WriteJson(mTimingOutputPath, mName))
+    {
+      std::cerr << "Failed to write frame timings to " << mTimingOutputPath << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+private:
+  typedef FrameTimingRecorder::PhaseStatistics PhaseStatistics;
+
+  static constexpr const char* TIMING_OUTPUT_OPTION = "--timing-output=";
+  static constexpr const char* SWEEP_OPTION         = "--sweep=";
+  static constexpr const char* WARM_UP_OPTION       = "--warm-up=";
+  static constexpr const char* REPEAT_OPTION        = "--repeat=";
+  static constexpr const char* REPORT_OPTION        = "--report=";
+  static constexpr const char* FRAME_BUDGET_OPTION  = "--frame-budget=";
+
+  static constexpr size_t MAXIMUM_SWEEP_VALUES = 1000u; ///< Guards against ranges that never reach their end
+
+  struct Option
+  {
+    enum Type
+    {
+      INTEGER,
+      UNSIGNED_INTEGER,
+      FLOAT,
+      FLAG,
+      STRING
+    };
+
+    std::string name;
+    std::string prefix; ///< Or the whole option for flags
+    std::string description;
+    Type        type;
+    void*       value;
+    bool        valueWhenSet;
+  };
+
+  struct Sweep
+  {
+    const Option*       option;
+    std::vector<double> values;
+  };
+
+  struct Configuration
+  {
+    std::vector<std::pair<std::string, std::string>> parameters; ///< Names and JSON values, as written by the runs
+    std::vector<std::vector<PhaseStatistics>>        runs;
+    std::vector<PhaseStatistics>                     median;
+    std::vector<double>                              values; ///< The swept values, in the order of the sweeps
+    uint32_t                                         failedRunCount{0u};
+  };
+
+  /**
+   * @brief The largest value of the first swept option a phase stays within the frame budget at.
+   */
+  struct Limit
+  {
+    std::string phase;
+    std::string others; ///< The values of the other sweeps, e.g. "useMesh=1 instanced=0"
+    double      value{0.0};
+    bool        reached{false}; ///< Whether any value was within the budget
+  };
+
+  static bool HasPrefix(const std::string& text, const char* prefix)
+  {
+    return text.compare(0, strlen(prefix), prefix) == 0;
+  }
+
+  static void PrintOption(const std::string& option, const std::string& description)
+  {
+    const std::ios_base::fmtflags flags = std::cout.flags();
+    std::cout << std::left << "  ";
+    std::cout.width(32);
+    std::cout << option << " " << description << std::endl;
+    std::cout.flags(flags);
+  }
+
+  /**
+   * @brief Formats a value without an exponent below 1e15, so the options parse it back as it is.
+   */
+  static std::string FormatValue(double value)
+  {
+    char text[32];
+    snprintf(text, sizeof(text), "%.15g", value);
+    return text;
+  }
+
+  /**
+   * @brief Formats a value of an option, integer options as integers.
+   */
+  static std::string FormatValue(const Option& option, double value)
+  {
+    if(option.type == Option::FLOAT)
+    {
+      return FormatValue(value);
+    }
+    char text[32];
+    snprintf(text, sizeof(text), "%lld", static_cast<long long>(value));
+    return text;
+  }
+
+  /**
+   * @brief Whether an option can take a value, i.e. integer options take integers in their range and flags 0 or 1.
+   */
+  static bool IsValidValue(const Option& option, double value)
+  {
+    switch(option.type)
+    {
+      case Option::INTEGER:
+        return value == std::floor(value) && value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max();
+      case Option::UNSIGNED_INTEGER:
+        return value == std::floor(value) && value >= 0.0 && value <= std::numeric_limits<unsigned int>::max();
+      case Option::FLAG:
+        return value == 0.0 || value == 1.0;
+      default:
+        return std::isfinite(value);
+    }
+  }
+
+  /**
+   * @brief Finds the option an argument sets; flags must match exactly, the longest prefix wins otherwise.
+   */
+  const Option* FindOption(const std::string& argument) const
+  {
+    const Option* found = nullptr;
+    for(const Option& option : mOptions)
+    {
+      if(option.type == Option::FLAG ? argument == option.prefix
+                                     : HasPrefix(argument, option.prefix.c_str()) && (!found || option.prefix.size() > found->prefix.size()))
+      {
+        found = &option;
+      }
+    }
+    return found;
+  }
+
+  const Sweep* FindSweep(const std::string& name) const
+  {
+    auto iter = std::find_if(mSweeps.begin(), mSweeps.end(), [&name](const Sweep& sweep) { return sweep.option->name == name; });
+    return iter != mSweeps.end() ? &*iter : nullptr;
+  }
+
+  static void SetValue(const Option& option, const std::string& argument)
+  {
+    const char* text = argument.c_str() + option.prefix.size();
+    switch(option.type)
+    {
+      case Option::INTEGER:
+        *static_cast<int*>(option.value) = atoi(text);
+        break;
+      case Option::UNSIGNED_INTEGER:
+        *static_cast<unsigned int*>(option.value) = static_cast<unsigned int>(strtoul(text, nullptr, 10));
+        break;
+      case Option::FLOAT:
+        *static_cast<float*>(option.value) = static_cast<float>(atof(text));
+        break;
+      case Option::FLAG:
+        *static_cast<bool*>(option.value) = option.valueWhenSet;
+        break;
+      case Option::STRING:
+        *static_cast<std::string*>(option.value) = text;
+        break;
+    }
+  }
+
+  /**
+   * @brief Parses "name=v1,v2,...", "name=from..to", "name=from..to*factor" or "name=from..to+step".
+   */
+  bool ParseSweep(const std::string& text)
+  {
+    const size_t equals = text.find('=');
+    if(equals == std::string::npos)
+    {
+      return false;
+    }
+
+    const std::string name = text.substr(0u, equals);
+    auto option = std::find_if(mOptions.begin(), mOptions.end(), [&name](const Option& option) { return option.name == name; });
+    if(option == mOptions.end() || option->type == Option::STRING || FindSweep(name))
+    {
+      return false;
+    }
+
+    Sweep       sweep{&*option, {}};
+    const char* values = text.c_str() + equals + 1u;
+    char*       end    = nullptr;
+    const char* range  = strstr(values, "..");
+    if(range)
+    {
+      // parsed apart, as strtod() would take the "1." of "1..8"
+      const std::string fromText(values, range);
+      const double      from = strtod(fromText.c_str(), &end);
+      if(fromText.empty() || *end != '\0')
+      {
+        return false;
+      }
+      const double to   = strtod(range + 2, &end);
+      const char   step = *end;
+      double       increment = 1.0;
+      if(step == '*' || step == '+')
+      {
+        increment = strtod(end + 1, &end);
+      }
+      if(*end != '\0' || (step == '*' ? (increment <= 1.0 || from <= 0.0) : increment <= 0.0))
+      {
+        return false;
+      }
+
+      for(double value = from; value <= to * (1.0 + 1e-9) && sweep.values.size() < MAXIMUM_SWEEP_VALUES;
+          value = step == '*' ? value * increment : value + increment)
+      {
+        sweep.values.push_back(value);
+      }
+    }
+    else
+    {
+      for(const char* value = values; *value; value = *end ? end + 1 : end)
+      {
+        sweep.values.push_back(strtod(value, &end));
+        if(end == value || (*end != ',' && *end != '\0'))
+        {
+          return false;
+        }
+      }
+    }
+
+    if(sweep.values.empty())
+    {
+      return false;
+    }
+    for(double value : sweep.values)
+    {
+      if(!IsValidValue(*option, value))
+      {
+        std::cerr << "Invalid value " << FormatValue(value) << " for " << name << std::endl;
+        return false;
+      }
+    }
+    mSweeps.push_back(std::move(sweep));
+    return true;
+  }
+
+  /**
+   * @brief Reads back the file written by FrameTimingRecorder::WriteJson().
+   */
+  static bool ReadTimings(const std::string& path, std::vector<std::pair<std::string, std::string>>& parameters, std::vector<PhaseStatistics>& phases)
+  {
+    MappedFile file(path);
+    if(file.IsEmpty())
+    {
+      return false;
+    }
+
+    const char* text = reinterpret_cast<const char*>(file.GetData());
+    JsonReader  reader(text, text + file.GetSize());
+
+    std::vector<std::pair<std::string, std::string>> readParameters;
+    std::string_view                                 key;
+    if(!reader.EnterObject())
+    {
+      return false;
+    }
+    while(reader.NextMember(key))
+    {
+      if(key == "parameters" && reader.EnterObject())
+      {
+        while(reader.NextMember(key))
+        {
+          // keep the values as JSON text, to be written as they are in the report
+          std::string value;
+          double      number  = 0.0;
+          bool        boolean = false;
+          switch(reader.GetType())
+          {
+            case JsonReader::Type::NUMBER:
+              reader.ReadNumber(number);
+              value = FormatValue(number);
+              break;
+            case JsonReader::Type::BOOLEAN:
+              reader.ReadBool(boolean);
+              value = boolean ? "true" : "false";
+              break;
+            case JsonReader::Type::STRING:
+              reader.ReadString(value);
+              value = FrameTimingRecorder::Quote(value);
+              break;
+            default:
+              reader.Skip();
+              value = "null";
+              break;
+          }
+          readParameters.emplace_back(std::string(key), value);
+        }
+      }
+      else if(key == "phases" && reader.EnterArray())
+      {
+        while(reader.NextElement() && reader.EnterObject())
+        {
+          PhaseStatistics phase;
+          while(reader.NextMember(key))
+          {
+            if(key == "name")
+            {
+              reader.ReadString(phase.name);
+            }
+            else if(key == "frames")
+            {
+              reader.ReadNumber(phase.frameCount);
+            }
+            else if(key == "droppedFrames")
+            {
+              reader.ReadNumber(phase.droppedFrameCount);
+            }
+            else if(key == "durationMs")
+            {
+              reader.ReadNumber(phase.duration);
+            }
+            else if(key == "minMs")
+            {
+              reader.ReadNumber(phase.minimum);
+            }
+            else if(key == "avgMs")
+            {
+              reader.ReadNumber(phase.average);
+            }
+            else if(key == "p50Ms")
+            {
+              reader.ReadNumber(phase.p50);
+            }
+            else if(key == "p95Ms")
+            {
+              reader.ReadNumber(phase.p95);
+            }
+            else if(key == "p99Ms")
+            {
+              reader.ReadNumber(phase.p99);
+            }
+            else if(key == "maxMs")
+            {
+              reader.ReadNumber(phase.maximum);
+            }
+            else
+            {
+              reader.Skip();
+            }
+          }
+          phases.push_back(std::move(phase));
+        }
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
+
+    if(reader.HasError())
+    {
+      return false;
+    }
+    parameters = std::move(readParameters);
+    return true;
+  }
+
+  /**
+   * @brief Computes the median of every statistic of every phase over the runs.
+   */
+  static std::vector<PhaseStatistics> GetMedian(const std::vector<std::vector<PhaseStatistics>>& runs)
+  {
+    std::vector<PhaseStatistics> median;
+    if(runs.empty())
+    {
+      return median;
+    }
+
+    median = runs.front();
+    for(size_t phase = 0u; phase < median.size(); ++phase)
+    {
+      std::vector<const PhaseStatistics*> phaseRuns;
+      for(const std::vector<PhaseStatistics>& run : runs)
+      {
+        if(phase < run.size() && run[phase].name == median[phase].name)
+        {
+          phaseRuns.push_back(&run[phase]);
+        }
+      }
+
+      auto getMedian = [&phaseRuns](auto member) {
+        std::vector<double> values;
+        for(const PhaseStatistics* statistics : phaseRuns)
+        {
+          values.push_back(static_cast<double>(statistics->*member));
+        }
+        std::sort(values.begin(), values.end());
+        const size_t middle = values.size() / 2u;
+        return values.size() % 2u ? values[middle] : (values[middle - 1u] + values[middle]) * 0.5;
+      };
+
+      PhaseStatistics& statistics  = median[phase];
+      statistics.frameCount        = static_cast<uint32_t>(std::lround(getMedian(&PhaseStatistics::frameCount)));
+      statistics.droppedFrameCount = static_cast<uint32_t>(std::lround(getMedian(&PhaseStatistics::droppedFrameCount)));
+      statistics.duration          = getMedian(&PhaseStatistics::duration);
+      statistics.minimum           = getMedian(&PhaseStatistics::minimum);
+      statistics.average           = getMedian(&PhaseStatistics::average);
+      statistics.p50               = getMedian(&PhaseStatistics::p50);
+      statistics.p95               = getMedian(&PhaseStatistics::p95);
+      statistics.p99               = getMedian(&PhaseStatistics::p99);
+      statistics.maximum           = getMedian(&PhaseStatistics::maximum);
+    }
+    return median;
+  }
+
+  /**
+   * @brief Finds the limits of every phase for every combination of the other swept values.
+   *
+   * The values of the first sweep are taken in the order given: the limit is the last one before the first that
+   * goes over the budget or fails.
+   */
+  std::vector<Limit> GetLimits(const std::vector<Configuration>& configurations) const
+  {
+    std::vector<Limit> limits;
+    const size_t       firstCount = mSweeps.front().values.size();
+    const size_t       otherCount = configurations.size() / firstCount;
+    for(size_t other = 0u; other < otherCount; ++other)
+    {
+      std::string others;
+      for(size_t sweep = 1u; sweep < mSweeps.size(); ++sweep)
+      {
+        others += (others.empty() ? "" : " ") + mSweeps[sweep].option->name + "=" + FormatValue(*mSweeps[sweep].option, configurations[other].values[sweep]);
+      }
+
+      std::vector<std::string> phases;
+      for(size_t first = 0u; first < firstCount; ++first)
+      {
+        for(const PhaseStatistics& phase : configurations[first * otherCount + other].median)
+        {
+          if(std::find(phases.begin(), phases.end(), phase.name) == phases.end())
+          {
+            phases.push_back(phase.name);
+          }
+        }
+      }
+
+      for(const std::string& phaseName : phases)
+      {
+        Limit limit{phaseName, others};
+        for(size_t first = 0u; first < firstCount; ++first)
+        {
+          const Configuration& configuration = configurations[first * otherCount + other];
+          auto                 phase         = std::find_if(configuration.median.begin(), configuration.median.end(), [&phaseName](const PhaseStatistics& statistics) { return statistics.name == phaseName; });
+          if(configuration.failedRunCount || phase == configuration.median.end() || phase->p95 > mFrameBudget)
+          {
+            break;
+          }
+          limit.value   = configuration.values.front();
+          limit.reached = true;
+        }
+        limits.push_back(limit);
+      }
+    }
+    return limits;
+  }
+
+  bool WriteJson(const std::vector<Configuration>& configurations, const std::vector<Limit>& limits) const
+  {
+    FILE* file = fopen(mReportPath.c_str(), "w");
+    if(!file)
+    {
+      return false;
+    }
+
+    fprintf(file, "{\n  \"benchmark\": %s,\n  \"warmUpRuns\": %d,\n  \"repeats\": %d,\n  \"configurations\": [", FrameTimingRecorder::Quote(mName).c_str(), mWarmUpRuns, mRepeats);
+    for(size_t i = 0u; i < configurations.size(); ++i)
+    {
+      const Configuration& configuration = configurations[i];
+      fprintf(file, "%s\n    {\n      \"parameters\": {", i ? "," : "");
+      for(size_t j = 0u; j < configuration.parameters.size(); ++j)
+      {
+        fprintf(file, "%s%s: %s", j ? ", " : "", FrameTimingRecorder::Quote(configuration.parameters[j].first).c_str(), configuration.parameters[j].second.c_str());
+      }
+      fprintf(file, "},\n      \"failedRuns\": %u,\n      \"median\": [", configuration.failedRunCount);
+      WritePhasesJson(file, configuration.median, "        ");
+      fprintf(file, "],\n      \"runs\": [");
+      for(size_t run = 0u; run < configuration.runs.size(); ++run)
+      {
+        fprintf(file, "%s\n        [", run ? "," : "");
+        WritePhasesJson(file, configuration.runs[run], "          ");
+        fprintf(file, "]");
+      }
+      fprintf(file, "%s]\n    }", configuration.runs.empty() ? "" : "\n      ");
+    }
+    fprintf(file, "\n  ],\n  \"frameBudgetMs\": %.3f,\n  \"limits\": [", mFrameBudget);
+    for(size_t i = 0u; i < limits.size(); ++i)
+    {
+      const Limit& limit = limits[i];
+      fprintf(file, "%s\n    {\"phase\": %s, \"others\": %s, %s: ", i ? "," : "", FrameTimingRecorder::Quote(limit.phase).c_str(), FrameTimingRecorder::Quote(limit.others).c_str(), FrameTimingRecorder::Quote(mSweeps.front().option->name).c_str());
+      if(limit.reached)
+      {
+        fprintf(file, "%s}", FormatValue(*mSweeps.front().option, limit.value).c_str());
+      }
+      else
+      {
+        fprintf(file, "null}");
+      }
+    }
+    fprintf(file, "%s]\n}\n", limits.empty() ? "" : "\n  ");
+
+    return fclose(file) == 0;
+  }
+
+  static void WritePhasesJson(FILE* file, const std::vector<PhaseStatistics>& phases, const char* indentation)
+  {
+    for(size_t i = 0u; i < phases.size(); ++i)
+    {
+      fprintf(file, "%s\n%s", i ? "," : "", indentation);
+      FrameTimingRecorder::WriteJson(file, phases[i]);
+    }
+    if(!phases.empty())
+    {
+      fprintf(file, "\n%.*s", static_cast<int>(strlen(indentation) - 2u), indentation);
+    }
+  }
+
+  bool WriteCsv(const std::vector<Configuration>& configurations) const
+  {
+    FILE* file = fopen(mReportPath.c_str(), "w");
+    if(!file)
+    {
+      return false;
+    }
+
+    // the runs of every configuration write the same parameters, take the names from any that succeeded
+    auto named = std::find_if(configurations.begin(), configurations.end(), [](const Configuration& configuration) { return !configuration.parameters.empty(); });
+
+    fprintf(file, "configuration,");
+    if(named != configurations.end())
+    {
+      for(const auto& parameter : named->parameters)
+      {
+        fprintf(file, "%s,", parameter.first.c_str());
+      }
+    }
+    fprintf(file, "run,phase,frames,droppedFrames,durationMs,minMs,avgMs,p50Ms,p95Ms,p99Ms,maxMs\n");
+
+    for(size_t i = 0u; i < configurations.size(); ++i)
+    {
+      const Configuration& configuration = configurations[i];
+      for(size_t run = 0u; run <= configuration.runs.size(); ++run)
+      {
+        const bool                          median = run == configuration.runs.size();
+        const std::vector<PhaseStatistics>& phases = median ? configuration.median : configuration.runs[run];
+        for(const PhaseStatistics& phase : phases)
+        {
+          fprintf(file, "%zu,", i + 1u);
+          for(const auto& parameter : configuration.parameters)
+          {
+            fprintf(file, "%s,", parameter.second.c_str());
+          }
+          if(median)
+          {
+            fprintf(file, "median,");
+          }
+          else
+          {
+            fprintf(file, "%zu,", run + 1u);
+          }
+          fprintf(file,
+                  "%s,%u,%u,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                  FrameTimingRecorder::Quote(phase.name).c_str(),
+                  phase.frameCount,
+                  phase.droppedFrameCount,
+                  phase.duration,
+                  phase.minimum,
+                  phase.average,
+                  phase.p50,
+                  phase.p95,
+                  phase.p99,
+                  phase.maximum);
+        }
+      }
+    }
+
+    return fclose(file) == 0;
+  }
+
+private:
+  std::string              mName;
+  std::string              mProcessName;
+  std::vector<Option>      mOptions;
+  std::vector<std::string> mArguments;
+  std::vector<Sweep>       mSweeps;
+  std::string              mTimingOutputPath;
+  std::string              mReportPath;
+  int                      mWarmUpRuns{1};
+  int                      mRepeats{3};
+  double                   mFrameBudget{1000.0 / 60.0};
+  bool                     mHelpRequested{false};
+  bool                     mRecording{false};
+  FrameTimingRecorder      mRecorder;
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_BENCHMARK_HARNESS_H
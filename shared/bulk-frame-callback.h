@@ -0,0 +1,376 @@
+#ifndef DALI_DEMO_BULK_FRAME_CALLBACK_H
+#define DALI_DEMO_BULK_FRAME_CALLBACK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/devel-api/update/update-proxy.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+#include <stdint.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/trace.h"
+#include "shared/worker-pool.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief A frame callback updating many actors at once, their properties kept as structure-of-arrays.
+ *
+ * Every frame, the properties read or written by the kernels are gathered from the update proxy into one array of
+ * floats per component, the kernels run over the arrays in the order they were added, and only the actors whose
+ * written properties changed are set back. A kernel is a plain loop over contiguous floats, which the compiler can
+ * vectorize as long as the loop has no calls and selects values rather than branching:
+ *
+ * @code
+ * callback.AddKernel(BulkFrameCallback::COLOR, BulkFrameCallback::COLOR, [](BulkFrameCallback::Arrays& arrays, float) {
+ *   for(uint32_t i = 0u; i < arrays.count; ++i)
+ *   {
+ *     arrays.alpha[i] = std::min(arrays.alpha[i] * 2.0f, 1.0f);
+ *   }
+ * });
+ * @endcode
+ *
+ * The kernels can run on several workers at once, see SetWorkerCount(); each worker then runs all the kernels over
+ * its own part of the arrays, so a kernel must only access the elements it is given. Gathering and writing back
+ * stay on the update thread, as the update proxy must only be used from there.
+ *
+ * Actors and kernels are added before the frame callback is added to the stage, as only the update thread uses them
+ * from then on. Actors the update proxy can't find, e.g. once removed from the scene, are neither read nor written.
+ */
+class BulkFrameCallback : public Dali::FrameCallbackInterface
+{
+public:
+  /**
+   * @brief The properties a kernel reads or writes, combined as a bit mask.
+   */
+  enum Channel : uint32_t
+  {
+    POSITION = 1u << 0,
+    SIZE     = 1u << 1,
+    SCALE    = 1u << 2,
+    COLOR    = 1u << 3
+  };
+
+  /**
+   * @brief The properties of the actors, one array per component, indexed in the order the actors were added.
+   *
+   * Only the arrays of the channels used by the kernels hold values; the others are left as they were.
+   */
+  struct Arrays
+  {
+    uint32_t count;
+    float*   positionX;
+    float*   positionY;
+    float*   positionZ;
+    float*   width;
+    float*   height;
+    float*   depth;
+    float*   scaleX;
+    float*   scaleY;
+    float*   scaleZ;
+    float*   red;
+    float*   green;
+    float*   blue;
+    float*   alpha;
+  };
+
+  static constexpr uint32_t DEFAULT_PARALLEL_THRESHOLD = 4096u; ///< Actors below which waking workers costs more than they save
+  static constexpr uint32_t CHUNK_SIZE                 = 1024u; ///< Actors a worker runs the kernels over at a time
+
+  /**
+   * @brief Updates the arrays for a frame, or the part of them given to a worker.
+   */
+  typedef std::function<void(Arrays& arrays, float elapsedSeconds)> Kernel;
+
+  /**
+   * @brief Updates the actor with the given ID from now on.
+   * @param[in] id The ID of the actor
+   */
+  void AddActor(uint32_t id)
+  {
+    mIds.push_back(id);
+    for(std::vector<float>& component : mComponents)
+    {
+      component.push_back(0.0f);
+    }
+  }
+
+  /**
+   * @brief Adds a kernel, run after those added before.
+   * @param[in] reads The channels the kernel reads
+   * @param[in] writes The channels the kernel writes, which it also reads
+   * @param[in] kernel The kernel
+   */
+  void AddKernel(uint32_t reads, uint32_t writes, Kernel kernel)
+  {
+    mKernels.push_back(std::move(kernel));
+    mReadChannels |= reads | writes;
+    mWrittenChannels |= writes;
+  }
+
+  /**
+   * @brief Sets the number of threads the kernels run on, including the update thread.
+   * @param[in] workerCount The number of threads, 1 to run the kernels on the update thread alone
+   * @param[in] parallelThreshold The number of actors below which the kernels still run on the update thread alone
+   */
+  void SetWorkerCount(uint32_t workerCount, uint32_t parallelThreshold = DEFAULT_PARALLEL_THRESHOLD)
+  {
+    mWorkerPool.reset(workerCount > 1u ? new WorkerPool(workerCount) : nullptr);
+    mParallelThreshold = parallelThreshold;
+  }
+
+  uint32_t GetActorCount() const
+  {
+    return static_cast<uint32_t>(mIds.size());
+  }
+
+private:
+  enum Component
+  {
+    POSITION_X,
+    POSITION_Y,
+    POSITION_Z,
+    WIDTH,
+    HEIGHT,
+    DEPTH,
+    SCALE_X,
+    SCALE_Y,
+    SCALE_Z,
+    RED,
+    GREEN,
+    BLUE,
+    ALPHA,
+    COMPONENT_COUNT
+  };
+
+  /**
+   * @brief Called on the update thread for every frame.
+   */
+  void Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    Tracer::Get().SetThreadName("Update thread");
+    DEMO_TRACE_SCOPE("BulkFrameCallback::Update");
+
+    const uint32_t count = GetActorCount();
+    mFound.resize(count);
+    mDirty.resize(count);
+    for(uint32_t component = 0u; component < COMPONENT_COUNT; ++component)
+    {
+      mPrevious[component].resize(count);
+    }
+
+    {
+      DEMO_TRACE_SCOPE("Gather");
+      Gather(updateProxy);
+    }
+
+    {
+      DEMO_TRACE_SCOPE("Kernels");
+      if(mWorkerPool && count >= mParallelThreshold)
+      {
+        mWorkerPool->Run(count, CHUNK_SIZE, [this, elapsedSeconds](uint32_t begin, uint32_t end) { RunKernels(begin, end, elapsedSeconds); });
+      }
+      else
+      {
+        RunKernels(0u, count, elapsedSeconds);
+      }
+    }
+
+    {
+      DEMO_TRACE_SCOPE("WriteBack");
+      WriteBack(POSITION, POSITION_X, [&updateProxy](uint32_t id, const float* v) { updateProxy.SetPosition(id, Dali::Vector3(v[0], v[1], v[2])); });
+      WriteBack(SIZE, WIDTH, [&updateProxy](uint32_t id, const float* v) { updateProxy.SetSize(id, Dali::Vector3(v[0], v[1], v[2])); });
+      WriteBack(SCALE, SCALE_X, [&updateProxy](uint32_t id, const float* v) { updateProxy.SetScale(id, Dali::Vector3(v[0], v[1], v[2])); });
+      WriteBack(COLOR, RED, [&updateProxy](uint32_t id, const float* v) { updateProxy.SetColor(id, Dali::Vector4(v[0], v[1], v[2], v[3])); });
+    }
+  }
+
+  /**
+   * @brief Runs the kernels over the actors from @p begin to @p end and marks those whose written channels changed.
+   */
+  void RunKernels(uint32_t begin, uint32_t end, float elapsedSeconds)
+  {
+    // Keep what was read of the written components, to find the actors the kernels changed
+    for(uint32_t component = 0u; component < COMPONENT_COUNT; ++component)
+    {
+      if(mWrittenChannels & GetChannel(component))
+      {
+        std::copy(mComponents[component].begin() + begin, mComponents[component].begin() + end, mPrevious[component].begin() + begin);
+      }
+    }
+
+    Arrays arrays{end - begin,
+                  mComponents[POSITION_X].data() + begin,
+                  mComponents[POSITION_Y].data() + begin,
+                  mComponents[POSITION_Z].data() + begin,
+                  mComponents[WIDTH].data() + begin,
+                  mComponents[HEIGHT].data() + begin,
+                  mComponents[DEPTH].data() + begin,
+                  mComponents[SCALE_X].data() + begin,
+                  mComponents[SCALE_Y].data() + begin,
+                  mComponents[SCALE_Z].data() + begin,
+                  mComponents[RED].data() + begin,
+                  mComponents[GREEN].data() + begin,
+                  mComponents[BLUE].data() + begin,
+                  mComponents[ALPHA].data() + begin};
+    for(Kernel& kernel : mKernels)
+    {
+      kernel(arrays, elapsedSeconds);
+    }
+
+    // Branchless comparison of each component, which vectorizes
+    uint8_t* dirty = mDirty.data();
+    std::fill(dirty + begin, dirty + end, 0u);
+    for(uint32_t component = 0u; component < COMPONENT_COUNT; ++component)
+    {
+      const uint32_t channel = GetChannel(component);
+      if(mWrittenChannels & channel)
+      {
+        const float* current  = mComponents[component].data();
+        const float* previous = mPrevious[component].data();
+        for(uint32_t i = begin; i < end; ++i)
+        {
+          dirty[i] |= static_cast<uint8_t>(current[i] != previous[i]) * static_cast<uint8_t>(channel);
+        }
+      }
+    }
+  }
+
+  static uint32_t GetChannel(uint32_t component)
+  {
+    return component < WIDTH ? POSITION : component < SCALE_X ? SIZE : component < RED ? SCALE : COLOR;
+  }
+
+  /**
+   * @brief Reads the channels used by the kernels from the update proxy into the arrays.
+   */
+  void Gather(Dali::UpdateProxy& updateProxy)
+  {
+    const bool    readPosition = mReadChannels & POSITION;
+    const bool    readSize     = mReadChannels & SIZE;
+    Dali::Vector3 position;
+    Dali::Vector3 size;
+    Dali::Vector3 scale;
+    Dali::Vector4 color;
+    for(uint32_t i = 0u; i < mIds.size(); ++i)
+    {
+      const uint32_t id    = mIds[i];
+      bool           found = true;
+      if(readPosition && readSize)
+      {
+        // One lookup for both
+        found = updateProxy.GetPositionAndSize(id, position, size);
+      }
+      else if(readPosition)
+      {
+        found = updateProxy.GetPosition(id, position);
+      }
+      else if(readSize)
+      {
+        found = updateProxy.GetSize(id, size);
+      }
+      if(found && (mReadChannels & SCALE))
+      {
+        found = updateProxy.GetScale(id, scale);
+      }
+      if(found && (mReadChannels & COLOR))
+      {
+        found = updateProxy.GetColor(id, color);
+      }
+
+      mFound[i] = found;
+      if(found)
+      {
+        if(readPosition)
+        {
+          Set(i, POSITION_X, position.x, position.y, position.z);
+        }
+        if(readSize)
+        {
+          Set(i, WIDTH, size.width, size.height, size.depth);
+        }
+        if(mReadChannels & SCALE)
+        {
+          Set(i, SCALE_X, scale.x, scale.y, scale.z);
+        }
+        if(mReadChannels & COLOR)
+        {
+          Set(i, RED, color.r, color.g, color.b);
+          mComponents[ALPHA][i] = color.a;
+        }
+      }
+    }
+  }
+
+  void Set(uint32_t index, uint32_t firstComponent, float x, float y, float z)
+  {
+    mComponents[firstComponent][index]      = x;
+    mComponents[firstComponent + 1u][index] = y;
+    mComponents[firstComponent + 2u][index] = z;
+  }
+
+  /**
+   * @brief Sets a written channel of the actors found whose components the kernels changed.
+   */
+  template<typename Setter>
+  void WriteBack(uint32_t channel, uint32_t firstComponent, Setter setter)
+  {
+    if(!(mWrittenChannels & channel))
+    {
+      return;
+    }
+
+    const uint32_t count          = GetActorCount();
+    const uint32_t componentCount = channel == COLOR ? 4u : 3u;
+    float values[4];
+    for(uint32_t i = 0u; i < count; ++i)
+    {
+      if((mDirty[i] & channel) && mFound[i])
+      {
+        for(uint32_t component = 0u; component < componentCount; ++component)
+        {
+          values[component] = mComponents[firstComponent + component][i];
+        }
+        setter(mIds[i], values);
+      }
+    }
+  }
+
+private:
+  std::vector<uint32_t>       mIds;
+  std::vector<float>          mComponents[COMPONENT_COUNT];
+  std::vector<float>          mPrevious[COMPONENT_COUNT]; ///< The written components as gathered, before the kernels ran
+  std::vector<uint8_t>        mFound;                     ///< Whether the update proxy found the actor this frame
+  std::vector<uint8_t>        mDirty;                     ///< The written channels the kernels changed
+  std::vector<Kernel>         mKernels;
+  uint32_t                    mReadChannels{0u};
+  uint32_t                    mWrittenChannels{0u};
+  std::unique_ptr<WorkerPool> mWorkerPool; ///< Runs the kernels on several threads, if set
+  uint32_t                    mParallelThreshold{DEFAULT_PARALLEL_THRESHOLD};
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_BULK_FRAME_CALLBACK_H
@@ -23,14 +23,23 @@
 #include <dali-toolkit/devel-api/accessibility-manager/accessibility-manager.h>
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/shader-effects/alpha-discard-effect.h>
-#include <dali-toolkit/devel-api/shader-effects/distance-field-effect.h>
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali/devel-api/actors/actor-devel.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/devel-api/common/stage-devel.h>
 #include <dali/devel-api/images/distance-field.h>
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 
 // INTERNAL INCLUDES
 #include "shared/execute-process.h"
+#include "shared/trace.h"
 #include "shared/utility.h"
 #include "shared/view.h"
 
@@ -56,6 +65,7 @@ const Vector3 FOCUS_INDICATOR_ANIMATING_SCALE(KEYBOARD_FOCUS_ANIMATED_SCALE_FLOA
 const float   KEYBOARD_FOCUS_MID_KEY_FRAME_TIME = KEYBOARD_FOCUS_ANIMATION_DURATION - (KEYBOARD_FOCUS_ANIMATION_DURATION * KEYBOARD_FOCUS_FADE_PERCENTAGE);   ///< Time of the mid key-frame
 
 const float   TILE_LABEL_PADDING          = 8.0f;  ///< Border between edge of tile and the example text
+const float   TILE_MARGIN                 = 2.0f;  ///< Border between the tiles
 const float   BUTTON_PRESS_ANIMATION_TIME = 0.35f; ///< Time to perform button scale effect.
 const float   ROTATE_ANIMATION_TIME       = 0.5f;  ///< Time to perform rotate effect.
 const int     MAX_PAGES                   = 256;   ///< Maximum pages (arbitrary safety limit)
@@ -68,6 +78,11 @@ const Vector3 SCROLLVIEW_RELATIVE_SIZE(0.9f, 1.0f, 0.8f); ///< ScrollView's rela
 const Vector3 TABLE_RELATIVE_SIZE(0.95f, 0.9f, 0.8f);     ///< TableView's relative size to the entire stage. The Y value means sum of the logo and table relative heights.
 const float   STENCIL_RELATIVE_SIZE = 1.0f;
 
+const unsigned int PLUGIN_BENCHMARK_INTERVAL = 2000; ///< Milliseconds each example runs during the plugin benchmark
+
+const char* const TILE_LABEL_NAME("TILE_LABEL");                  ///< Name of the text label within a tile
+const char* const TILE_POSITION_PROPERTY_NAME("uCustomPosition"); ///< Tile property with the scroll-view position
+
 const float   EFFECT_SNAP_DURATION  = 0.66f; ///< Scroll Snap Duration for Effects
 const float   EFFECT_FLICK_DURATION = 0.5f;  ///< Scroll Flick Duration for Effects
 const Vector3 ANGLE_CUBE_PAGE_ROTATE(Math::PI * 0.5f, Math::PI * 0.5f, 0.0f);
@@ -94,6 +109,94 @@ const unsigned int BACKGROUND_ANIMATION_DURATION = 15000; // 15 secs
 const float BUBBLE_MIN_Z = -1.0;
 const float BUBBLE_MAX_Z = 0.0f;
 
+const int   MAX_BUBBLES             = 65536 / 4; ///< The vertices of all the bubbles must be indexable with 16 bits
+const float BUBBLE_RISE_DISTANCE    = 2000.0f;   ///< Distance a bubble rises during its period, in pixels
+const float BUBBLE_MIN_PERIOD       = 30.0f;     ///< Shortest period of a bubble, in seconds
+const float BUBBLE_MAX_PERIOD       = 160.0f;    ///< Longest period of a bubble, in seconds
+const float BUBBLE_ANIMATION_PERIOD = 3600.0f;   ///< Period of the time uniform, in seconds
+const float BUBBLE_SMOOTHING        = 0.1f;      ///< Width of the anti-aliased edge of the bubbles, in distance field units
+
+// clang-format off
+
+/*
+ * Vertex shader of the bubbles, which all share a renderer.
+ * aPosition is relative to the size of the background, except for z; aMotion holds the parallax scale and the
+ * speed in pixels per second. The speed is rounded so that a bubble wraps a whole number of times per period of
+ * uTime, and doesn't jump when uTime goes back to 0.
+ */
+const char* BUBBLE_VERTEX_SHADER = DALI_COMPOSE_SHADER(
+attribute mediump vec2  aCorner;\n
+attribute highp   vec3  aPosition;\n
+attribute mediump float aSize;\n
+attribute mediump vec2  aMotion;\n
+attribute mediump vec4  aColor;\n
+attribute mediump float aShape;\n
+uniform   highp   mat4  uMvpMatrix;\n
+uniform   highp   vec3  uSize;\n
+uniform   highp   vec2  uScrollPosition;\n
+uniform   highp   float uTime;\n
+uniform   highp   float uAnimationPeriod;\n
+\n
+varying mediump vec2  vTexCoord;\n
+varying mediump vec4  vColor;\n
+varying mediump float vShape;\n
+\n
+void main()\n
+{\n
+  highp vec2 position = aPosition.xy * uSize.xy;\n
+\n
+  // Bubbles X position moves parallax to horizontal panning by a scale factor unique to each bubble.\n
+  position.x += uScrollPosition.x * aMotion.x;\n
+\n
+  // Bubbles rise, and wrap vertically.\n
+  highp float range = uSize.y + aSize;\n
+  highp float rises = floor(aMotion.y * uAnimationPeriod / range + 0.5);\n
+  position.y -= range * rises * (uTime / uAnimationPeriod);\n
+  position.y -= range * (floor(position.y / range) + 0.5);\n
+\n
+  vTexCoord = aCorner + vec2(0.5);\n
+  vColor = aColor;\n
+  vShape = aShape;\n
+  gl_Position = uMvpMatrix * vec4(position + aCorner * aSize, aPosition.z, 1.0);\n
+}\n
+);
+
+/*
+ * Fragment shader of the bubbles, which draws the distance field of their shape.
+ */
+const char* BUBBLE_FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
+uniform sampler2D     sCircle;\n
+uniform sampler2D     sBubble;\n
+uniform lowp  vec4    uColor;\n
+uniform mediump float uSmoothing;\n
+\n
+varying mediump vec2  vTexCoord;\n
+varying mediump vec4  vColor;\n
+varying mediump float vShape;\n
+\n
+void main()\n
+{\n
+  mediump float field = mix(texture2D(sCircle, vTexCoord).a, texture2D(sBubble, vTexCoord).a, vShape);\n
+  mediump float alpha = smoothstep(0.5 - uSmoothing, 0.5 + uSmoothing, field);\n
+  gl_FragColor = vec4(vColor.rgb, vColor.a * alpha) * uColor;\n
+}\n
+);
+
+// clang-format on
+
+/**
+ * A vertex of a bubble; the four vertices of a bubble only differ by their corner.
+ */
+struct BubbleVertex
+{
+  Vector2 corner;
+  Vector3 position;
+  float   size;
+  Vector2 motion;
+  Vector4 color;
+  float   shape;
+};
+
 const char* const DEMO_BUILD_DATE = __DATE__ " " __TIME__;
 
 /**
@@ -110,38 +213,6 @@ Control CreateBackground(std::string stylename)
   return background;
 }
 
-/**
- * Constraint to return a position for a bubble based on the scroll value and vertical wrapping
- */
-struct AnimateBubbleConstraint
-{
-public:
-  AnimateBubbleConstraint(const Vector3& initialPos, float scale)
-  : mInitialX(initialPos.x),
-    mScale(scale)
-  {
-  }
-
-  void operator()(Vector3& position, const PropertyInputContainer& inputs)
-  {
-    const Vector3& parentSize = inputs[1]->GetVector3();
-    const Vector3& childSize  = inputs[2]->GetVector3();
-
-    // Wrap bubbles vertically.
-    float range = parentSize.y + childSize.y;
-    // This performs a float mod (we don't use fmod as we want the arithmetic modulus as opposed to the remainder).
-    position.y -= range * (floor(position.y / range) + 0.5f);
-
-    // Bubbles X position moves parallax to horizontal
-    // panning by a scale factor unique to each bubble.
-    position.x = mInitialX + (inputs[0]->GetVector2().x * mScale);
-  }
-
-private:
-  float mInitialX;
-  float mScale;
-};
-
 /**
  * Constraint to precalculate values from the scroll-view
  * and tile positions to pass to the tile shader.
@@ -182,8 +253,103 @@ bool CompareByTitle(const Example& lhs, const Example& rhs)
   return lhs.title < rhs.title;
 }
 
+/**
+ * Reads the resident set size of the process, in kilobytes, or 0 where it is unknown
+ */
+unsigned long GetResidentSetSize()
+{
+  unsigned long residentSetSize = 0u;
+  FILE*         file            = fopen("/proc/self/status", "r");
+  if(file)
+  {
+    char line[128];
+    while(fgets(line, sizeof(line), file))
+    {
+      if(sscanf(line, "VmRSS: %lu", &residentSetSize) == 1)
+      {
+        break;
+      }
+    }
+    fclose(file);
+  }
+  return residentSetSize;
+}
+
+/**
+ * Retrieves the color a style gives to a control
+ */
+Vector4 GetStyleColor(const char* styleName)
+{
+  // The style is applied as soon as its name is set.
+  Control control = Control::New();
+  control.SetStyleName(styleName);
+  return control.GetProperty<Vector4>(Actor::Property::COLOR);
+}
+
+/**
+ * Loads a texture with all its mipmaps
+ */
+Texture LoadTexture(const char* url)
+{
+  PixelData pixelData = SyncImageLoader::Load(url);
+  Texture   texture   = Texture::New(TextureType::TEXTURE_2D, pixelData.GetPixelFormat(), pixelData.GetWidth(), pixelData.GetHeight());
+  texture.Upload(pixelData);
+  texture.GenerateMipmaps();
+  return texture;
+}
+
 } // namespace
 
+/**
+ * Tells on the event thread when a frame is updated, once asked to
+ */
+class DaliTableView::FrameObserver : public FrameCallbackInterface
+{
+public:
+  explicit FrameObserver(CallbackBase* callback)
+  : mFrameTime(),
+    mObserving(false),
+    mEventThreadCallback(new EventThreadCallback(callback))
+  {
+  }
+
+  /**
+   * Asks to be told when the next frame is updated
+   */
+  void Observe()
+  {
+    mObserving = true;
+  }
+
+  /**
+   * Retrieves the time at which the frame observed was updated
+   */
+  std::chrono::steady_clock::time_point GetFrameTime() const
+  {
+    return mFrameTime;
+  }
+
+private:
+  /**
+   * Called on the update thread for every frame
+   */
+  void Update(UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    DemoHelper::Tracer::Get().SetThreadName("Update thread");
+    DEMO_TRACE_SCOPE("FrameCallback::Update");
+
+    if(mObserving.exchange(false))
+    {
+      mFrameTime = std::chrono::steady_clock::now();
+      mEventThreadCallback->Trigger();
+    }
+  }
+
+  std::chrono::steady_clock::time_point mFrameTime; ///< Written on the update thread before the trigger
+  std::atomic<bool>                     mObserving;
+  std::unique_ptr<EventThreadCallback>  mEventThreadCallback;
+};
+
 DaliTableView::DaliTableView(Application& application)
 : mApplication(application),
   mRootActor(),
@@ -198,19 +364,42 @@ DaliTableView::DaliTableView(Application& application)
   mLogoTapDetector(),
   mVersionPopup(),
   mPages(),
+  mPopulatedPages(),
+  mTilePool(),
   mBackgroundAnimations(),
   mExampleList(),
+  mStartTime(std::chrono::steady_clock::now()),
+  mPopulateTime(0.0),
+  mFrameObserver(),
+  mExampleCount(0u),
+  mLaunchTime(),
+  mLaunchedExample(),
+  mPlugin(NULL),
+  mLauncherActors(),
+  mLauncherBackgroundColor(),
+  mPluginBenchmarkTimer(),
+  mPluginBenchmarkIndex(0u),
+  mExampleSweep(),
+  mExitCode(0),
   mPageWidth(0.0f),
   mTotalPages(),
   mScrolling(false),
   mSortAlphabetically(false),
-  mBackgroundAnimsPlaying(false)
+  mBackgroundAnimsPlaying(false),
+  mStartupReport(false),
+  mLaunchReport(false),
+  mUsePlugins(false),
+  mPluginBenchmark(false)
 {
   application.InitSignal().Connect(this, &DaliTableView::Initialize);
 }
 
 DaliTableView::~DaliTableView()
 {
+  if(mPlugin)
+  {
+    DestroyExamplePlugin(mPlugin);
+  }
 }
 
 void DaliTableView::AddExample(Example example)
@@ -223,8 +412,86 @@ void DaliTableView::SortAlphabetically(bool sortAlphabetically)
   mSortAlphabetically = sortAlphabetically;
 }
 
+void DaliTableView::ParseArguments(int argc, char** argv)
+{
+  const char   EXAMPLE_COUNT_OPTION[] = "--example-count=";
+  const size_t EXAMPLE_COUNT_LENGTH   = sizeof(EXAMPLE_COUNT_OPTION) - 1u;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strncmp(argv[i], EXAMPLE_COUNT_OPTION, EXAMPLE_COUNT_LENGTH) == 0)
+    {
+      mExampleCount = static_cast<unsigned int>(strtoul(argv[i] + EXAMPLE_COUNT_LENGTH, nullptr, 10));
+    }
+    else if(strcmp(argv[i], "--startup-report") == 0)
+    {
+      mStartupReport = true;
+    }
+    else if(strcmp(argv[i], "--launch-report") == 0)
+    {
+      mLaunchReport = true;
+      ReportExampleLaunches(true);
+    }
+    else if(strcmp(argv[i], "--plugins") == 0)
+    {
+      mUsePlugins = true;
+    }
+    else if(strcmp(argv[i], "--plugin-benchmark") == 0)
+    {
+      mPluginBenchmark = true;
+    }
+    else
+    {
+      mExampleSweep.ParseArgument(argv[i]);
+    }
+  }
+}
+
+int DaliTableView::GetExitCode() const
+{
+  return mExitCode;
+}
+
 void DaliTableView::Initialize(Application& application)
 {
+  if(mExampleSweep.IsSweep())
+  {
+    // Every example runs in a new process, so the launcher itself isn't shown
+    std::vector<std::string> processNames;
+    for(const Example& example : mExampleList)
+    {
+      processNames.push_back(example.name);
+    }
+    mExitCode = mExampleSweep.Sweep(processNames);
+    application.Quit();
+    return;
+  }
+
+  if(mExampleSweep.IsRun())
+  {
+    // The init signal is emitted again for the example, which runs alone in this process
+    application.InitSignal().Disconnect(this, &DaliTableView::Initialize);
+    mExampleSweep.StartRun(application, mStartTime);
+    if(StartPlugin(mExampleSweep.GetRunExample()))
+    {
+      mExampleSweep.RecordRun(application.GetWindow().GetRootLayer());
+    }
+    else
+    {
+      mExampleSweep.FinishRun();
+    }
+    return;
+  }
+
+  if(mUsePlugins || mPluginBenchmark)
+  {
+    // The init signal is emitted again for the examples run in this process
+    application.InitSignal().Disconnect(this, &DaliTableView::Initialize);
+  }
+
+  DemoHelper::Tracer::Get().Start(application);
+  DEMO_TRACE_SCOPE("Create");
+
   Window window = application.GetWindow();
   window.KeyEventSignal().Connect(this, &DaliTableView::OnKeyEvent);
   const Window::WindowSize windowSize = window.GetSize();
@@ -262,6 +529,7 @@ void DaliTableView::Initialize(Application& application)
   mScrollView.SetAxisAutoLock(true);
   mScrollView.ScrollCompletedSignal().Connect(this, &DaliTableView::OnScrollComplete);
   mScrollView.ScrollStartedSignal().Connect(this, &DaliTableView::OnScrollStart);
+  mScrollView.ScrollUpdatedSignal().Connect(this, &DaliTableView::OnScrollUpdate);
   mScrollView.TouchedSignal().Connect(this, &DaliTableView::OnScrollTouched);
 
   mPageWidth = windowSize.GetWidth() * TABLE_RELATIVE_SIZE.x * 0.5f;
@@ -280,7 +548,9 @@ void DaliTableView::Initialize(Application& application)
   ApplyScrollViewEffect();
 
   // Add pages and tiles
+  const std::chrono::steady_clock::time_point populateStartTime = std::chrono::steady_clock::now();
   Populate();
+  mPopulateTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - populateStartTime).count();
 
   // Remove constraints for inner cube effect
   ApplyCubeEffectToPages();
@@ -313,6 +583,20 @@ void DaliTableView::Initialize(Application& application)
   mBackgroundAnimsPlaying = true;
 
   CreateFocusEffect();
+
+  if(mStartupReport)
+  {
+    mFrameObserver.reset(new FrameObserver(MakeCallback(this, &DaliTableView::OnFrameObserved)));
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mFrameObserver, window.GetRootLayer());
+    mFrameObserver->Observe();
+  }
+
+  if(mPluginBenchmark)
+  {
+    mPluginBenchmarkTimer = Timer::New(PLUGIN_BENCHMARK_INTERVAL);
+    mPluginBenchmarkTimer.TickSignal().Connect(this, &DaliTableView::OnPluginBenchmarkTimer);
+    mPluginBenchmarkTimer.Start();
+  }
 }
 
 void DaliTableView::CreateFocusEffect()
@@ -397,80 +681,110 @@ void DaliTableView::Populate()
 {
   const Window::WindowSize windowSize = mApplication.GetWindow().GetSize();
 
+  if(mSortAlphabetically)
+  {
+    sort(mExampleList.begin(), mExampleList.end(), CompareByTitle);
+  }
+
+  // Repeat the examples to measure a bigger catalogue.
+  const size_t addedExampleCount = mExampleList.size();
+  for(size_t i = addedExampleCount; addedExampleCount > 0u && i < mExampleCount; ++i)
+  {
+    mExampleList.push_back(mExampleList[i % addedExampleCount]);
+  }
+
   mTotalPages = (mExampleList.size() + EXAMPLES_PER_PAGE - 1) / EXAMPLES_PER_PAGE;
 
-  // Populate ScrollView.
-  if(mExampleList.size() > 0)
+  // Populate ScrollView with empty pages; the tiles are only added to the pages near the scroll position.
+  for(int t = 0; t < mTotalPages; t++)
+  {
+    // Create Table
+    TableView page = TableView::New(ROWS_PER_PAGE, EXAMPLES_PER_ROW);
+    page.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    page.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    mScrollView.Add(page);
+
+    mPages.push_back(page);
+  }
+
+  mPopulatedPages.assign(mTotalPages, false);
+  UpdatePopulatedPages(0, false);
+
+  // Update Ruler info.
+  mScrollRulerX = new FixedRuler(mPageWidth);
+  mScrollRulerY = new DefaultRuler();
+  mScrollRulerX->SetDomain(RulerDomain(0.0f, (mTotalPages + 1) * windowSize.GetWidth() * TABLE_RELATIVE_SIZE.x * 0.5f, true));
+  mScrollRulerY->Disable();
+  mScrollView.SetRulerX(mScrollRulerX);
+  mScrollView.SetRulerY(mScrollRulerY);
+}
+
+void DaliTableView::UpdatePopulatedPages(int currentPage, bool releaseOthers)
+{
+  for(int pageIndex = 0; pageIndex < mTotalPages; ++pageIndex)
   {
-    if(mSortAlphabetically)
+    if(std::abs(pageIndex - currentPage) <= 1)
     {
-      sort(mExampleList.begin(), mExampleList.end(), CompareByTitle);
+      PopulatePage(pageIndex);
     }
+    else if(releaseOthers)
+    {
+      ReleasePage(pageIndex);
+    }
+  }
+}
 
-    unsigned int         exampleCount = 0;
-    ExampleListConstIter iter         = mExampleList.begin();
+void DaliTableView::PopulatePage(int pageIndex)
+{
+  if(mPopulatedPages[pageIndex])
+  {
+    return;
+  }
+  mPopulatedPages[pageIndex] = true;
 
-    for(int t = 0; t < mTotalPages; t++)
-    {
-      // Create Table
-      TableView page = TableView::New(ROWS_PER_PAGE, EXAMPLES_PER_ROW);
-      page.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-      page.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-      page.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
-      mScrollView.Add(page);
+  TableView page = TableView::DownCast(mPages[pageIndex]);
 
-      // Calculate the number of images going across (columns) within a page, according to the screen resolution and dpi.
-      const float margin               = 2.0f;
-      const float tileParentMultiplier = 1.0f / EXAMPLES_PER_ROW;
+  // Calculate the number of images going across (columns) within a page, according to the screen resolution and dpi.
+  const float tileParentMultiplier = 1.0f / EXAMPLES_PER_ROW;
 
-      for(int row = 0; row < ROWS_PER_PAGE; row++)
-      {
-        for(int column = 0; column < EXAMPLES_PER_ROW; column++)
-        {
-          const Example& example = (*iter);
-
-          // Calculate the tiles relative position on the page (between 0 & 1 in each dimension).
-          Vector2              position(static_cast<float>(column) / (EXAMPLES_PER_ROW - 1.0f), static_cast<float>(row) / (EXAMPLES_PER_ROW - 1.0f));
-          Actor                tile                 = CreateTile(example.name, example.title, Vector3(tileParentMultiplier, tileParentMultiplier, 1.0f), position);
-          AccessibilityManager accessibilityManager = AccessibilityManager::Get();
-          accessibilityManager.SetFocusOrder(tile, ++exampleCount);
-          accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_LABEL, example.title);
-          accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_TRAIT, "Tile");
-          accessibilityManager.SetAccessibilityAttribute(tile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_HINT, "You can run this example");
-
-          tile.SetProperty(Actor::Property::PADDING, Padding(margin, margin, margin, margin));
-          page.AddChild(tile, TableView::CellPosition(row, column));
-
-          iter++;
-
-          if(iter == mExampleList.end())
-          {
-            break;
-          }
-        }
+  const unsigned int firstExample = pageIndex * EXAMPLES_PER_PAGE;
+  const unsigned int lastExample  = std::min(firstExample + EXAMPLES_PER_PAGE, static_cast<unsigned int>(mExampleList.size()));
+  for(unsigned int index = firstExample; index < lastExample; ++index)
+  {
+    const int row    = (index - firstExample) / EXAMPLES_PER_ROW;
+    const int column = (index - firstExample) % EXAMPLES_PER_ROW;
 
-        if(iter == mExampleList.end())
-        {
-          break;
-        }
-      }
+    // Calculate the tiles relative position on the page (between 0 & 1 in each dimension).
+    Vector2 position(static_cast<float>(column) / (EXAMPLES_PER_ROW - 1.0f), static_cast<float>(row) / (EXAMPLES_PER_ROW - 1.0f));
+    Actor   tile = CreateTile(mExampleList[index], index, Vector3(tileParentMultiplier, tileParentMultiplier, 1.0f), position);
+    page.AddChild(tile, TableView::CellPosition(row, column));
+  }
+}
 
-      mPages.push_back(page);
+void DaliTableView::ReleasePage(int pageIndex)
+{
+  if(!mPopulatedPages[pageIndex])
+  {
+    return;
+  }
+  mPopulatedPages[pageIndex] = false;
 
-      if(iter == mExampleList.end())
+  TableView            page                 = TableView::DownCast(mPages[pageIndex]);
+  AccessibilityManager accessibilityManager = AccessibilityManager::Get();
+  for(int row = 0; row < ROWS_PER_PAGE; row++)
+  {
+    for(int column = 0; column < EXAMPLES_PER_ROW; column++)
+    {
+      Actor tile = page.RemoveChildAt(TableView::CellPosition(row, column));
+      if(tile)
       {
-        break;
+        // Take the tile out of the focus chain until it is reused.
+        accessibilityManager.SetFocusOrder(tile, 0);
+        mTilePool.push_back(tile);
       }
     }
   }
-
-  // Update Ruler info.
-  mScrollRulerX = new FixedRuler(mPageWidth);
-  mScrollRulerY = new DefaultRuler();
-  mScrollRulerX->SetDomain(RulerDomain(0.0f, (mTotalPages + 1) * windowSize.GetWidth() * TABLE_RELATIVE_SIZE.x * 0.5f, true));
-  mScrollRulerY->Disable();
-  mScrollView.SetRulerX(mScrollRulerX);
-  mScrollView.SetRulerY(mScrollRulerY);
 }
 
 void DaliTableView::Rotate(unsigned int degrees)
@@ -497,57 +811,76 @@ void DaliTableView::Rotate(unsigned int degrees)
   mRotateAnimation.Play();
 }
 
-Actor DaliTableView::CreateTile(const std::string& name, const std::string& title, const Dali::Vector3& sizeMultiplier, Vector2& position)
+Actor DaliTableView::CreateTile(const Example& example, unsigned int index, const Dali::Vector3& sizeMultiplier, const Vector2& position)
 {
-  Toolkit::ImageView focusableTile = ImageView::New();
-
-  focusableTile.SetStyleName("DemoTile");
-  focusableTile.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  focusableTile.SetResizePolicy(ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::ALL_DIMENSIONS);
-  focusableTile.SetProperty(Actor::Property::SIZE_MODE_FACTOR, sizeMultiplier);
-  focusableTile.SetProperty(Actor::Property::NAME, name);
-
-  // Set the tile to be keyboard focusable
-  focusableTile.SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+  Toolkit::ImageView focusableTile;
+  if(!mTilePool.empty())
+  {
+    // Reuse a tile of a released page; only what depends on the example and the position differs.
+    focusableTile = Toolkit::ImageView::DownCast(mTilePool.back());
+    mTilePool.pop_back();
+    focusableTile.RemoveConstraints();
+  }
+  else
+  {
+    focusableTile = ImageView::New();
+
+    focusableTile.SetStyleName("DemoTile");
+    focusableTile.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    focusableTile.SetResizePolicy(ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    focusableTile.SetProperty(Actor::Property::SIZE_MODE_FACTOR, sizeMultiplier);
+    focusableTile.SetProperty(Actor::Property::PADDING, Padding(TILE_MARGIN, TILE_MARGIN, TILE_MARGIN, TILE_MARGIN));
+
+    // Set the tile to be keyboard focusable
+    focusableTile.SetProperty(Actor::Property::KEYBOARD_FOCUSABLE, true);
+
+    // Register a property with the ImageView. This allows us to inject the scroll-view position into the shader.
+    Property::Value value = Vector3(0.0f, 0.0f, 0.0f);
+    focusableTile.RegisterProperty(TILE_POSITION_PROPERTY_NAME, value);
+
+    // Create an ImageView for the 9-patch border around the tile.
+    ImageView borderImage = ImageView::New();
+    borderImage.SetStyleName("DemoTileBorder");
+    borderImage.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    borderImage.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    borderImage.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    borderImage.SetProperty(Actor::Property::OPACITY, 0.8f);
+    focusableTile.Add(borderImage);
+
+    TextLabel label = TextLabel::New();
+    label.SetProperty(Actor::Property::NAME, TILE_LABEL_NAME);
+    label.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    label.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    label.SetStyleName("LauncherLabel");
+    label.SetProperty(TextLabel::Property::MULTI_LINE, true);
+    label.SetProperty(TextLabel::Property::HORIZONTAL_ALIGNMENT, "CENTER");
+    label.SetProperty(TextLabel::Property::VERTICAL_ALIGNMENT, "CENTER");
+    label.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::HEIGHT);
+
+    // Pad around the label as its size is the same as the 9-patch border. It will overlap it without padding.
+    label.SetProperty(Actor::Property::PADDING, Padding(TILE_LABEL_PADDING, TILE_LABEL_PADDING, TILE_LABEL_PADDING, TILE_LABEL_PADDING));
+    focusableTile.Add(label);
+
+    // Connect to the touch events
+    focusableTile.TouchedSignal().Connect(this, &DaliTableView::OnTilePressed);
+    focusableTile.HoveredSignal().Connect(this, &DaliTableView::OnTileHovered);
+  }
 
-  // Register a property with the ImageView. This allows us to inject the scroll-view position into the shader.
-  Property::Value value         = Vector3(0.0f, 0.0f, 0.0f);
-  Property::Index propertyIndex = focusableTile.RegisterProperty("uCustomPosition", value);
+  focusableTile.SetProperty(Actor::Property::NAME, example.name);
+  focusableTile.FindChildByName(TILE_LABEL_NAME).SetProperty(TextLabel::Property::TEXT, example.title);
 
   // We create a constraint to perform a precalculation on the scroll-view X offset
   // and pass it to the shader uniform, along with the tile's position.
-  Constraint shaderPosition = Constraint::New<Vector3>(focusableTile, propertyIndex, TileShaderPositionConstraint(mPageWidth, position.x));
+  Constraint shaderPosition = Constraint::New<Vector3>(focusableTile, focusableTile.GetPropertyIndex(TILE_POSITION_PROPERTY_NAME), TileShaderPositionConstraint(mPageWidth, position.x));
   shaderPosition.AddSource(Source(mScrollView, ScrollView::Property::SCROLL_POSITION));
   shaderPosition.SetRemoveAction(Constraint::DISCARD);
   shaderPosition.Apply();
-  //focusableTile.Add( tileContent );
-
-  // Create an ImageView for the 9-patch border around the tile.
-  ImageView borderImage = ImageView::New();
-  borderImage.SetStyleName("DemoTileBorder");
-  borderImage.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-  borderImage.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  borderImage.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
-  borderImage.SetProperty(Actor::Property::OPACITY, 0.8f);
-  focusableTile.Add(borderImage);
-
-  TextLabel label = TextLabel::New();
-  label.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-  label.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-  label.SetStyleName("LauncherLabel");
-  label.SetProperty(TextLabel::Property::MULTI_LINE, true);
-  label.SetProperty(TextLabel::Property::TEXT, title);
-  label.SetProperty(TextLabel::Property::HORIZONTAL_ALIGNMENT, "CENTER");
-  label.SetProperty(TextLabel::Property::VERTICAL_ALIGNMENT, "CENTER");
-  label.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::HEIGHT);
-
-  // Pad around the label as its size is the same as the 9-patch border. It will overlap it without padding.
-  label.SetProperty(Actor::Property::PADDING, Padding(TILE_LABEL_PADDING, TILE_LABEL_PADDING, TILE_LABEL_PADDING, TILE_LABEL_PADDING));
-  focusableTile.Add(label);
-
-  // Connect to the touch events
-  focusableTile.TouchedSignal().Connect(this, &DaliTableView::OnTilePressed);
-  focusableTile.HoveredSignal().Connect(this, &DaliTableView::OnTileHovered);
+
+  AccessibilityManager accessibilityManager = AccessibilityManager::Get();
+  accessibilityManager.SetFocusOrder(focusableTile, index + 1u);
+  accessibilityManager.SetAccessibilityAttribute(focusableTile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_LABEL, example.title);
+  accessibilityManager.SetAccessibilityAttribute(focusableTile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_TRAIT, "Tile");
+  accessibilityManager.SetAccessibilityAttribute(focusableTile, Dali::Toolkit::AccessibilityManager::ACCESSIBILITY_HINT, "You can run this example");
 
   return focusableTile;
 }
@@ -615,7 +948,21 @@ void DaliTableView::OnPressedAnimationFinished(Dali::Animation& source)
   {
     std::string name = mPressedActor.GetProperty<std::string>(Dali::Actor::Property::NAME);
 
-    ExecuteProcess(name, mApplication);
+    const std::chrono::steady_clock::time_point launchTime = std::chrono::steady_clock::now();
+    if(mUsePlugins && StartPlugin(name))
+    {
+      if(mLaunchReport)
+      {
+        mLaunchTime      = launchTime;
+        mLaunchedExample = name;
+        ObserveExampleFrame();
+      }
+    }
+    else
+    {
+      // The example reports its first frame itself
+      ExecuteProcess(name, mApplication);
+    }
 
     mPressedActor.Reset();
   }
@@ -625,18 +972,143 @@ void DaliTableView::OnScrollStart(const Dali::Vector2& position)
 {
   mScrolling = true;
 
+  UpdatePopulatedPages(GetPageAt(position), false);
+
   PlayAnimation();
 }
 
+void DaliTableView::OnScrollUpdate(const Dali::Vector2& position)
+{
+  // A flick can move past several pages, which must have their tiles by the time they are shown.
+  UpdatePopulatedPages(GetPageAt(position), false);
+}
+
 void DaliTableView::OnScrollComplete(const Dali::Vector2& position)
 {
   mScrolling = false;
 
+  UpdatePopulatedPages(mScrollView.GetCurrentPage(), true);
+
   // move focus to 1st item of new page
   AccessibilityManager accessibilityManager = AccessibilityManager::Get();
   accessibilityManager.SetCurrentFocusActor(mPages[mScrollView.GetCurrentPage()].GetChildAt(0));
 }
 
+bool DaliTableView::StartPlugin(const std::string& name)
+{
+  DEMO_TRACE_SCOPE("StartPlugin");
+
+  Window window    = mApplication.GetWindow();
+  Layer  rootLayer = window.GetRootLayer();
+
+  // Remember what belongs to the launcher, so that what the example adds can be removed with it.
+  mLauncherActors.clear();
+  for(unsigned int i = 0, count = rootLayer.GetChildCount(); i < count; ++i)
+  {
+    mLauncherActors.push_back(rootLayer.GetChildAt(i));
+  }
+  mLauncherBackgroundColor = window.GetBackgroundColor();
+
+  mPlugin = CreateExamplePlugin(name, mApplication);
+  if(!mPlugin)
+  {
+    return false;
+  }
+
+  if(mVersionPopup)
+  {
+    mVersionPopup.SetDisplayState(Popup::HIDDEN);
+  }
+  KeyboardFocusManager::Get().ClearFocus();
+  if(mRootActor)
+  {
+    mRootActor.SetProperty(Actor::Property::VISIBLE, false);
+  }
+
+  // The example creates its scene when the application is initialised, as it does in its own process.
+  mApplication.InitSignal().Emit(mApplication);
+  return true;
+}
+
+void DaliTableView::StopPlugin()
+{
+  DestroyExamplePlugin(mPlugin);
+  mPlugin = NULL;
+
+  Window window    = mApplication.GetWindow();
+  Layer  rootLayer = window.GetRootLayer();
+  for(unsigned int i = rootLayer.GetChildCount(); i > 0u; --i)
+  {
+    Actor actor = rootLayer.GetChildAt(i - 1u);
+    if(std::find(mLauncherActors.begin(), mLauncherActors.end(), actor) == mLauncherActors.end())
+    {
+      actor.Unparent();
+    }
+  }
+  mLauncherActors.clear();
+
+  window.SetBackgroundColor(mLauncherBackgroundColor);
+  mRootActor.SetProperty(Actor::Property::VISIBLE, true);
+}
+
+void DaliTableView::OnFrameObserved()
+{
+  const std::chrono::steady_clock::time_point frameTime = mFrameObserver->GetFrameTime();
+  printf("Launcher startup: %u examples, %d pages, populated in %.1f ms, first frame updated after %.1f ms, resident memory %lu kB\n",
+         static_cast<unsigned int>(mExampleList.size()),
+         mTotalPages,
+         mPopulateTime,
+         std::chrono::duration<double, std::milli>(frameTime - mStartTime).count(),
+         GetResidentSetSize());
+  fflush(stdout);
+}
+
+void DaliTableView::ObserveExampleFrame()
+{
+  // The frame in which the example created its scene, as the examples run in their own process report it
+  DevelWindow::AddFrameRenderedCallback(mApplication.GetWindow(), std::unique_ptr<CallbackBase>(MakeCallback(this, &DaliTableView::OnExampleFrameRendered)), 0);
+}
+
+void DaliTableView::OnExampleFrameRendered(int32_t frameId)
+{
+  if(!mLaunchedExample.empty())
+  {
+    printf("Launched %s in this process: first frame rendered after %.1f ms\n",
+           mLaunchedExample.c_str(),
+           std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mLaunchTime).count());
+    fflush(stdout);
+    mLaunchedExample.clear();
+  }
+}
+
+bool DaliTableView::OnPluginBenchmarkTimer()
+{
+  if(mPlugin)
+  {
+    StopPlugin();
+  }
+
+  while(mPluginBenchmarkIndex < mExampleList.size())
+  {
+    const std::string& name = mExampleList[mPluginBenchmarkIndex++].name;
+
+    mLaunchTime      = std::chrono::steady_clock::now();
+    mLaunchedExample = name;
+    if(StartPlugin(name))
+    {
+      ObserveExampleFrame();
+      return true;
+    }
+    printf("%s has no plugin\n", name.c_str());
+  }
+
+  printf("Plugin benchmark finished\n");
+  fflush(stdout);
+  mLaunchedExample.clear();
+  mApplication.Quit();
+  return false;
+}
+
 bool DaliTableView::OnScrollTouched(Actor actor, const TouchEvent& event)
 {
   if(PointState::DOWN == event.GetState(0))
@@ -696,6 +1168,13 @@ void DaliTableView::OnKeyEvent(const KeyEvent& event)
   {
     if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
     {
+      // The launcher handles the key before the example it runs in this process, which is closed instead of quitting.
+      if(mPlugin)
+      {
+        StopPlugin();
+        return;
+      }
+
       // If there's a Popup, Hide it if it's contributing to the display in any way (EG. transitioning in or out).
       // Otherwise quit.
       if(mVersionPopup && (mVersionPopup.GetDisplayState() != Toolkit::Popup::HIDDEN))
@@ -717,67 +1196,103 @@ void DaliTableView::SetupBackground(Actor bubbleContainer)
   AddBackgroundActors(bubbleContainer, NUM_BACKGROUND_IMAGES);
 }
 
-void DaliTableView::InitialiseBackgroundActors(Actor actor)
+void DaliTableView::AddBackgroundActors(Actor layer, int count)
 {
-  // Delete current animations
-  mBackgroundAnimations.clear();
+  count = std::min(count, MAX_BUBBLES);
 
-  // Create new animations
-  const Vector3 size = actor.GetTargetSize();
-
-  for(unsigned int i = 0, childCount = actor.GetChildCount(); i < childCount; ++i)
+  Vector4 colors[NUMBER_OF_BUBBLE_COLORS];
+  for(int i = 0; i < NUMBER_OF_BUBBLE_COLORS; ++i)
   {
-    Actor child = actor.GetChildAt(i);
-
-    // Calculate a random position
-    Vector3 childPos(Random::Range(-size.x * 0.5f * BACKGROUND_SPREAD_SCALE, size.x * 0.85f * BACKGROUND_SPREAD_SCALE),
-                     Random::Range(-size.y, size.y),
-                     Random::Range(BUBBLE_MIN_Z, BUBBLE_MAX_Z));
-
-    child.SetProperty(Actor::Property::POSITION, childPos);
-
-    // Define bubble horizontal parallax and vertical wrapping
-    Constraint animConstraint = Constraint::New<Vector3>(child, Actor::Property::POSITION, AnimateBubbleConstraint(childPos, Random::Range(-0.85f, 0.25f)));
-    animConstraint.AddSource(Source(mScrollView, ScrollView::Property::SCROLL_POSITION));
-    animConstraint.AddSource(Dali::ParentSource(Dali::Actor::Property::SIZE));
-    animConstraint.AddSource(Dali::LocalSource(Dali::Actor::Property::SIZE));
-    animConstraint.SetRemoveAction(Constraint::DISCARD);
-    animConstraint.Apply();
-
-    // Kickoff animation
-    Animation animation = Animation::New(Random::Range(30.0f, 160.0f));
-    animation.AnimateBy(Property(child, Actor::Property::POSITION), Vector3(0.0f, -2000.0f, 0.0f), AlphaFunction::LINEAR);
-    animation.SetLooping(true);
-    animation.Play();
-    mBackgroundAnimations.push_back(animation);
+    colors[i] = GetStyleColor(BUBBLE_COLOR_STYLE_NAME[i]);
   }
-}
 
-void DaliTableView::AddBackgroundActors(Actor layer, int count)
-{
+  // Every bubble is a quad, with the parameters of the bubble repeated in its four vertices.
+  const Vector2 corners[] = {Vector2(-0.5f, -0.5f), Vector2(0.5f, -0.5f), Vector2(-0.5f, 0.5f), Vector2(0.5f, 0.5f)};
+
+  std::vector<BubbleVertex> vertices;
+  std::vector<uint16_t>     indices;
+  vertices.reserve(count * 4u);
+  indices.reserve(count * 6u);
   for(int i = 0; i < count; ++i)
   {
     float randSize  = Random::Range(10.0f, 400.0f);
     int   shapeType = static_cast<int>(Random::Range(0.0f, NUMBER_OF_SHAPE_IMAGES - 1) + 0.5f);
 
-    ImageView dfActor = ImageView::New();
-    dfActor.SetProperty(Actor::Property::SIZE, Vector2(randSize, randSize));
-    dfActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    // Calculate a random position, relative to the size of the layer
+    Vector3 position(Random::Range(-0.5f * BACKGROUND_SPREAD_SCALE, 0.85f * BACKGROUND_SPREAD_SCALE),
+                     Random::Range(-1.0f, 1.0f),
+                     Random::Range(BUBBLE_MIN_Z, BUBBLE_MAX_Z));
 
-    // Set the Image URL and the custom shader at the same time
-    Dali::Property::Map effect = Toolkit::CreateDistanceFieldEffect();
-    Property::Map       imageMap;
-    imageMap.Add(ImageVisual::Property::URL, SHAPE_IMAGE_TABLE[shapeType]);
-    imageMap.Add(Toolkit::Visual::Property::SHADER, effect);
-    dfActor.SetProperty(Toolkit::ImageView::Property::IMAGE, imageMap);
+    // Define bubble horizontal parallax and rising speed
+    Vector2 motion(Random::Range(-0.85f, 0.25f), BUBBLE_RISE_DISTANCE / Random::Range(BUBBLE_MIN_PERIOD, BUBBLE_MAX_PERIOD));
 
-    dfActor.SetStyleName(BUBBLE_COLOR_STYLE_NAME[i % NUMBER_OF_BUBBLE_COLORS]);
+    const uint16_t firstVertex = static_cast<uint16_t>(vertices.size());
+    for(const Vector2& corner : corners)
+    {
+      vertices.push_back(BubbleVertex{corner, position, randSize, motion, colors[i % NUMBER_OF_BUBBLE_COLORS], static_cast<float>(shapeType)});
+    }
 
-    layer.Add(dfActor);
+    const uint16_t quadIndices[] = {0u, 1u, 2u, 2u, 1u, 3u};
+    for(uint16_t index : quadIndices)
+    {
+      indices.push_back(firstVertex + index);
+    }
   }
 
-  // Positioning will occur when the layer is relaid out
-  layer.OnRelayoutSignal().Connect(this, &DaliTableView::InitialiseBackgroundActors);
+  Property::Map vertexFormat;
+  vertexFormat["aCorner"]   = Property::VECTOR2;
+  vertexFormat["aPosition"] = Property::VECTOR3;
+  vertexFormat["aSize"]     = Property::FLOAT;
+  vertexFormat["aMotion"]   = Property::VECTOR2;
+  vertexFormat["aColor"]    = Property::VECTOR4;
+  vertexFormat["aShape"]    = Property::FLOAT;
+  VertexBuffer vertexBuffer = VertexBuffer::New(vertexFormat);
+  vertexBuffer.SetData(vertices.data(), vertices.size());
+
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+  geometry.SetIndexBuffer(indices.data(), indices.size());
+
+  TextureSet textureSet = TextureSet::New();
+  for(int i = 0; i < NUMBER_OF_SHAPE_IMAGES; ++i)
+  {
+    textureSet.SetTexture(i, LoadTexture(SHAPE_IMAGE_TABLE[i]));
+  }
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::LINEAR_MIPMAP_LINEAR, FilterMode::LINEAR);
+  for(int i = 0; i < NUMBER_OF_SHAPE_IMAGES; ++i)
+  {
+    textureSet.SetSampler(i, sampler);
+  }
+
+  Shader   shader   = Shader::New(BUBBLE_VERTEX_SHADER, BUBBLE_FRAGMENT_SHADER);
+  Renderer renderer = Renderer::New(geometry, shader);
+  renderer.SetTextures(textureSet);
+  renderer.SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+
+  Actor bubbles = Actor::New();
+  bubbles.SetProperty(Actor::Property::NAME, "BUBBLES");
+  bubbles.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+  bubbles.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  bubbles.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  bubbles.RegisterProperty("uSmoothing", BUBBLE_SMOOTHING);
+  bubbles.AddRenderer(renderer);
+  layer.Add(bubbles);
+
+  // The bubbles follow the scroll view for their parallax
+  Property::Index scrollPositionIndex = bubbles.RegisterProperty("uScrollPosition", Vector2::ZERO);
+  Constraint      scrollConstraint    = Constraint::New<Vector2>(bubbles, scrollPositionIndex, EqualToConstraint());
+  scrollConstraint.AddSource(Source(mScrollView, ScrollView::Property::SCROLL_POSITION));
+  scrollConstraint.Apply();
+
+  // A single animation drives the rise of every bubble
+  bubbles.RegisterProperty("uAnimationPeriod", BUBBLE_ANIMATION_PERIOD);
+  Property::Index timeIndex = bubbles.RegisterProperty("uTime", 0.0f);
+  Animation       animation = Animation::New(BUBBLE_ANIMATION_PERIOD);
+  animation.AnimateTo(Property(bubbles, timeIndex), BUBBLE_ANIMATION_PERIOD, AlphaFunction::LINEAR);
+  animation.SetLooping(true);
+  animation.Play();
+  mBackgroundAnimations.push_back(animation);
 }
 
 bool DaliTableView::PauseBackgroundAnimation()
@@ -858,6 +1373,7 @@ Dali::Actor DaliTableView::OnKeyboardPreFocusChange(Dali::Actor current, Dali::A
 
     // Scroll to the page in the given direction
     mScrollView.ScrollTo(newPage);
+    UpdatePopulatedPages(newPage, false);
 
     if(direction == Dali::Toolkit::Control::KeyboardFocus::LEFT)
     {
@@ -879,6 +1395,13 @@ Dali::Actor DaliTableView::OnKeyboardPreFocusChange(Dali::Actor current, Dali::A
   return nextFocusActor;
 }
 
+int DaliTableView::GetPageAt(const Dali::Vector2& position) const
+{
+  // The pages are a page width apart, and the contents move to the left as the scroll view scrolls to the right.
+  const int page = static_cast<int>(std::round(-position.x / mPageWidth));
+  return std::max(0, std::min(mTotalPages - 1, page));
+}
+
 void DaliTableView::OnFocusedActorActivated(Dali::Actor activatedActor)
 {
   if(activatedActor)
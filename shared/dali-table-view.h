@@ -21,6 +21,11 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
 #include <dali/dali.h>
+#include <chrono>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include "shared/example-sweep.h"
 
 class Example;
 
@@ -90,6 +95,31 @@ public:
    */
   void SortAlphabetically(bool sortAlphabetically);
 
+  /**
+   * Reads the launcher options from the command line:
+   *   --example-count=N  Repeats the added examples until there are N of them, to measure a bigger catalogue.
+   *   --startup-report   Prints the time taken to update the first frame and the resident memory at that point.
+   *   --launch-report    Prints the time from launching an example until its first frame is rendered. The examples run in
+   *                      this process are reported by the launcher, the others report it themselves; see ReportExampleLaunches().
+   *   --zygote           Launches the examples from a zygote; see StartExampleZygote(), which must be called by main.
+   *   --plugins          Runs the examples built as plugins in this process, hiding the launcher meanwhile.
+   *   --plugin-benchmark Runs every example built as a plugin in turn, printing how long until its first frame is rendered.
+   *   --example-sweep[=SECONDS] and its options: see DemoHelper::ExampleSweep.
+   *
+   * @param[in] argc The number of arguments
+   * @param[in] argv The arguments, once the Application has removed its own
+   *
+   * @note Should be called before the Application MainLoop is started.
+   */
+  void ParseArguments(int argc, char** argv);
+
+  /**
+   * The exit code of the launcher, non-zero if the example sweep failed.
+   *
+   * @note Should be returned by main once the Application MainLoop returns.
+   */
+  int GetExitCode() const;
+
 private:                                                      // Application callbacks & implementation
   static const unsigned int FOCUS_ANIMATION_ACTOR_NUMBER = 2; ///< The number of elements used to form the custom focus effect
 
@@ -110,12 +140,36 @@ private:                                                      // Application cal
   void Initialize(Dali::Application& app);
 
   /**
-   * Populates the contents (ScrollView) with all the
-   * Examples that have been Added using the AddExample(...)
-   * call
+   * Populates the contents (ScrollView) with a page for every
+   * EXAMPLES_PER_PAGE Examples that have been Added using the
+   * AddExample(...) call. Only the pages near the scroll position
+   * are given tiles; see UpdatePopulatedPages().
    */
   void Populate();
 
+  /**
+   * Gives tiles to the pages within one page of the given one,
+   * and optionally takes them back from all the other pages.
+   *
+   * @param[in] currentPage The page around which pages are populated.
+   * @param[in] releaseOthers Whether the tiles of the other pages are moved to the tile pool.
+   */
+  void UpdatePopulatedPages(int currentPage, bool releaseOthers);
+
+  /**
+   * Adds the tiles of its Examples to a page, unless it already has them.
+   *
+   * @param[in] pageIndex The index of the page.
+   */
+  void PopulatePage(int pageIndex);
+
+  /**
+   * Removes the tiles from a page, and keeps them in the tile pool.
+   *
+   * @param[in] pageIndex The index of the page.
+   */
+  void ReleasePage(int pageIndex);
+
   /**
    * Rotates RootActor orientation to that specified.
    *
@@ -124,16 +178,16 @@ private:                                                      // Application cal
   void Rotate(unsigned int degrees);
 
   /**
-   * Creates a tile for the main menu.
+   * Creates a tile for the main menu, or takes one from the tile pool.
    *
-   * @param[in] name The unique name for this Tile
-   * @param[in] title The text caption that appears on the Tile
-   * @param[in] parentSize Tile's parent size.
+   * @param[in] example The Example the Tile launches
+   * @param[in] index The index of the Example, which sets the accessibility focus order
+   * @param[in] sizeMultiplier Tile's size relative to its parent.
    * @param[in] position The tiles relative position within a page
    *
-   * @return The Actor for the created tile.
+   * @return The Actor for the tile.
    */
-  Dali::Actor CreateTile(const std::string& name, const std::string& title, const Dali::Vector3& sizeMultiplier, Dali::Vector2& position);
+  Dali::Actor CreateTile(const Example& example, unsigned int index, const Dali::Vector3& sizeMultiplier, const Dali::Vector2& position);
 
   // Signal handlers
 
@@ -190,6 +244,13 @@ private:                                                      // Application cal
    */
   void OnScrollStart(const Dali::Vector2& position);
 
+  /**
+   * Signal emitted while scrolling.
+   *
+   * @param[in] position The current position of the scroll contents.
+   */
+  void OnScrollUpdate(const Dali::Vector2& position);
+
   /**
    * Signal emitted when scrolling has completed.
    *
@@ -246,10 +307,13 @@ private:                                                      // Application cal
   void SetupBackground(Dali::Actor bubbleLayer);
 
   /**
-   * Create background actors for the given layer
+   * Create the background bubbles for the given layer
+   *
+   * All the bubbles are drawn by a single actor and renderer; the vertex
+   * shader moves them, so they need no constraint or animation of their own.
    *
-   * @param[in] layer The layer to add the actors to
-   * @param[in] count The number of actors to generate
+   * @param[in] layer The layer to add the bubbles to
+   * @param[in] count The number of bubbles to generate
    */
   void AddBackgroundActors(Dali::Actor layer, int count);
 
@@ -333,13 +397,53 @@ private:                                                      // Application cal
   void OnSceneConnect(Dali::Actor actor);
 
   /**
-  * @brief Callback called to set up background actors
-  *
-  * @param[in] actor The actor raising the callback
-  */
-  void InitialiseBackgroundActors(Dali::Actor actor);
+   * @brief Retrieves the page shown at a scroll position.
+   *
+   * @param[in] position The position of the scroll contents.
+   * @return The page index, within the pages.
+   */
+  int GetPageAt(const Dali::Vector2& position) const;
+
+  /**
+   * @brief Runs an example in this process, if it was built as a plugin.
+   *
+   * @param[in] name The name of the example.
+   * @return true if the example was created.
+   */
+  bool StartPlugin(const std::string& name);
+
+  /**
+   * @brief Destroys the example run by StartPlugin(), with the actors and layers it added to the window.
+   */
+  void StopPlugin();
+
+  /**
+   * @brief Called on the event thread once the frame observer has seen the first frame updated, for the startup report.
+   */
+  void OnFrameObserved();
+
+  /**
+   * @brief Reports the launch of the example run in this process once the frame its scene was created in is rendered.
+   */
+  void ObserveExampleFrame();
+
+  /**
+   * @brief Called on the event thread once the frame of the example is rendered.
+   *
+   * @param[in] frameId The id given to the callback, unused.
+   */
+  void OnExampleFrameRendered(int32_t frameId);
+
+  /**
+   * @brief Timer handler which switches to the next example of the plugin benchmark.
+   *
+   * @return Whether the timer continues.
+   */
+  bool OnPluginBenchmarkTimer();
 
 private:
+  class FrameObserver;
+
   Dali::Application&              mApplication;      ///< Application instance.
   Dali::Toolkit::Control          mRootActor;        ///< All content (excluding background is anchored to this Actor)
   Dali::Animation                 mRotateAnimation;  ///< Animation to rotate and resize mRootActor.
@@ -364,15 +468,37 @@ private:
   FocusEffect mFocusEffect[FOCUS_ANIMATION_ACTOR_NUMBER]; ///< The elements used to create the custom focus effect
 
   std::vector<Dali::Actor> mPages;                ///< List of pages.
+  std::vector<bool>        mPopulatedPages;       ///< Whether each page has its tiles.
+  std::vector<Dali::Actor> mTilePool;             ///< Tiles taken from the pages released, reused by the next pages populated.
   AnimationList            mBackgroundAnimations; ///< List of background bubble animations
   ExampleList              mExampleList;          ///< List of examples.
 
+  std::chrono::steady_clock::time_point mStartTime;       ///< When the launcher was created, for the startup report.
+  double                                mPopulateTime;    ///< Time taken by Populate(), in milliseconds.
+  std::unique_ptr<FrameObserver>        mFrameObserver;   ///< Tells when the first frame is updated, for the startup report.
+  unsigned int                          mExampleCount;    ///< The number of examples shown, 0 for those added.
+  std::chrono::steady_clock::time_point mLaunchTime;      ///< When the last example was launched, for the reports.
+  std::string                           mLaunchedExample; ///< The example launched, until its first frame is reported.
+
+  void*                    mPlugin;                  ///< The example run in this process, if any.
+  std::vector<Dali::Actor> mLauncherActors;          ///< The actors and layers of the window before the example ran.
+  Dali::Vector4            mLauncherBackgroundColor; ///< The background color of the window before the example ran.
+  Dali::Timer              mPluginBenchmarkTimer;    ///< Switches to the next example of the plugin benchmark.
+  unsigned int             mPluginBenchmarkIndex;    ///< The next example of the plugin benchmark.
+
+  DemoHelper::ExampleSweep mExampleSweep; ///< Runs every example, when asked to on the command line.
+  int                      mExitCode;     ///< The exit code of the launcher.
+
   float mPageWidth;  ///< The width of a page within the scroll-view, used to calculate the domain
   int   mTotalPages; ///< Total pages within scrollview.
 
   bool mScrolling : 1;              ///< Flag indicating whether view is currently being scrolled
   bool mSortAlphabetically : 1;     ///< Sort examples alphabetically.
   bool mBackgroundAnimsPlaying : 1; ///< Are background animations playing
+  bool mStartupReport : 1;          ///< Whether the startup is reported.
+  bool mLaunchReport : 1;           ///< Whether the launches of the examples are reported.
+  bool mUsePlugins : 1;             ///< Whether the examples built as plugins are run in this process.
+  bool mPluginBenchmark : 1;        ///< Whether the plugin benchmark runs.
 };
 
 #endif // DALI_DEMO_TABLEVIEW_H
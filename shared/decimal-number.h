@@ -0,0 +1,168 @@
+#ifndef DALI_DEMO_DECIMAL_NUMBER_H
+#define DALI_DEMO_DECIMAL_NUMBER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <cmath>
+
+namespace DemoHelper
+{
+/**
+ * @brief A number in plain or scientific decimal notation, as its significant digits and a power of ten.
+ *
+ * Text formats such as OBJ and JSON are read with ParseDecimal() and converted with ToFloat() or ToDouble(),
+ * so both give the same value for the same text. The locale is never consulted: '.' is always the decimal separator.
+ */
+struct DecimalNumber
+{
+  uint64_t mantissa{0u};            ///< Up to MAX_MANTISSA_DIGITS significant digits
+  int      exponent{0};             ///< The power of ten the mantissa is scaled by
+  bool     negative{false};         ///< Whether there was a '-' sign
+  bool     hasIntegerDigits{false}; ///< Whether there were digits before any '.', which JSON requires
+
+  static constexpr int MAX_MANTISSA_DIGITS = 19; ///< Digits that always fit in a uint64_t
+};
+
+namespace DecimalDetail
+{
+constexpr int      MAX_EXACT_DOUBLE_POWER_OF_TEN = 22;        ///< Largest power of ten exactly representable as a double
+constexpr int      MAX_EXACT_FLOAT_POWER_OF_TEN  = 10;        ///< Largest power of ten exactly representable as a float
+constexpr uint64_t MAX_EXACT_FLOAT_INTEGER       = 1u << 24u; ///< Largest integer from which all are exactly representable as a float
+
+constexpr double DOUBLE_POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+constexpr float  FLOAT_POWERS_OF_TEN[]  = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+inline bool IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline double DoublePowerOfTen(int exponent)
+{
+  return exponent <= MAX_EXACT_DOUBLE_POWER_OF_TEN ? DOUBLE_POWERS_OF_TEN[exponent] : std::pow(10.0, exponent);
+}
+
+} // namespace DecimalDetail
+
+/**
+ * @brief Parses an optionally signed decimal number, from @p it to at most @p end.
+ *
+ * Digits past MAX_MANTISSA_DIGITS only change the exponent. A number without digits parses as zero.
+ *
+ * @return The position after the number
+ */
+inline const char* ParseDecimal(const char* it, const char* end, DecimalNumber& number)
+{
+  number = DecimalNumber();
+  if(it < end && (*it == '-' || *it == '+'))
+  {
+    number.negative = (*it == '-');
+    ++it;
+  }
+
+  int digits = 0;
+  for(; it < end && DecimalDetail::IsDigit(*it); ++it)
+  {
+    number.hasIntegerDigits = true;
+    if(digits < DecimalNumber::MAX_MANTISSA_DIGITS)
+    {
+      number.mantissa = number.mantissa * 10u + static_cast<uint64_t>(*it - '0');
+      digits += (number.mantissa != 0u);
+    }
+    else
+    {
+      ++number.exponent;
+    }
+  }
+
+  if(it < end && *it == '.')
+  {
+    for(++it; it < end && DecimalDetail::IsDigit(*it); ++it)
+    {
+      if(digits < DecimalNumber::MAX_MANTISSA_DIGITS)
+      {
+        number.mantissa = number.mantissa * 10u + static_cast<uint64_t>(*it - '0');
+        digits += (number.mantissa != 0u);
+        --number.exponent;
+      }
+    }
+  }
+
+  if(it < end && (*it == 'e' || *it == 'E'))
+  {
+    ++it;
+
+    bool negativeExponent = false;
+    if(it < end && (*it == '-' || *it == '+'))
+    {
+      negativeExponent = (*it == '-');
+      ++it;
+    }
+
+    int explicitExponent = 0;
+    for(; it < end && DecimalDetail::IsDigit(*it); ++it)
+    {
+      if(explicitExponent < 10000)
+      {
+        explicitExponent = explicitExponent * 10 + (*it - '0');
+      }
+    }
+    number.exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+
+  return it;
+}
+
+/**
+ * @brief Scales the significant digits once by an exact power of ten, which is correctly rounded for common inputs.
+ */
+inline double ToDouble(const DecimalNumber& number)
+{
+  double value = static_cast<double>(number.mantissa);
+  if(number.mantissa != 0u)
+  {
+    value = (number.exponent < 0) ? value / DecimalDetail::DoublePowerOfTen(-number.exponent) : value * DecimalDetail::DoublePowerOfTen(number.exponent);
+  }
+  return number.negative ? -value : value;
+}
+
+/**
+ * @brief Converts to a float in float arithmetic when that is exact.
+ *
+ * A mantissa of up to 2^24 and a power of ten of up to 10^10 are both exact floats, so a single multiplication or
+ * division of the two is correctly rounded. That covers the numbers most exporters write, e.g. "0.123456" or
+ * "-12.5". Longer mantissas or larger exponents, e.g. the 17 digits of a round-tripped double, are scaled as a
+ * double by ToDouble() and then rounded to a float.
+ */
+inline float ToFloat(const DecimalNumber& number)
+{
+  const int magnitude = number.exponent < 0 ? -number.exponent : number.exponent;
+  if(number.mantissa <= DecimalDetail::MAX_EXACT_FLOAT_INTEGER && magnitude <= DecimalDetail::MAX_EXACT_FLOAT_POWER_OF_TEN)
+  {
+    float value = static_cast<float>(number.mantissa);
+    value       = (number.exponent < 0) ? value / DecimalDetail::FLOAT_POWERS_OF_TEN[magnitude] : value * DecimalDetail::FLOAT_POWERS_OF_TEN[magnitude];
+    return number.negative ? -value : value;
+  }
+  return static_cast<float>(ToDouble(number));
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_DECIMAL_NUMBER_H
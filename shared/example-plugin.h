@@ -0,0 +1,62 @@
+#ifndef DALI_DEMO_EXAMPLE_PLUGIN_H
+#define DALI_DEMO_EXAMPLE_PLUGIN_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/common/dali-common.h>
+
+/**
+ * @brief Entry points of an example built as a plugin, with ENABLE_EXAMPLE_PLUGINS.
+ *
+ * A launcher loads the plugin to run the example with its own Application, instead of executing the example.
+ * @see CreateExamplePlugin()
+ */
+typedef void* (*DaliDemoCreateExampleFunction)(Dali::Application& application);
+typedef void (*DaliDemoDestroyExampleFunction)(void* example);
+
+#define DALI_DEMO_CREATE_EXAMPLE_FUNCTION "DaliDemoCreateExample"
+#define DALI_DEMO_DESTROY_EXAMPLE_FUNCTION "DaliDemoDestroyExample"
+
+/**
+ * @brief Defines the plugin entry points of an example, next to its main.
+ *
+ * The plugin is built with DALI_DEMO_BUILD_PLUGIN defined, which the main of the example is guarded with, so it only
+ * has the entry points; the executable has the main only.
+ *
+ * The controller is constructed with the launcher's Application, which has already been initialised; the launcher
+ * emits the InitSignal again so that the controller creates its scene as it does in its own process.
+ *
+ * @param[in] ControllerType The class of the example, constructed from an Application
+ */
+#if defined(DALI_DEMO_BUILD_PLUGIN)
+#define DALI_DEMO_EXAMPLE_PLUGIN(ControllerType)                                          \
+  extern "C" DALI_EXPORT_API void* DaliDemoCreateExample(Dali::Application& application) \
+  {                                                                                       \
+    return new ControllerType(application);                                               \
+  }                                                                                       \
+  extern "C" DALI_EXPORT_API void DaliDemoDestroyExample(void* example)                   \
+  {                                                                                       \
+    delete static_cast<ControllerType*>(example);                                         \
+  }
+#else
+#define DALI_DEMO_EXAMPLE_PLUGIN(ControllerType)
+#endif
+
+#endif // DALI_DEMO_EXAMPLE_PLUGIN_H
@@ -0,0 +1,148 @@
+#ifndef DALI_DEMO_EXAMPLE_STARTUP_H
+#define DALI_DEMO_EXAMPLE_STARTUP_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/signals/callback.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+// INTERNAL INCLUDES
+#include "shared/trace.h"
+
+namespace DemoHelper
+{
+namespace ExampleStartup
+{
+/**
+ * @brief Set by a launcher in the environment of an example, to have it report when its first frame is rendered: the
+ * name of the example and the time it was launched, in nanoseconds of the steady clock, which is the same in every
+ * process, e.g. "hello-world.example 1234567890". It's the request a zygote is sent too, see ReportExampleLaunches().
+ */
+constexpr const char* LAUNCH_REPORT_VARIABLE = "DALI_DEMO_LAUNCH_REPORT";
+
+/**
+ * @brief If also set, the file descriptor the milliseconds until the first frame are written to, instead of the report
+ * being printed.
+ */
+constexpr const char* LAUNCH_REPORT_FD_VARIABLE = "DALI_DEMO_LAUNCH_REPORT_FD";
+
+inline std::string                           gLaunchedExample;      ///< The example to report the launch of, if any
+inline std::chrono::steady_clock::time_point gLaunchTime;           ///< When the example was launched
+inline int                                   gLaunchReportFd = -1;  ///< Where the launch is reported, -1 for the standard output
+
+/**
+ * @brief The launch report of an example launched now, see LAUNCH_REPORT_VARIABLE.
+ * @param[in] processName The name of the example executable, e.g. "hello-world.example"
+ */
+inline std::string GetLaunchReport(const std::string& processName)
+{
+  return processName + ' ' + std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Reads and clears the launch report requested in the environment, so the processes the example runs don't
+ * report it again.
+ * @return Whether the launch is reported
+ */
+inline bool ReadLaunchReport()
+{
+#if !defined(_WIN32)
+  const char* launchReport = getenv(LAUNCH_REPORT_VARIABLE);
+  if(launchReport)
+  {
+    const std::string request(launchReport);
+    const size_t      separator = request.find(' ');
+    if(separator != std::string::npos)
+    {
+      gLaunchedExample = request.substr(0u, separator);
+      gLaunchTime      = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(strtoll(request.c_str() + separator + 1u, NULL, 10)));
+    }
+
+    const char* fd  = getenv(LAUNCH_REPORT_FD_VARIABLE);
+    gLaunchReportFd = fd ? atoi(fd) : -1;
+    unsetenv(LAUNCH_REPORT_VARIABLE);
+    unsetenv(LAUNCH_REPORT_FD_VARIABLE);
+  }
+#endif
+  return !gLaunchedExample.empty();
+}
+
+/**
+ * @brief Called once the first frame of the example is rendered.
+ */
+inline void OnFirstFrameRendered(int32_t frameId)
+{
+  DEMO_TRACE_ASYNC_END("FirstFrame", 0);
+
+#if !defined(_WIN32)
+  if(!gLaunchedExample.empty())
+  {
+    const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - gLaunchTime).count();
+    if(gLaunchReportFd >= 0)
+    {
+      dprintf(gLaunchReportFd, "%.3f\n", milliseconds);
+      close(gLaunchReportFd);
+    }
+    else
+    {
+      printf("Launched %s: first frame rendered after %.1f ms\n", gLaunchedExample.c_str(), milliseconds);
+      fflush(stdout);
+    }
+    gLaunchedExample.clear();
+  }
+#endif
+}
+
+} // namespace ExampleStartup
+
+/**
+ * @brief The instrumentation shared by every example; call it first thing when the application is initialised, from
+ * the handler of its InitSignal, whether the example runs in its own process or from its plugin.
+ *
+ * It starts the tracer (see Tracer::Start()) and traces a "FirstFrame" span, from the creation of the example until
+ * its first frame is rendered, so the start of any example can be seen in a trace without instrumenting it further.
+ * When its launcher asks for it (see ExampleStartup::LAUNCH_REPORT_VARIABLE), the example reports how long after
+ * its launch that frame is rendered.
+ *
+ * @param[in] application The application of the example
+ */
+inline void StartExample(Dali::Application& application)
+{
+  Tracer& tracer = Tracer::Get();
+  tracer.Start(application);
+  DEMO_TRACE_ASYNC_BEGIN("FirstFrame", 0);
+  if(ExampleStartup::ReadLaunchReport() || tracer.IsEnabled())
+  {
+    Dali::DevelWindow::AddFrameRenderedCallback(application.GetWindow(), std::unique_ptr<Dali::CallbackBase>(Dali::MakeCallback(&ExampleStartup::OnFirstFrameRendered)), 0);
+  }
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_EXAMPLE_STARTUP_H
@@ -0,0 +1,676 @@
+#ifndef DALI_DEMO_EXAMPLE_SWEEP_H
+#define DALI_DEMO_EXAMPLE_SWEEP_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/stage-devel.h>
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/common/stage.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/execute-process.h"
+#include "shared/frame-timing-recorder.h"
+#include "shared/json-reader.h"
+#include "shared/mapped-file.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief Runs every example of a launcher in turn, as a smoke test and to catch performance regressions.
+ *
+ * With --example-sweep, the launcher runs itself once per example, each time in a new process which only runs that
+ * example, from its plugin (see ENABLE_EXAMPLE_PLUGINS), for the given number of seconds. Every run reports the time
+ * from the start of its process to the first frame of the example, the frame time statistics once warmed up, and
+ * its peak resident memory and number of threads. Runs that crash, hang or can't report are counted as failed.
+ *
+ * An example without a plugin, as every example in the default build, is smoke tested instead: its executable runs for
+ * as many seconds, and fails if it crashes or exits with an error before then. The launcher measures it meanwhile: the
+ * time from its launch to its first frame, which the example reports (see DemoHelper::StartExample()), and its peak
+ * resident memory and number of threads. It has no frame time statistics.
+ *
+ * All the results are written to one JSON report. Given the report of a previous sweep as a baseline, the examples
+ * that now fail, or whose startup time, 95th percentile frame time, peak memory or peak number of threads grew by
+ * more than the threshold, are listed as regressions and the sweep fails. A metric the baseline lacks isn't compared.
+ *
+ * Only a window is needed, so the sweep runs without a GPU on a virtual X server with a software GL stack:
+ * @code
+ * xvfb-run -a -s "-screen 0 1280x800x24" env LIBGL_ALWAYS_SOFTWARE=1 \
+ *   dali-examples --example-sweep=10 --example-sweep-baseline=baseline.json
+ * @endcode
+ */
+class ExampleSweep : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @brief Parses an argument of the launcher.
+   * @return true if the argument is an option of the sweep
+   */
+  bool ParseArgument(const std::string& argument)
+  {
+    if(HasPrefix(argument, REPORT_OPTION))
+    {
+      mReportPath = argument.substr(strlen(REPORT_OPTION));
+    }
+    else if(HasPrefix(argument, BASELINE_OPTION))
+    {
+      mBaselinePath = argument.substr(strlen(BASELINE_OPTION));
+    }
+    else if(HasPrefix(argument, THRESHOLD_OPTION))
+    {
+      mThreshold = static_cast<float>(atof(argument.c_str() + strlen(THRESHOLD_OPTION)));
+    }
+    else if(HasPrefix(argument, RUN_OPTION))
+    {
+      mRunExample = argument.substr(strlen(RUN_OPTION));
+    }
+    else if(HasPrefix(argument, OUTPUT_OPTION))
+    {
+      mOutputPath = argument.substr(strlen(OUTPUT_OPTION));
+    }
+    else if(HasPrefix(argument, DURATION_OPTION))
+    {
+      mDuration = std::max(static_cast<float>(atof(argument.c_str() + strlen(DURATION_OPTION))), 0.0f);
+    }
+    else if(argument == SWEEP_OPTION)
+    {
+      mDuration = DEFAULT_DURATION;
+    }
+    else
+    {
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Whether the launcher should run the sweep rather than show its examples.
+   */
+  bool IsSweep() const
+  {
+    return mDuration > 0.0f && mRunExample.empty();
+  }
+
+  /**
+   * @brief Whether the launcher was run by a sweep, to run only one example.
+   */
+  bool IsRun() const
+  {
+    return !mRunExample.empty();
+  }
+
+  /**
+   * @brief The example to run, the process name given to CreateExamplePlugin().
+   */
+  const std::string& GetRunExample() const
+  {
+    return mRunExample;
+  }
+
+  /**
+   * @brief Runs every example in a new process, writes the report and compares it with the baseline.
+   * @param[in] processNames The process names of the examples
+   * @return The exit code for the launcher, 0 if every example ran and none regressed
+   */
+  int Sweep(const std::vector<std::string>& processNames)
+  {
+    const std::string outputPath = mReportPath + ".run.json";
+
+    std::vector<Result> results;
+    bool                succeeded = true;
+    for(size_t i = 0u; i < processNames.size(); ++i)
+    {
+      printf("[%zu/%zu] %s\n", i + 1u, processNames.size(), processNames[i].c_str());
+      fflush(stdout);
+
+      remove(outputPath.c_str());
+      const std::vector<std::string> arguments{RUN_OPTION + processNames[i], OUTPUT_OPTION + outputPath, DURATION_OPTION + FormatValue(mDuration)};
+
+      Result result;
+      result.example  = processNames[i];
+      result.exitCode = ExecuteLauncherAndWait(arguments);
+      if(result.exitCode != 0 || !ReadRun(outputPath, result))
+      {
+        result.status = FAILED;
+      }
+      else if(result.status == NO_PLUGIN)
+      {
+        SmokeTest(result);
+      }
+
+      if(result.status == FAILED)
+      {
+        fprintf(stderr, "%s failed (exit code %d)\n", processNames[i].c_str(), result.exitCode);
+        succeeded = false;
+      }
+      results.push_back(std::move(result));
+    }
+    remove(outputPath.c_str());
+
+    std::vector<Regression> regressions;
+    if(!mBaselinePath.empty())
+    {
+      std::vector<Result> baseline;
+      if(!ReadReport(mBaselinePath, baseline))
+      {
+        fprintf(stderr, "Failed to read the baseline %s\n", mBaselinePath.c_str());
+        succeeded = false;
+      }
+      regressions = Compare(results, baseline);
+    }
+
+    if(!WriteReport(results, regressions))
+    {
+      fprintf(stderr, "Failed to write the report to %s\n", mReportPath.c_str());
+      return 1;
+    }
+
+    const auto countStatus = [&results](const char* status) {
+      return std::count_if(results.begin(), results.end(), [status](const Result& result) { return result.status == status; });
+    };
+    printf("%zu examples: %td ran, %td smoke tested without plugin, %td failed\n",
+           results.size(),
+           countStatus(OK),
+           countStatus(SMOKE_TESTED),
+           countStatus(FAILED));
+    for(const Regression& regression : regressions)
+    {
+      printf("Regression: %s %s %s -> %s\n",
+             regression.example.c_str(),
+             regression.metric.c_str(),
+             FormatValue(regression.baseline).c_str(),
+             FormatValue(regression.value).c_str());
+    }
+    printf("Report written to %s\n", mReportPath.c_str());
+
+    return succeeded && regressions.empty() ? 0 : 1;
+  }
+
+  /**
+   * @brief Starts the run of an example, before the example is created; the process exits if the run hangs.
+   * @param[in] application The application, quit when the run finishes
+   * @param[in] processStartTime When the process started, as close as known
+   */
+  void StartRun(Dali::Application& application, std::chrono::steady_clock::time_point processStartTime)
+  {
+    mApplication      = &application;
+    mProcessStartTime = processStartTime;
+
+    const std::chrono::milliseconds timeout(static_cast<long>((mDuration + RUN_TIMEOUT_MARGIN) * 1000.0f));
+    std::thread([timeout]() {
+      std::this_thread::sleep_for(timeout);
+      std::_Exit(RUN_TIMEOUT_EXIT_CODE);
+    }).detach();
+  }
+
+  /**
+   * @brief Records the frames of the example created since StartRun(), then finishes the run.
+   * @param[in] rootActor The actor the frame callback is added to
+   */
+  void RecordRun(Dali::Actor rootActor)
+  {
+    mRecorder.StartPhase(WARM_UP_PHASE);
+    Dali::DevelStage::AddFrameCallback(Dali::Stage::GetCurrent(), mRecorder, rootActor);
+    mRecording     = true;
+    mRunStartTime  = std::chrono::steady_clock::now();
+    mSampleTimer   = Dali::Timer::New(SAMPLE_INTERVAL);
+    mSampleTimer.TickSignal().Connect(this, &ExampleSweep::OnSampleTimer);
+    mSampleTimer.Start();
+    Sample();
+  }
+
+  /**
+   * @brief Writes the results of the run and quits; called by RecordRun() once done, or if the example has no plugin.
+   */
+  void FinishRun()
+  {
+    Result result;
+    result.example = mRunExample;
+    result.status  = mRecording ? OK : NO_PLUGIN;
+    if(mRecording)
+    {
+      // stop the update thread from recording before reading the frames
+      Dali::DevelStage::RemoveFrameCallback(Dali::Stage::GetCurrent(), mRecorder);
+      mRecording = false;
+
+      Sample();
+      std::chrono::steady_clock::time_point firstFrameTime;
+      if(mRecorder.GetFirstFrameTime(firstFrameTime))
+      {
+        result.startupTime = std::chrono::duration<double, std::milli>(firstFrameTime - mProcessStartTime).count();
+      }
+      for(const PhaseStatistics& phase : mRecorder.GetStatistics())
+      {
+        if(phase.name == STEADY_PHASE)
+        {
+          result.frames = phase;
+        }
+      }
+      result.peakResidentSetSize = mPeakResidentSetSize;
+      result.peakThreadCount     = mPeakThreadCount;
+    }
+
+    FILE* file = fopen(mOutputPath.c_str(), "w");
+    if(file)
+    {
+      WriteResult(file, result);
+      fprintf(file, "\n");
+      fclose(file);
+    }
+    mApplication->Quit();
+  }
+
+private:
+  typedef FrameTimingRecorder::PhaseStatistics PhaseStatistics;
+
+  static constexpr const char* SWEEP_OPTION     = "--example-sweep";
+  static constexpr const char* DURATION_OPTION  = "--example-sweep=";
+  static constexpr const char* REPORT_OPTION    = "--example-sweep-report=";
+  static constexpr const char* BASELINE_OPTION  = "--example-sweep-baseline=";
+  static constexpr const char* THRESHOLD_OPTION = "--example-sweep-threshold=";
+  static constexpr const char* RUN_OPTION       = "--example-sweep-run=";
+  static constexpr const char* OUTPUT_OPTION    = "--example-sweep-output=";
+
+  static constexpr const char* OK           = "ok";
+  static constexpr const char* NO_PLUGIN    = "no-plugin"; ///< Only reported by the run, before the example is smoke tested
+  static constexpr const char* SMOKE_TESTED = "smoke-tested";
+  static constexpr const char* FAILED       = "failed";
+
+  static constexpr const char* WARM_UP_PHASE = "warm-up";
+  static constexpr const char* STEADY_PHASE  = "steady";
+
+  static constexpr float        DEFAULT_DURATION      = 10.0f; ///< Seconds each example runs
+  static constexpr float        MAXIMUM_WARM_UP       = 2.0f;  ///< Seconds before the frames are measured, at most a quarter of the run
+  static constexpr float        RUN_TIMEOUT_MARGIN    = 30.0f; ///< Seconds a run may overrun before it is deemed hung
+  static constexpr int          RUN_TIMEOUT_EXIT_CODE = 124;
+  static constexpr unsigned int SAMPLE_INTERVAL       = 100u; ///< Milliseconds between samples of the memory and threads
+
+  struct Result
+  {
+    std::string     example;
+    std::string     status{FAILED};
+    int             exitCode{0};
+    double          startupTime{0.0};        ///< From the start of the process, or the launch of the executable, to the first frame of the example, in milliseconds
+    PhaseStatistics frames;                  ///< Once warmed up
+    uint32_t        peakResidentSetSize{0u}; ///< In kB
+    uint32_t        peakThreadCount{0u};
+  };
+
+  struct Regression
+  {
+    std::string example;
+    std::string metric;
+    double      baseline;
+    double      value;
+  };
+
+  static bool HasPrefix(const std::string& text, const char* prefix)
+  {
+    return text.compare(0, strlen(prefix), prefix) == 0;
+  }
+
+  static std::string FormatValue(double value)
+  {
+    char text[32];
+    snprintf(text, sizeof(text), "%g", value);
+    return text;
+  }
+
+  /**
+   * @brief Reads a value in kB, or a count, from /proc/self/status, e.g. "VmHWM" or "Threads"; 0 if unavailable.
+   */
+  static uint32_t ReadProcessStatus(const char* key)
+  {
+    uint32_t value = 0u;
+    FILE*    file  = fopen("/proc/self/status", "r");
+    if(file)
+    {
+      const size_t keyLength = strlen(key);
+      char         line[256];
+      while(fgets(line, sizeof(line), file))
+      {
+        if(strncmp(line, key, keyLength) == 0 && line[keyLength] == ':')
+        {
+          value = static_cast<uint32_t>(strtoul(line + keyLength + 1u, nullptr, 10));
+          break;
+        }
+      }
+      fclose(file);
+    }
+    return value;
+  }
+
+  /**
+   * @brief Runs the executable of an example without a plugin for the duration of a run, then terminates it; it fails
+   * if it crashes or exits with an error before then. Its startup time, peak memory and threads are measured meanwhile.
+   */
+  void SmokeTest(Result& result) const
+  {
+    ExecuteProcessStatistics statistics;
+    const int                exitCode = ExecuteProcessAndWait(result.example, std::vector<std::string>(), static_cast<unsigned int>(mDuration * 1000.0f), statistics);
+    if(exitCode == 0 || exitCode == EXECUTE_PROCESS_TIMED_OUT)
+    {
+      result.status              = SMOKE_TESTED;
+      result.startupTime         = statistics.firstFrameTime;
+      result.peakResidentSetSize = statistics.peakResidentSetSize;
+      result.peakThreadCount     = statistics.peakThreadCount;
+    }
+    else
+    {
+      result.status   = FAILED;
+      result.exitCode = exitCode;
+    }
+  }
+
+  void Sample()
+  {
+    mPeakResidentSetSize = std::max(mPeakResidentSetSize, ReadProcessStatus("VmHWM"));
+    mPeakThreadCount     = std::max(mPeakThreadCount, ReadProcessStatus("Threads"));
+  }
+
+  bool OnSampleTimer()
+  {
+    Sample();
+
+    const float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - mRunStartTime).count();
+    if(!mSteady && elapsed >= std::min(MAXIMUM_WARM_UP, mDuration * 0.25f))
+    {
+      mRecorder.StartPhase(STEADY_PHASE);
+      mSteady = true;
+    }
+    if(elapsed >= mDuration)
+    {
+      FinishRun();
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Lists the metrics that grew by more than the threshold, and the examples that ran in the baseline but failed.
+   * The metrics missing from the baseline, such as the frame times of a smoke test, are not compared.
+   */
+  std::vector<Regression> Compare(const std::vector<Result>& results, const std::vector<Result>& baseline) const
+  {
+    std::vector<Regression> regressions;
+    for(const Result& result : results)
+    {
+      auto previous = std::find_if(baseline.begin(), baseline.end(), [&result](const Result& previous) { return previous.example == result.example; });
+      if(previous == baseline.end() || previous->status == FAILED)
+      {
+        continue;
+      }
+      if(result.status == FAILED)
+      {
+        regressions.push_back(Regression{result.example, "status", 0.0, 0.0});
+        continue;
+      }
+
+      const struct
+      {
+        const char* name;
+        double      baseline;
+        double      value;
+      } metrics[] = {
+        {"startupMs", previous->startupTime, result.startupTime},
+        {"p95Ms", previous->frames.p95, result.frames.p95},
+        {"peakRssKb", static_cast<double>(previous->peakResidentSetSize), static_cast<double>(result.peakResidentSetSize)},
+        {"peakThreads", static_cast<double>(previous->peakThreadCount), static_cast<double>(result.peakThreadCount)}};
+
+      for(const auto& metric : metrics)
+      {
+        if(metric.baseline > 0.0 && metric.value > metric.baseline * (1.0 + mThreshold / 100.0))
+        {
+          regressions.push_back(Regression{result.example, metric.name, metric.baseline, metric.value});
+        }
+      }
+    }
+    return regressions;
+  }
+
+  static void WriteResult(FILE* file, const Result& result)
+  {
+    fprintf(file,
+            "{\"example\": %s, \"status\": %s, \"exitCode\": %d, \"startupMs\": %.3f, \"peakRssKb\": %u, \"peakThreads\": %u, \"frames\": ",
+            FrameTimingRecorder::Quote(result.example).c_str(),
+            FrameTimingRecorder::Quote(result.status).c_str(),
+            result.exitCode,
+            result.startupTime,
+            result.peakResidentSetSize,
+            result.peakThreadCount);
+    FrameTimingRecorder::WriteJson(file, result.frames);
+    fprintf(file, "}");
+  }
+
+  bool WriteReport(const std::vector<Result>& results, const std::vector<Regression>& regressions) const
+  {
+    FILE* file = fopen(mReportPath.c_str(), "w");
+    if(!file)
+    {
+      return false;
+    }
+
+    fprintf(file,
+            "{\n  \"durationSeconds\": %s,\n  \"thresholdPercent\": %s,\n  \"baseline\": %s,\n  \"examples\": [",
+            FormatValue(mDuration).c_str(),
+            FormatValue(mThreshold).c_str(),
+            mBaselinePath.empty() ? "null" : FrameTimingRecorder::Quote(mBaselinePath).c_str());
+    for(size_t i = 0u; i < results.size(); ++i)
+    {
+      fprintf(file, "%s\n    ", i ? "," : "");
+      WriteResult(file, results[i]);
+    }
+    fprintf(file, "\n  ],\n  \"regressions\": [");
+    for(size_t i = 0u; i < regressions.size(); ++i)
+    {
+      const Regression& regression = regressions[i];
+      fprintf(file,
+              "%s\n    {\"example\": %s, \"metric\": %s, \"baseline\": %.3f, \"value\": %.3f}",
+              i ? "," : "",
+              FrameTimingRecorder::Quote(regression.example).c_str(),
+              FrameTimingRecorder::Quote(regression.metric).c_str(),
+              regression.baseline,
+              regression.value);
+    }
+    fprintf(file, "%s]\n}\n", regressions.empty() ? "" : "\n  ");
+
+    return fclose(file) == 0;
+  }
+
+  /**
+   * @brief Reads an object written by WriteResult(); the members not read are left as they are.
+   */
+  static bool ReadResult(JsonReader& reader, Result& result)
+  {
+    if(!reader.EnterObject())
+    {
+      return false;
+    }
+
+    std::string_view key;
+    while(reader.NextMember(key))
+    {
+      if(key == "example")
+      {
+        reader.ReadString(result.example);
+      }
+      else if(key == "status")
+      {
+        reader.ReadString(result.status);
+      }
+      else if(key == "startupMs")
+      {
+        reader.ReadNumber(result.startupTime);
+      }
+      else if(key == "peakRssKb")
+      {
+        reader.ReadNumber(result.peakResidentSetSize);
+      }
+      else if(key == "peakThreads")
+      {
+        reader.ReadNumber(result.peakThreadCount);
+      }
+      else if(key == "frames" && reader.EnterObject())
+      {
+        while(reader.NextMember(key))
+        {
+          if(key == "name")
+          {
+            reader.ReadString(result.frames.name);
+          }
+          else if(key == "frames")
+          {
+            reader.ReadNumber(result.frames.frameCount);
+          }
+          else if(key == "droppedFrames")
+          {
+            reader.ReadNumber(result.frames.droppedFrameCount);
+          }
+          else if(key == "durationMs")
+          {
+            reader.ReadNumber(result.frames.duration);
+          }
+          else if(key == "minMs")
+          {
+            reader.ReadNumber(result.frames.minimum);
+          }
+          else if(key == "avgMs")
+          {
+            reader.ReadNumber(result.frames.average);
+          }
+          else if(key == "p50Ms")
+          {
+            reader.ReadNumber(result.frames.p50);
+          }
+          else if(key == "p95Ms")
+          {
+            reader.ReadNumber(result.frames.p95);
+          }
+          else if(key == "p99Ms")
+          {
+            reader.ReadNumber(result.frames.p99);
+          }
+          else if(key == "maxMs")
+          {
+            reader.ReadNumber(result.frames.maximum);
+          }
+          else
+          {
+            reader.Skip();
+          }
+        }
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
+    return !reader.HasError();
+  }
+
+  /**
+   * @brief Reads the results written by the process that ran an example.
+   */
+  static bool ReadRun(const std::string& path, Result& result)
+  {
+    MappedFile file(path);
+    if(file.IsEmpty())
+    {
+      return false;
+    }
+
+    const char* text = reinterpret_cast<const char*>(file.GetData());
+    JsonReader  reader(text, text + file.GetSize());
+    return ReadResult(reader, result);
+  }
+
+  /**
+   * @brief Reads the results of every example from the report of a previous sweep.
+   */
+  static bool ReadReport(const std::string& path, std::vector<Result>& results)
+  {
+    MappedFile file(path);
+    if(file.IsEmpty())
+    {
+      return false;
+    }
+
+    const char* text = reinterpret_cast<const char*>(file.GetData());
+    JsonReader  reader(text, text + file.GetSize());
+    if(!reader.EnterObject())
+    {
+      return false;
+    }
+
+    std::string_view key;
+    while(reader.NextMember(key))
+    {
+      if(key == "examples" && reader.EnterArray())
+      {
+        while(reader.NextElement())
+        {
+          Result result;
+          if(ReadResult(reader, result))
+          {
+            results.push_back(std::move(result));
+          }
+        }
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
+    return !reader.HasError();
+  }
+
+private:
+  std::string                           mReportPath{"example-sweep.json"};
+  std::string                           mBaselinePath;
+  std::string                           mRunExample; ///< Only set in the process that runs an example
+  std::string                           mOutputPath;
+  float                                 mDuration{0.0f}; ///< Seconds each example runs, 0 without a sweep
+  float                                 mThreshold{10.0f}; ///< Percentage of growth deemed a regression
+  Dali::Application*                    mApplication{nullptr};
+  std::chrono::steady_clock::time_point mProcessStartTime;
+  std::chrono::steady_clock::time_point mRunStartTime;
+  Dali::Timer                           mSampleTimer;
+  FrameTimingRecorder                   mRecorder;
+  uint32_t                              mPeakResidentSetSize{0u};
+  uint32_t                              mPeakThreadCount{0u};
+  bool                                  mRecording{false};
+  bool                                  mSteady{false};
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_EXAMPLE_SWEEP_H
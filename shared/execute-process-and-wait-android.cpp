@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include "execute-process.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout)
+{
+  // Examples are launched as activities, which can't be waited for
+  DALI_LOG_ERROR("Running %s and waiting for it is not supported.\n", processName.c_str());
+  return -1;
+}
+
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout, ExecuteProcessStatistics& statistics)
+{
+  return ExecuteProcessAndWait(processName, arguments, timeout);
+}
+
+int ExecuteLauncherAndWait(const std::vector<std::string>& arguments)
+{
+  DALI_LOG_ERROR("Running the launcher again is not supported.\n");
+  return -1;
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include "execute-process.h"
+
+// INTERNAL INCLUDES
+#include "example-startup.h"
+
+// EXTERNAL INCLUDES
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace
+{
+const unsigned int WAIT_POLL_INTERVAL  = 10000u; ///< Microseconds between checks of a process waited for with a timeout
+const unsigned int TERMINATION_TIMEOUT = 5000u;  ///< Milliseconds a process that timed out has to exit once terminated
+
+/**
+ * Samples the peak resident memory and the number of threads of a child process.
+ */
+void SampleProcess(pid_t pid, ExecuteProcessStatistics& statistics)
+{
+  char path[32];
+  snprintf(path, sizeof(path), "/proc/%d/status", static_cast<int>(pid));
+  FILE* file = fopen(path, "r");
+  if(!file)
+  {
+    return;
+  }
+
+  char line[256];
+  while(fgets(line, sizeof(line), file))
+  {
+    if(strncmp(line, "VmHWM:", 6u) == 0)
+    {
+      // Already a peak, which starts again once the child has executed the program
+      statistics.peakResidentSetSize = static_cast<uint32_t>(strtoul(line + 6u, NULL, 10));
+    }
+    else if(strncmp(line, "Threads:", 8u) == 0)
+    {
+      statistics.peakThreadCount = std::max(statistics.peakThreadCount, static_cast<uint32_t>(strtoul(line + 8u, NULL, 10)));
+    }
+  }
+  fclose(file);
+}
+
+/**
+ * Waits for a child process to exit; once the timeout expires, it's terminated, then killed if it still runs.
+ * With statistics, the child is sampled while it runs.
+ */
+int WaitForExit(pid_t pid, unsigned int timeout, ExecuteProcessStatistics* statistics)
+{
+  std::chrono::steady_clock::time_point deadline          = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+  int                                   terminationSignal = SIGTERM;
+  bool                                  timedOut          = false;
+  int                                   status            = 0;
+  while(true)
+  {
+    const pid_t exited = waitpid(pid, &status, timeout > 0u || statistics ? WNOHANG : 0);
+    if(exited == pid)
+    {
+      return timedOut ? EXECUTE_PROCESS_TIMED_OUT : (WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    }
+    if(exited < 0 && errno != EINTR)
+    {
+      return -1;
+    }
+    if(exited == 0)
+    {
+      if(statistics)
+      {
+        SampleProcess(pid, *statistics);
+      }
+      if(timeout > 0u && std::chrono::steady_clock::now() >= deadline)
+      {
+        kill(pid, terminationSignal);
+        terminationSignal = SIGKILL;
+        timedOut          = true;
+        deadline          = std::chrono::steady_clock::now() + std::chrono::milliseconds(TERMINATION_TIMEOUT);
+      }
+      usleep(WAIT_POLL_INTERVAL);
+    }
+  }
+}
+
+/**
+ * Executes a program with the given arguments and waits for it to exit, or terminates it once the timeout expires.
+ * With statistics, the program is an example which reports its first frame through a pipe, see DemoHelper::StartExample().
+ */
+int ExecuteAndWait(const std::string& path, const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout, ExecuteProcessStatistics* statistics)
+{
+  std::vector<char*> argv;
+  argv.push_back(const_cast<char*>(processName.c_str()));
+  for(const std::string& argument : arguments)
+  {
+    argv.push_back(const_cast<char*>(argument.c_str()));
+  }
+  argv.push_back(NULL);
+
+  // The environment is prepared before forking, as the child may only call exec
+  int reportPipe[2] = {-1, -1};
+  if(statistics && pipe2(reportPipe, O_CLOEXEC | O_NONBLOCK) != 0)
+  {
+    return -1;
+  }
+  std::string        launchReport;
+  std::string        launchReportFd;
+  std::vector<char*> environment;
+  for(char** variable = environ; *variable; ++variable)
+  {
+    environment.push_back(*variable);
+  }
+  if(statistics)
+  {
+    launchReportFd = std::string(DemoHelper::ExampleStartup::LAUNCH_REPORT_FD_VARIABLE) + '=' + std::to_string(reportPipe[1]);
+    launchReport   = std::string(DemoHelper::ExampleStartup::LAUNCH_REPORT_VARIABLE) + '=' + DemoHelper::ExampleStartup::GetLaunchReport(processName);
+    environment.push_back(const_cast<char*>(launchReportFd.c_str()));
+    environment.push_back(const_cast<char*>(launchReport.c_str()));
+  }
+  environment.push_back(NULL);
+
+  pid_t pid = fork();
+  if(pid == 0)
+  {
+    if(statistics)
+    {
+      // The example inherits the end it writes to
+      fcntl(reportPipe[1], F_SETFD, 0);
+    }
+    execve(path.c_str(), argv.data(), environment.data());
+    _exit(127);
+  }
+
+  int exitCode = -1;
+  if(pid > 0)
+  {
+    if(statistics)
+    {
+      close(reportPipe[1]);
+      reportPipe[1] = -1;
+    }
+    exitCode = WaitForExit(pid, timeout, statistics);
+  }
+
+  if(statistics)
+  {
+    char          report[32];
+    const ssize_t size = read(reportPipe[0], report, sizeof(report) - 1u);
+    if(size > 0)
+    {
+      report[size]               = '\0';
+      statistics->firstFrameTime = strtod(report, NULL);
+    }
+    close(reportPipe[0]);
+    if(reportPipe[1] >= 0)
+    {
+      close(reportPipe[1]);
+    }
+  }
+  return exitCode;
+}
+
+} // namespace
+
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout)
+{
+  std::stringstream stream;
+  stream << DEMO_EXAMPLE_BIN << processName.c_str();
+  return ExecuteAndWait(stream.str(), processName, arguments, timeout, NULL);
+}
+
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout, ExecuteProcessStatistics& statistics)
+{
+  std::stringstream stream;
+  stream << DEMO_EXAMPLE_BIN << processName.c_str();
+  statistics = ExecuteProcessStatistics();
+  return ExecuteAndWait(stream.str(), processName, arguments, timeout, &statistics);
+}
+
+int ExecuteLauncherAndWait(const std::vector<std::string>& arguments)
+{
+  return ExecuteAndWait("/proc/self/exe", program_invocation_name, arguments, 0u, NULL);
+}
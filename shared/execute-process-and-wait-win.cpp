@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// FILE HEADER
+#include "execute-process.h"
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+#include <windows.h>
+
+namespace
+{
+const std::string PATH_SEPARATOR("\\");
+
+std::string GetProcessPathName(const std::string& processName)
+{
+  std::string processPathName;
+
+  const bool isRelativePath = '.' == DEMO_EXAMPLE_BIN[0];
+  if(isRelativePath)
+  {
+    char  currentPath[MAX_PATH];
+    DWORD numberOfCharacters = GetCurrentDirectory(MAX_PATH, currentPath);
+
+    if(0u == numberOfCharacters)
+    {
+      DALI_ASSERT_ALWAYS(!"Failed to retrieve the current working directory");
+    }
+
+    currentPath[numberOfCharacters] = '\0';
+    processPathName                 = std::string(currentPath) + PATH_SEPARATOR + DEMO_EXAMPLE_BIN + PATH_SEPARATOR + processName + ".exe";
+  }
+  else
+  {
+    processPathName = DEMO_EXAMPLE_BIN + PATH_SEPARATOR + processName + ".exe";
+  }
+  return processPathName;
+}
+
+/**
+ * Quotes an argument so CommandLineToArgvW() splits it back as it was.
+ */
+std::string QuoteArgument(const std::string& argument)
+{
+  if(!argument.empty() && argument.find_first_of(" \t\"") == std::string::npos)
+  {
+    return argument;
+  }
+
+  std::string quoted("\"");
+  size_t      backslashes = 0u;
+  for(char c : argument)
+  {
+    if(c == '\\')
+    {
+      ++backslashes;
+      continue;
+    }
+    quoted.append(c == '"' ? backslashes * 2u + 1u : backslashes, '\\');
+    quoted += c;
+    backslashes = 0u;
+  }
+  quoted.append(backslashes * 2u, '\\');
+  return quoted + "\"";
+}
+
+/**
+ * Executes a program with the given arguments and waits for it to exit, or terminates it once the timeout expires.
+ */
+int ExecuteAndWait(const std::string& processPathName, const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout)
+{
+  std::string commandLine = QuoteArgument(processName);
+  for(const std::string& argument : arguments)
+  {
+    commandLine += " " + QuoteArgument(argument);
+  }
+
+  int                 exitCode = -1;
+  STARTUPINFO         info     = {sizeof(info)};
+  PROCESS_INFORMATION processInfo;
+  if(CreateProcess(processPathName.c_str(), &commandLine[0], nullptr, nullptr, TRUE, 0, nullptr, nullptr, &info, &processInfo))
+  {
+    DWORD processExitCode = 0;
+    if(timeout > 0u && WaitForSingleObject(processInfo.hProcess, timeout) == WAIT_TIMEOUT)
+    {
+      TerminateProcess(processInfo.hProcess, 1u);
+      WaitForSingleObject(processInfo.hProcess, INFINITE);
+      exitCode = EXECUTE_PROCESS_TIMED_OUT;
+    }
+    else if(WaitForSingleObject(processInfo.hProcess, INFINITE) == WAIT_OBJECT_0 && GetExitCodeProcess(processInfo.hProcess, &processExitCode))
+    {
+      exitCode = static_cast<int>(processExitCode);
+    }
+    CloseHandle(processInfo.hProcess);
+    CloseHandle(processInfo.hThread);
+  }
+  return exitCode;
+}
+} // namespace
+
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout)
+{
+  return ExecuteAndWait(GetProcessPathName(processName), processName, arguments, timeout);
+}
+
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout, ExecuteProcessStatistics& statistics)
+{
+  // The example isn't measured
+  return ExecuteProcessAndWait(processName, arguments, timeout);
+}
+
+int ExecuteLauncherAndWait(const std::vector<std::string>& arguments)
+{
+  char  launcherPath[MAX_PATH];
+  DWORD numberOfCharacters = GetModuleFileName(nullptr, launcherPath, MAX_PATH);
+  if(0u == numberOfCharacters || MAX_PATH == numberOfCharacters)
+  {
+    return -1;
+  }
+  return ExecuteAndWait(launcherPath, launcherPath, arguments, 0u);
+}
@@ -29,6 +29,24 @@
 #include <android_native_app_glue.h>
 #include <dali-demo-native-activity-jni.h>
 
+bool StartExampleZygote(int argc, char** argv)
+{
+  return false;
+}
+
+void ReportExampleLaunches(bool report)
+{
+}
+
+void* CreateExamplePlugin(const std::string& processName, Dali::Application& application)
+{
+  return NULL;
+}
+
+void DestroyExamplePlugin(void* example)
+{
+}
+
 void ExecuteProcess(const std::string& processName, Dali::Application& application)
 {
   struct android_app* nativeApp = Dali::Integration::AndroidFramework::Get().GetNativeApplication();
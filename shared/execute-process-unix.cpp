@@ -18,19 +18,379 @@
 // FILE HEADER
 #include "execute-process.h"
 
+// INTERNAL INCLUDES
+#include "example-plugin.h"
+#include "example-startup.h"
+
 // EXTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/text-controls/text-label.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/adaptor-framework/window.h>
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/signals/callback.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
 #include <unistd.h>
+#include <chrono>
 #include <sstream>
 
-void ExecuteProcess(const std::string& processName, Dali::Application& application)
+namespace
+{
+const char* const ZYGOTE_OPTION("--zygote");
+const char* const SPARE_EXAMPLE_NAME("dali-demo-example"); ///< The name of a spare example process, until it's given an example
+
+int  gZygoteSocket   = -1;    ///< The launcher's end of the connection to the zygote, -1 without a zygote
+bool gReportLaunches = false; ///< Whether the examples launched report their first frame
+
+/**
+ * An example created from its plugin
+ */
+struct ExamplePlugin
+{
+  void*                          example;
+  DaliDemoDestroyExampleFunction destroy;
+};
+
+/**
+ * Reads a request terminated by a newline: the name of an example, followed by its launch time if it's reported.
+ * The launch time is in nanoseconds of the steady clock, which is the same in every process.
+ * @return false once the other end has disconnected
+ */
+bool ReadRequest(int requestSocket, std::string& request)
+{
+  request.clear();
+  while(true)
+  {
+    char          character;
+    const ssize_t size = read(requestSocket, &character, 1u);
+    if(size < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if(size <= 0)
+    {
+      return false;
+    }
+    if(character == '\n')
+    {
+      return true;
+    }
+    request += character;
+  }
+}
+
+/**
+ * The name of the example in a request
+ */
+std::string GetRequestedExample(const std::string& request)
+{
+  return request.substr(0u, request.find(' '));
+}
+
+/**
+ * Asks the example created or executed next by this process to report its launch, if the request has a launch time.
+ * The example reports its first frame itself, see DemoHelper::StartExample().
+ */
+void SetLaunchReport(const std::string& request)
+{
+  if(request.find(' ') != std::string::npos)
+  {
+    setenv(DemoHelper::ExampleStartup::LAUNCH_REPORT_VARIABLE, request.c_str(), 1);
+  }
+}
+
+/**
+ * Executes an example; never returns.
+ */
+void ExecuteExample(const std::string& processName)
 {
   std::stringstream stream;
   stream << DEMO_EXAMPLE_BIN << processName.c_str();
+
+  char* argv[] = {const_cast<char*>(processName.c_str()), NULL};
+  execv(stream.str().c_str(), argv);
+  _exit(127);
+}
+
+/**
+ * Initialises an Application, with the theme of the examples, then waits for the name of an example to create it
+ * from its plugin, as the launcher does with --plugins. An example without a plugin is executed instead.
+ */
+class SpareExample : public Dali::ConnectionTracker
+{
+public:
+  SpareExample(Dali::Application& application, int requestSocket)
+  : mApplication(application),
+    mRequestSocket(requestSocket),
+    mExample(NULL)
+  {
+    mApplication.InitSignal().Connect(this, &SpareExample::OnInit);
+  }
+
+  ~SpareExample()
+  {
+    if(mExample)
+    {
+      DestroyExamplePlugin(mExample);
+    }
+  }
+
+private:
+  void OnInit(Dali::Application& application)
+  {
+    // The signal is emitted again for the example
+    if(mRequestTimer)
+    {
+      return;
+    }
+
+    // The window is shown once it has the example
+    application.GetWindow().Hide();
+
+    // Creating a control parses the theme, and a text label also loads the fonts
+    Dali::Toolkit::TextLabel::New(SPARE_EXAMPLE_NAME);
+
+    // The request is waited for once the initialisation has finished
+    mRequestTimer = Dali::Timer::New(1u);
+    mRequestTimer.TickSignal().Connect(this, &SpareExample::OnRequestTimer);
+    mRequestTimer.Start();
+  }
+
+  bool OnRequestTimer()
+  {
+    std::string request;
+    const bool  requested = ReadRequest(mRequestSocket, request);
+    close(mRequestSocket);
+    if(!requested)
+    {
+      mApplication.Quit();
+      return false;
+    }
+
+    SetLaunchReport(request);
+    mName    = GetRequestedExample(request);
+    mExample = CreateExamplePlugin(mName, mApplication);
+    if(!mExample)
+    {
+      ExecuteExample(mName);
+    }
+
+    // The example creates its scene when the application is initialised, as it does in its own process.
+    mApplication.InitSignal().Emit(mApplication);
+    mApplication.GetWindow().Show();
+    return false;
+  }
+
+  Dali::Application& mApplication;
+  int                mRequestSocket; ///< The spare's end of the connection to the zygote
+  Dali::Timer        mRequestTimer;
+  std::string        mName;    ///< The name of the example, once it's requested
+  void*              mExample; ///< The example, once it's created
+};
+
+/**
+ * Runs a spare example until its example quits, or the zygote disconnects; never returns.
+ */
+void RunSpareExample(int requestSocket)
+{
+  int    argc   = 1;
+  char*  args[] = {const_cast<char*>(SPARE_EXAMPLE_NAME), NULL};
+  char** argv   = args;
+
+  Dali::Application application = Dali::Application::New(&argc, &argv, DEMO_THEME_PATH);
+  {
+    SpareExample spare(application, requestSocket);
+    application.MainLoop();
+  }
+  _exit(0);
+}
+
+/**
+ * Forks a spare example, which starts initialising straight away.
+ * @return The zygote's end of the connection to the spare, or -1 if it couldn't be forked
+ */
+int StartSpareExample(int zygoteRequestSocket)
+{
+  int sockets[2];
+  if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0)
+  {
+    return -1;
+  }
+
+  pid_t pid = fork();
+  if(pid == 0)
+  {
+    close(zygoteRequestSocket);
+    close(sockets[0]);
+    signal(SIGCHLD, SIG_DFL);
+    RunSpareExample(sockets[1]);
+  }
+
+  close(sockets[1]);
+  if(pid < 0)
+  {
+    close(sockets[0]);
+    return -1;
+  }
+  return sockets[0];
+}
+
+/**
+ * Keeps a spare example ready, and hands it the next example requested, until the launcher disconnects.
+ *
+ * The zygote itself never creates an Application, so it has no threads and can keep forking spares. Each spare
+ * initialises its Application while the launcher is browsing, so a launch only has to create the example.
+ */
+void RunZygote(int requestSocket)
+{
+  // The examples are not waited for
+  signal(SIGCHLD, SIG_IGN);
+
+  int         spareSocket = StartSpareExample(requestSocket);
+  std::string request;
+  while(ReadRequest(requestSocket, request))
+  {
+    request += '\n';
+    if(spareSocket < 0 || send(spareSocket, request.c_str(), request.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(request.size()))
+    {
+      // The spare is gone, so the example is executed
+      if(fork() == 0)
+      {
+        close(requestSocket);
+        signal(SIGCHLD, SIG_DFL);
+        request.pop_back();
+        SetLaunchReport(request);
+        ExecuteExample(GetRequestedExample(request));
+      }
+    }
+
+    if(spareSocket >= 0)
+    {
+      close(spareSocket);
+    }
+    spareSocket = StartSpareExample(requestSocket);
+  }
+  _exit(0);
+}
+
+} // namespace
+
+bool StartExampleZygote(int argc, char** argv)
+{
+  bool requested = false;
+  for(int i = 1; i < argc; ++i)
+  {
+    if(strcmp(argv[i], ZYGOTE_OPTION) == 0)
+    {
+      requested = true;
+    }
+  }
+  if(!requested)
+  {
+    return false;
+  }
+
+  int sockets[2];
+  if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0)
+  {
+    return false;
+  }
+
   pid_t pid = fork();
   if(pid == 0)
   {
-    execlp(stream.str().c_str(), processName.c_str(), NULL);
+    close(sockets[0]);
+    RunZygote(sockets[1]);
+  }
+
+  close(sockets[1]);
+  if(pid < 0)
+  {
+    close(sockets[0]);
+    return false;
+  }
+
+  gZygoteSocket = sockets[0];
+  return true;
+}
+
+void ReportExampleLaunches(bool report)
+{
+  gReportLaunches = report;
+}
+
+void* CreateExamplePlugin(const std::string& processName, Dali::Application& application)
+{
+  std::stringstream stream;
+  stream << DEMO_EXAMPLE_BIN << processName.c_str() << ".so";
+
+  void* library = dlopen(stream.str().c_str(), RTLD_NOW | RTLD_NODELETE);
+  if(!library)
+  {
+    return NULL;
+  }
+
+  DaliDemoCreateExampleFunction  create  = reinterpret_cast<DaliDemoCreateExampleFunction>(dlsym(library, DALI_DEMO_CREATE_EXAMPLE_FUNCTION));
+  DaliDemoDestroyExampleFunction destroy = reinterpret_cast<DaliDemoDestroyExampleFunction>(dlsym(library, DALI_DEMO_DESTROY_EXAMPLE_FUNCTION));
+  dlclose(library);
+  if(!create || !destroy)
+  {
+    return NULL;
+  }
+
+  return new ExamplePlugin{create(application), destroy};
+}
+
+void DestroyExamplePlugin(void* example)
+{
+  ExamplePlugin* plugin = static_cast<ExamplePlugin*>(example);
+  plugin->destroy(plugin->example);
+  delete plugin;
+}
+
+void ExecuteProcess(const std::string& processName, Dali::Application& application)
+{
+  if(gZygoteSocket >= 0)
+  {
+    const std::string request = (gReportLaunches ? DemoHelper::ExampleStartup::GetLaunchReport(processName) : processName) + '\n';
+    if(send(gZygoteSocket, request.c_str(), request.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(request.size()))
+    {
+      return;
+    }
+
+    // The zygote is gone, so the examples are executed directly from now on
+    close(gZygoteSocket);
+    gZygoteSocket = -1;
+  }
+
+  std::stringstream stream;
+  stream << DEMO_EXAMPLE_BIN << processName.c_str();
+  const std::string path = stream.str();
+
+  // The environment is prepared before forking, as the launcher has threads and the child may only call exec
+  const std::string  launchReport = std::string(DemoHelper::ExampleStartup::LAUNCH_REPORT_VARIABLE) + '=' + DemoHelper::ExampleStartup::GetLaunchReport(processName);
+  std::vector<char*> environment;
+  for(char** variable = environ; *variable; ++variable)
+  {
+    environment.push_back(*variable);
+  }
+  if(gReportLaunches)
+  {
+    environment.push_back(const_cast<char*>(launchReport.c_str()));
+  }
+  environment.push_back(NULL);
+
+  char* argv[] = {const_cast<char*>(processName.c_str()), NULL};
+  pid_t pid    = fork();
+  if(pid == 0)
+  {
+    execve(path.c_str(), argv, environment.data());
     DALI_ASSERT_ALWAYS(false && "exec failed!");
   }
 }
@@ -20,42 +20,27 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
-#include <windows.h>
 
-namespace
+bool StartExampleZygote(int argc, char** argv)
 {
-const std::string PATH_SEPARATOR("\\");
+  return false;
 }
 
-void ExecuteProcess(const std::string& processName, Dali::Application& application)
+void ReportExampleLaunches(bool report)
 {
-  std::string processPathName;
-
-  const bool isRelativePath = '.' == DEMO_EXAMPLE_BIN[0];
-  if(isRelativePath)
-  {
-    char  currentPath[MAX_PATH];
-    DWORD numberOfCharacters = GetCurrentDirectory(MAX_PATH, currentPath);
+}
 
-    if(0u == numberOfCharacters)
-    {
-      DALI_ASSERT_ALWAYS(!"Failed to retrieve the current working directory");
-    }
+void* CreateExamplePlugin(const std::string& processName, Dali::Application& application)
+{
+  return NULL;
+}
 
-    currentPath[numberOfCharacters] = '\0';
-    processPathName                 = std::string(currentPath) + PATH_SEPARATOR + DEMO_EXAMPLE_BIN + PATH_SEPARATOR + processName + ".exe";
-  }
-  else
-  {
-    processPathName = DEMO_EXAMPLE_BIN + PATH_SEPARATOR + processName + ".exe";
-  }
+void DestroyExamplePlugin(void* example)
+{
+}
 
-  STARTUPINFO         info = {sizeof(info)};
-  PROCESS_INFORMATION processInfo;
-  if(CreateProcess(processPathName.c_str(), nullptr, nullptr, nullptr, TRUE, 0, nullptr, nullptr, &info, &processInfo))
-  {
-    WaitForSingleObject(processInfo.hProcess, INFINITE);
-    CloseHandle(processInfo.hProcess);
-    CloseHandle(processInfo.hThread);
-  }
+void ExecuteProcess(const std::string& processName, Dali::Application& application)
+{
+  // The launcher waits for the example here, as it always has
+  ExecuteProcessAndWait(processName, std::vector<std::string>());
 }
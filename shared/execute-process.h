@@ -20,8 +20,101 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/adaptor-framework/application.h>
+#include <stdint.h>
 #include <string>
+#include <vector>
 
 void ExecuteProcess(const std::string& processName, Dali::Application& application);
 
+/**
+ * @brief Starts a zygote if --zygote is among the arguments, a process from which ExecuteProcess() then launches the examples.
+ *
+ * The zygote keeps a spare example process ready, forked from it before any thread is started. The spare creates its
+ * Application with the theme of the examples and initialises it, parsing the theme and loading the fonts, then waits.
+ * ExecuteProcess() hands the next example to the spare, which creates it from its plugin (see CreateExamplePlugin()),
+ * and the zygote forks another spare. Examples without a plugin are executed by the spare instead. The zygote exits
+ * with the launcher.
+ *
+ * @note Must be called before the Application is created, as a process is only forked safely before it starts threads.
+ * @param[in] argc The number of arguments of the launcher
+ * @param[in] argv The arguments of the launcher
+ * @return true if the zygote was started; it isn't supported on all platforms
+ */
+bool StartExampleZygote(int argc, char** argv);
+
+/**
+ * @brief Makes the examples launched by ExecuteProcess(), whether executed or from the zygote, print the time from their
+ * launch until their first frame is rendered; see DemoHelper::StartExample().
+ * @param[in] report Whether the launches are reported
+ */
+void ReportExampleLaunches(bool report);
+
+/**
+ * @brief Creates an example in this process from its plugin, built with ENABLE_EXAMPLE_PLUGINS.
+ *
+ * The plugin stays loaded once the example is destroyed, as the example may have registered types.
+ *
+ * @param[in] processName The name of the example executable, e.g. "hello-world.example"
+ * @param[in] application The application of this process
+ * @return The example, to destroy with DestroyExamplePlugin(), or NULL if it has no plugin
+ */
+void* CreateExamplePlugin(const std::string& processName, Dali::Application& application);
+
+/**
+ * @brief Destroys an example created by CreateExamplePlugin().
+ * @param[in] example The example
+ */
+void DestroyExamplePlugin(void* example);
+
+// The functions below are built from execute-process-and-wait-*.cpp, which the examples link too, for the benchmark
+// harness; the rest is only linked into the launchers.
+
+/**
+ * @brief Returned by ExecuteProcessAndWait() when the example was still running once its timeout expired.
+ */
+const int EXECUTE_PROCESS_TIMED_OUT = -2;
+
+/**
+ * @brief Runs an example with the given command line arguments and waits for it to exit.
+ *
+ * With a timeout, an example still running once it expires is terminated, and killed if it doesn't exit then.
+ *
+ * @param[in] processName The name of the example executable, e.g. "benchmark.example"
+ * @param[in] arguments The arguments passed to the example, not including its name
+ * @param[in] timeout Milliseconds to wait for the example to exit, 0 to wait for as long as it runs
+ * @return The exit code of the example, EXECUTE_PROCESS_TIMED_OUT, or -1 if it couldn't be run or didn't exit normally
+ */
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout = 0u);
+
+/**
+ * @brief What is measured of an example run by ExecuteProcessAndWait(), where supported.
+ */
+struct ExecuteProcessStatistics
+{
+  double   firstFrameTime{0.0};     ///< Milliseconds from the launch until the first frame is rendered, 0 if not reported
+  uint32_t peakResidentSetSize{0u}; ///< In kB, 0 if unavailable
+  uint32_t peakThreadCount{0u};     ///< 0 if unavailable
+};
+
+/**
+ * @brief Runs an example as ExecuteProcessAndWait() does, measuring it meanwhile.
+ *
+ * The example reports when its first frame is rendered to this process (see DemoHelper::StartExample()), while its
+ * memory and threads are sampled for as long as it runs.
+ *
+ * @param[in] processName The name of the example executable, e.g. "benchmark.example"
+ * @param[in] arguments The arguments passed to the example, not including its name
+ * @param[in] timeout Milliseconds to wait for the example to exit, 0 to wait for as long as it runs
+ * @param[out] statistics What was measured of the example
+ * @return The exit code of the example, EXECUTE_PROCESS_TIMED_OUT, or -1 if it couldn't be run or didn't exit normally
+ */
+int ExecuteProcessAndWait(const std::string& processName, const std::vector<std::string>& arguments, unsigned int timeout, ExecuteProcessStatistics& statistics);
+
+/**
+ * @brief Runs this launcher again with the given command line arguments and waits for it to exit.
+ * @param[in] arguments The arguments passed to the launcher, not including its name
+ * @return The exit code of the launcher, or -1 if it couldn't be run or didn't exit normally
+ */
+int ExecuteLauncherAndWait(const std::vector<std::string>& arguments);
+
 #endif // DALI_DEMO_EXECUTE_PROCESS_H
@@ -0,0 +1,327 @@
+#ifndef DALI_DEMO_FRAME_TIMING_RECORDER_H
+#define DALI_DEMO_FRAME_TIMING_RECORDER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/devel-api/update/update-proxy.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/trace.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief Records the time at which every frame is updated, split in named phases, and reports frame time statistics.
+ *
+ * Add it as a frame callback (DevelStage::AddFrameCallback) and call StartPhase() from the event thread whenever the
+ * measured scenario moves on, e.g. when an animation finishes and the next one is played. Remove the frame callback
+ * before reading the results.
+ *
+ * The update thread only writes to storage allocated up front, so recording doesn't disturb the frames it measures.
+ * Frames beyond the capacity are not recorded.
+ */
+class FrameTimingRecorder : public Dali::FrameCallbackInterface
+{
+public:
+  static constexpr float DEFAULT_FRAME_INTERVAL = 1000.0f / 60.0f; ///< In milliseconds
+
+  /**
+   * @brief Statistics of the frame times of a phase, in milliseconds.
+   */
+  struct PhaseStatistics
+  {
+    std::string name;
+    uint32_t    frameCount{0u};
+    uint32_t    droppedFrameCount{0u}; ///< Vsync intervals missed, e.g. a frame that took 2.6 intervals dropped 2 frames
+    double      duration{0.0};
+    double      minimum{0.0};
+    double      average{0.0};
+    double      p50{0.0};
+    double      p95{0.0};
+    double      p99{0.0};
+    double      maximum{0.0};
+  };
+
+  /**
+   * @brief Constructor.
+   * @param[in] capacity The maximum number of frames recorded
+   */
+  explicit FrameTimingRecorder(uint32_t capacity = 100000u)
+  : mFrames(capacity),
+    mFrameCount(0u),
+    mPhase(-1)
+  {
+    mPhaseNames.reserve(16u);
+  }
+
+  /**
+   * @brief Attributes the frames updated from now on to a new phase; frames are not recorded before the first one.
+   * @param[in] name The name of the phase
+   */
+  void StartPhase(const std::string& name)
+  {
+    mPhaseNames.push_back(name);
+    mPhase.store(static_cast<int32_t>(mPhaseNames.size() - 1u), std::memory_order_release);
+  }
+
+  /**
+   * @brief Sets the vsync interval against which dropped frames are counted.
+   * @param[in] interval The interval in milliseconds
+   */
+  void SetFrameInterval(float interval)
+  {
+    mFrameInterval = interval;
+  }
+
+  /**
+   * @brief Adds a parameter of the measured run, written along with the results.
+   */
+  void SetParameter(const std::string& name, double value)
+  {
+    char text[32];
+    snprintf(text, sizeof(text), "%.15g", value);
+    mParameters.emplace_back(name, text);
+  }
+
+  void SetParameter(const std::string& name, bool value)
+  {
+    mParameters.emplace_back(name, value ? "true" : "false");
+  }
+
+  void SetParameter(const std::string& name, const std::string& value)
+  {
+    mParameters.emplace_back(name, Quote(value));
+  }
+
+  /**
+   * @brief Retrieves the time at which the first frame was recorded.
+   * @param[out] time The time of the first frame
+   * @return false if no frame has been recorded yet
+   */
+  bool GetFirstFrameTime(std::chrono::steady_clock::time_point& time) const
+  {
+    if(mFrameCount.load(std::memory_order_acquire) == 0u)
+    {
+      return false;
+    }
+    time = mFrames[0].time;
+    return true;
+  }
+
+  /**
+   * @brief Adds durations measured by the example itself, e.g. the time its own frame callback takes to update,
+   * reported after the phases as one of their own.
+   *
+   * The samples are not frame intervals, so no dropped frames are counted for them.
+   * @param[in] name The name the samples are reported under
+   * @param[in] samples The durations in milliseconds
+   */
+  void AddSamples(const std::string& name, std::vector<double> samples)
+  {
+    mSamples.emplace_back(name, std::move(samples));
+  }
+
+  /**
+   * @brief Computes the statistics of every phase, then of every set of samples added.
+   *
+   * The time of a frame is the time elapsed since the previous update, so the first frame recorded is only
+   * used as a reference.
+   */
+  std::vector<PhaseStatistics> GetStatistics() const
+  {
+    const uint32_t frameCount = mFrameCount.load(std::memory_order_acquire);
+
+    std::vector<std::vector<double>> frameTimes(mPhaseNames.size());
+    for(uint32_t i = 1u; i < frameCount; ++i)
+    {
+      const Frame& frame = mFrames[i];
+      frameTimes[frame.phase].push_back(std::chrono::duration<double, std::milli>(frame.time - mFrames[i - 1u].time).count());
+    }
+
+    std::vector<PhaseStatistics> statistics;
+    for(size_t phase = 0u; phase < mPhaseNames.size(); ++phase)
+    {
+      statistics.push_back(GetStatistics(mPhaseNames[phase], frameTimes[phase], true));
+    }
+    for(const auto& samples : mSamples)
+    {
+      std::vector<double> times(samples.second);
+      statistics.push_back(GetStatistics(samples.first, times, false));
+    }
+    return statistics;
+  }
+
+  /**
+   * @brief Writes the parameters and the statistics of every phase as JSON.
+   * @param[in] path The path of the file to write
+   * @param[in] name The name of the benchmark
+   * @return true if the file was written
+   */
+  bool WriteJson(const std::string& path, const std::string& name) const
+  {
+    FILE* file = fopen(path.c_str(), "w");
+    if(!file)
+    {
+      return false;
+    }
+
+    fprintf(file, "{\n  \"benchmark\": %s,\n  \"frameIntervalMs\": %.3f,\n  \"parameters\": {", Quote(name).c_str(), mFrameInterval);
+    for(size_t i = 0u; i < mParameters.size(); ++i)
+    {
+      fprintf(file, "%s\n    %s: %s", i ? "," : "", Quote(mParameters[i].first).c_str(), mParameters[i].second.c_str());
+    }
+    fprintf(file, "\n  },\n  \"phases\": [");
+
+    const std::vector<PhaseStatistics> statistics = GetStatistics();
+    for(size_t i = 0u; i < statistics.size(); ++i)
+    {
+      fprintf(file, "%s\n    ", i ? "," : "");
+      WriteJson(file, statistics[i]);
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    return fclose(file) == 0;
+  }
+
+  /**
+   * @brief Writes the statistics of a phase as a JSON object.
+   * @param[in] file The file to write to
+   * @param[in] phase The statistics of the phase
+   */
+  static void WriteJson(FILE* file, const PhaseStatistics& phase)
+  {
+    fprintf(file,
+            "{\"name\": %s, \"frames\": %u, \"droppedFrames\": %u, \"durationMs\": %.3f, "
+            "\"minMs\": %.3f, \"avgMs\": %.3f, \"p50Ms\": %.3f, \"p95Ms\": %.3f, \"p99Ms\": %.3f, \"maxMs\": %.3f}",
+            Quote(phase.name).c_str(),
+            phase.frameCount,
+            phase.droppedFrameCount,
+            phase.duration,
+            phase.minimum,
+            phase.average,
+            phase.p50,
+            phase.p95,
+            phase.p99,
+            phase.maximum);
+  }
+
+  /**
+   * @brief Quotes text as a JSON string; control characters are replaced by spaces.
+   */
+  static std::string Quote(const std::string& text)
+  {
+    std::string quoted("\"");
+    for(char c : text)
+    {
+      if(c == '"' || c == '\\')
+      {
+        quoted += '\\';
+      }
+      quoted += (static_cast<unsigned char>(c) < 0x20u) ? ' ' : c;
+    }
+    return quoted + "\"";
+  }
+
+private:
+  struct Frame
+  {
+    std::chrono::steady_clock::time_point time;
+    uint32_t                              phase;
+  };
+
+  /**
+   * @brief Called on the update thread for every frame.
+   */
+  void Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds) override
+  {
+    Tracer::Get().SetThreadName("Update thread");
+    DEMO_TRACE_SCOPE("FrameCallback::Update");
+
+    const int32_t  phase      = mPhase.load(std::memory_order_acquire);
+    const uint32_t frameCount = mFrameCount.load(std::memory_order_relaxed);
+    if(phase >= 0 && frameCount < mFrames.size())
+    {
+      mFrames[frameCount].time  = std::chrono::steady_clock::now();
+      mFrames[frameCount].phase = static_cast<uint32_t>(phase);
+      mFrameCount.store(frameCount + 1u, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Computes the statistics of the times of a phase, sorting them.
+   */
+  PhaseStatistics GetStatistics(const std::string& name, std::vector<double>& times, bool countDroppedFrames) const
+  {
+    PhaseStatistics statistics;
+    statistics.name       = name;
+    statistics.frameCount = static_cast<uint32_t>(times.size());
+    if(times.empty())
+    {
+      return statistics;
+    }
+
+    for(double time : times)
+    {
+      statistics.duration += time;
+      const long intervals = countDroppedFrames ? std::lround(time / mFrameInterval) : 0;
+      statistics.droppedFrameCount += intervals > 1 ? static_cast<uint32_t>(intervals - 1) : 0u;
+    }
+
+    std::sort(times.begin(), times.end());
+    statistics.minimum = times.front();
+    statistics.maximum = times.back();
+    statistics.average = statistics.duration / times.size();
+    statistics.p50     = GetPercentile(times, 50.0);
+    statistics.p95     = GetPercentile(times, 95.0);
+    statistics.p99     = GetPercentile(times, 99.0);
+    return statistics;
+  }
+
+  /**
+   * @brief Nearest-rank percentile of sorted values.
+   */
+  static double GetPercentile(const std::vector<double>& sortedValues, double percentile)
+  {
+    const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedValues.size()));
+    return sortedValues[std::min(std::max(rank, size_t(1u)), sortedValues.size()) - 1u];
+  }
+
+private:
+  std::vector<Frame>                                       mFrames;
+  std::atomic<uint32_t>                                    mFrameCount;
+  std::atomic<int32_t>                                     mPhase;
+  std::vector<std::string>                                 mPhaseNames; ///< Only accessed on the event thread
+  std::vector<std::pair<std::string, std::string>>         mParameters; ///< Names and JSON values
+  std::vector<std::pair<std::string, std::vector<double>>> mSamples;    ///< Names and durations added by the example
+  float                                                    mFrameInterval{DEFAULT_FRAME_INTERVAL};
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_FRAME_TIMING_RECORDER_H
@@ -0,0 +1,588 @@
+#ifndef DALI_DEMO_JSON_READER_H
+#define DALI_DEMO_JSON_READER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+// INTERNAL INCLUDES
+#include "shared/decimal-number.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief On-demand reader of JSON text.
+ *
+ * Rather than building a document, the reader walks the text in place and the caller pulls the values it
+ * expects, skipping the ones it does not need. Strings are returned as views into the text, and numbers are
+ * converted straight to the type asked for. Nothing is allocated unless a string is explicitly unescaped.
+ *
+ * @code
+ * JsonReader reader(text, text + length);
+ * if(reader.EnterObject())
+ * {
+ *   for(std::string_view key; reader.NextMember(key);)
+ *   {
+ *     if(key == "count")
+ *     {
+ *       reader.ReadNumber(count);
+ *     }
+ *     else
+ *     {
+ *       reader.Skip();
+ *     }
+ *   }
+ * }
+ * if(reader.HasError()) ...
+ * @endcode
+ *
+ * Every value returned by NextMember() or NextElement() must be consumed, by reading or skipping it.
+ * After an error every call fails, so the loops above always terminate.
+ */
+class JsonReader
+{
+public:
+  enum class Type
+  {
+    INVALID,
+    OBJECT,
+    ARRAY,
+    STRING,
+    NUMBER,
+    BOOLEAN,
+    NULL_VALUE
+  };
+
+  /**
+   * @brief Creates a reader for the text in [begin, end), which does not need to be null terminated.
+   */
+  JsonReader(const char* begin, const char* end)
+  : mBegin(begin),
+    mCursor(begin),
+    mEnd(end)
+  {
+  }
+
+  /**
+   * @brief Retrieves the type of the next value without consuming it.
+   */
+  Type GetType()
+  {
+    if(!SkipWhitespace())
+    {
+      return Type::INVALID;
+    }
+
+    switch(*mCursor)
+    {
+      case '{':
+        return Type::OBJECT;
+      case '[':
+        return Type::ARRAY;
+      case '"':
+        return Type::STRING;
+      case 't':
+      case 'f':
+        return Type::BOOLEAN;
+      case 'n':
+        return Type::NULL_VALUE;
+      default:
+        return (*mCursor == '-' || IsDigit(*mCursor)) ? Type::NUMBER : Type::INVALID;
+    }
+  }
+
+  /**
+   * @brief Consumes the start of an object; its members are then retrieved with NextMember().
+   */
+  bool EnterObject()
+  {
+    mFirstValue = true;
+    return Expect('{');
+  }
+
+  /**
+   * @brief Moves to the next member of the current object.
+   *
+   * @param[out] key The key of the member, as a view into the text.
+   * @return false, having consumed the end of the object, if there are no more members.
+   */
+  bool NextMember(std::string_view& key)
+  {
+    if(!SkipSeparator('}'))
+    {
+      return false;
+    }
+    return ReadString(key) && Expect(':');
+  }
+
+  /**
+   * @brief Consumes the start of an array; its elements are then retrieved with NextElement().
+   */
+  bool EnterArray()
+  {
+    mFirstValue = true;
+    return Expect('[');
+  }
+
+  /**
+   * @brief Moves to the next element of the current array.
+   *
+   * @return false, having consumed the end of the array, if there are no more elements.
+   */
+  bool NextElement()
+  {
+    return SkipSeparator(']');
+  }
+
+  /**
+   * @brief Reads a string as a view into the text; escape sequences are left as they are.
+   */
+  bool ReadString(std::string_view& value)
+  {
+    if(!Expect('"'))
+    {
+      return false;
+    }
+
+    const char* start = mCursor;
+    while(mCursor < mEnd && *mCursor != '"')
+    {
+      // skip the escaped character, which may be a quote
+      mCursor += (*mCursor == '\\') ? 2 : 1;
+    }
+
+    if(mCursor >= mEnd)
+    {
+      return SetError();
+    }
+
+    value = std::string_view(start, mCursor - start);
+    ++mCursor;
+    return true;
+  }
+
+  /**
+   * @brief Reads a string, decoding its escape sequences.
+   */
+  bool ReadString(std::string& value)
+  {
+    std::string_view view;
+    if(!ReadString(view))
+    {
+      return false;
+    }
+    return Unescape(view, value) || SetError();
+  }
+
+  bool ReadNumber(double& value)
+  {
+    DecimalNumber number;
+    if(!ParseNumber(number))
+    {
+      return false;
+    }
+
+    value = ToDouble(number);
+    return true;
+  }
+
+  /**
+   * @see DemoHelper::ToFloat() for when the value is built in float arithmetic
+   */
+  bool ReadNumber(float& value)
+  {
+    DecimalNumber number;
+    if(!ParseNumber(number))
+    {
+      return false;
+    }
+
+    value = ToFloat(number);
+    return true;
+  }
+
+  bool ReadNumber(uint32_t& value)
+  {
+    DecimalNumber number;
+    if(!ParseNumber(number))
+    {
+      return false;
+    }
+
+    if(number.exponent == 0)
+    {
+      value = number.negative ? 0u : static_cast<uint32_t>(number.mantissa);
+    }
+    else
+    {
+      // written as e.g. "1.0" or "1e2"
+      const double scaled = ToDouble(number);
+      value               = scaled > 0.0 ? static_cast<uint32_t>(scaled) : 0u;
+    }
+    return true;
+  }
+
+  bool ReadBool(bool& value)
+  {
+    if(ExpectLiteral("true"))
+    {
+      value = true;
+      return true;
+    }
+    if(!mError && ExpectLiteral("false"))
+    {
+      value = false;
+      return true;
+    }
+    return SetError();
+  }
+
+  bool ReadNull()
+  {
+    return ExpectLiteral("null") || SetError();
+  }
+
+  /**
+   * @brief Consumes the next value, whatever its type.
+   */
+  bool Skip()
+  {
+    switch(GetType())
+    {
+      case Type::OBJECT:
+      {
+        EnterObject();
+        for(std::string_view key; NextMember(key);)
+        {
+          Skip();
+        }
+        break;
+      }
+      case Type::ARRAY:
+      {
+        EnterArray();
+        while(NextElement())
+        {
+          Skip();
+        }
+        break;
+      }
+      case Type::STRING:
+      {
+        std::string_view value;
+        ReadString(value);
+        break;
+      }
+      case Type::NUMBER:
+      {
+        DecimalNumber number;
+        ParseNumber(number);
+        break;
+      }
+      case Type::BOOLEAN:
+      {
+        bool value;
+        ReadBool(value);
+        break;
+      }
+      case Type::NULL_VALUE:
+      {
+        ReadNull();
+        break;
+      }
+      case Type::INVALID:
+      {
+        SetError();
+        break;
+      }
+    }
+    return !mError;
+  }
+
+  bool HasError() const
+  {
+    return mError;
+  }
+
+  /**
+   * @brief Retrieves the offset in the text where the first error was found.
+   */
+  size_t GetErrorOffset() const
+  {
+    return mErrorOffset;
+  }
+
+  /**
+   * @brief Decodes the escape sequences of a string read as a view.
+   *
+   * @param[in] text The contents of the string, without quotes.
+   * @param[out] value The decoded string, UTF-8 encoded.
+   * @return false if there's an invalid escape sequence.
+   */
+  static bool Unescape(std::string_view text, std::string& value)
+  {
+    value.clear();
+    value.reserve(text.size());
+
+    for(size_t i = 0u; i < text.size(); ++i)
+    {
+      if(text[i] != '\\')
+      {
+        value += text[i];
+        continue;
+      }
+
+      if(++i == text.size())
+      {
+        return false;
+      }
+
+      switch(text[i])
+      {
+        case '"':
+        case '\\':
+        case '/':
+          value += text[i];
+          break;
+        case 'b':
+          value += '\b';
+          break;
+        case 'f':
+          value += '\f';
+          break;
+        case 'n':
+          value += '\n';
+          break;
+        case 'r':
+          value += '\r';
+          break;
+        case 't':
+          value += '\t';
+          break;
+        case 'u':
+        {
+          uint32_t codePoint = 0u;
+          if(!ParseHex(text, i + 1u, codePoint))
+          {
+            return false;
+          }
+          i += 4u;
+
+          // surrogate pair
+          uint32_t lowSurrogate;
+          if(codePoint >= 0xd800u && codePoint < 0xdc00u &&
+             i + 6u < text.size() && text[i + 1u] == '\\' && text[i + 2u] == 'u' &&
+             ParseHex(text, i + 3u, lowSurrogate) && lowSurrogate >= 0xdc00u && lowSurrogate < 0xe000u)
+          {
+            codePoint = 0x10000u + ((codePoint - 0xd800u) << 10) + (lowSurrogate - 0xdc00u);
+            i += 6u;
+          }
+
+          AppendUtf8(codePoint, value);
+          break;
+        }
+        default:
+          return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  static bool IsDigit(char c)
+  {
+    return c >= '0' && c <= '9';
+  }
+
+  static bool IsWhitespace(char c)
+  {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  static bool ParseHex(std::string_view text, size_t start, uint32_t& value)
+  {
+    if(start + 4u > text.size())
+    {
+      return false;
+    }
+
+    value = 0u;
+    for(size_t i = start; i < start + 4u; ++i)
+    {
+      const char c = text[i];
+      value <<= 4;
+      if(IsDigit(c))
+      {
+        value |= c - '0';
+      }
+      else if(c >= 'a' && c <= 'f')
+      {
+        value |= c - 'a' + 10;
+      }
+      else if(c >= 'A' && c <= 'F')
+      {
+        value |= c - 'A' + 10;
+      }
+      else
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static void AppendUtf8(uint32_t codePoint, std::string& value)
+  {
+    if(codePoint < 0x80u)
+    {
+      value += static_cast<char>(codePoint);
+    }
+    else if(codePoint < 0x800u)
+    {
+      value += static_cast<char>(0xc0u | (codePoint >> 6));
+      value += static_cast<char>(0x80u | (codePoint & 0x3fu));
+    }
+    else if(codePoint < 0x10000u)
+    {
+      value += static_cast<char>(0xe0u | (codePoint >> 12));
+      value += static_cast<char>(0x80u | ((codePoint >> 6) & 0x3fu));
+      value += static_cast<char>(0x80u | (codePoint & 0x3fu));
+    }
+    else
+    {
+      value += static_cast<char>(0xf0u | (codePoint >> 18));
+      value += static_cast<char>(0x80u | ((codePoint >> 12) & 0x3fu));
+      value += static_cast<char>(0x80u | ((codePoint >> 6) & 0x3fu));
+      value += static_cast<char>(0x80u | (codePoint & 0x3fu));
+    }
+  }
+
+  bool SetError()
+  {
+    if(!mError)
+    {
+      mError       = true;
+      mErrorOffset = mCursor - mBegin;
+      mCursor      = mEnd;
+    }
+    return false;
+  }
+
+  /**
+   * @return false if the end of the text was reached.
+   */
+  bool SkipWhitespace()
+  {
+    while(mCursor < mEnd && IsWhitespace(*mCursor))
+    {
+      ++mCursor;
+    }
+    return mCursor < mEnd;
+  }
+
+  bool Expect(char c)
+  {
+    if(SkipWhitespace() && *mCursor == c)
+    {
+      ++mCursor;
+      return true;
+    }
+    return SetError();
+  }
+
+  bool ExpectLiteral(const char* literal)
+  {
+    if(!SkipWhitespace())
+    {
+      return SetError();
+    }
+
+    const char* cursor = mCursor;
+    for(; *literal != '\0'; ++literal, ++cursor)
+    {
+      if(cursor == mEnd || *cursor != *literal)
+      {
+        return false;
+      }
+    }
+    mCursor = cursor;
+    return true;
+  }
+
+  /**
+   * @brief Consumes the comma between values, or the closing character at the end of the container.
+   *
+   * The first value of a container has no comma before it; any other value must have one.
+   *
+   * @return true if there is another value to read.
+   */
+  bool SkipSeparator(char close)
+  {
+    const bool firstValue = mFirstValue;
+    mFirstValue           = false;
+    if(!SkipWhitespace())
+    {
+      return SetError();
+    }
+
+    if(*mCursor == close)
+    {
+      ++mCursor;
+      return false;
+    }
+
+    if(!firstValue)
+    {
+      if(*mCursor != ',')
+      {
+        return SetError();
+      }
+      ++mCursor;
+    }
+    return SkipWhitespace() || SetError();
+  }
+
+  /**
+   * @brief Parses a number into its significant digits and a power of ten.
+   */
+  bool ParseNumber(DecimalNumber& number)
+  {
+    if(!SkipWhitespace() || *mCursor == '+')
+    {
+      return SetError();
+    }
+
+    mCursor = ParseDecimal(mCursor, mEnd, number);
+    return number.hasIntegerDigits || SetError();
+  }
+
+  const char* mBegin;
+  const char* mCursor;
+  const char* mEnd;
+  size_t      mErrorOffset{0u};
+  bool        mError{false};
+  bool        mFirstValue{false}; ///< Whether the next value is the first of the container just entered
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_JSON_READER_H
@@ -0,0 +1,194 @@
+#ifndef DALI_DEMO_MAPPED_FILE_H
+#define DALI_DEMO_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/file-stream.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace DemoHelper
+{
+/**
+ * @brief Read-only view of the whole contents of a file.
+ *
+ * The file is memory mapped where the platform allows it, so its pages are only read when they are first touched
+ * and are never copied. Otherwise (e.g. Android assets or MS Windows) the file is read into memory through
+ * Dali::FileStream, and the view refers to that copy instead.
+ */
+class MappedFile
+{
+public:
+  MappedFile() = default;
+
+  /**
+   * @brief Creates a view of the file at @p path; check IsEmpty() to know whether it succeeded.
+   */
+  explicit MappedFile(const std::string& path)
+  {
+    Open(path);
+  }
+
+  ~MappedFile()
+  {
+    Close();
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept
+  {
+    *this = std::move(other);
+  }
+
+  MappedFile& operator=(MappedFile&& other) noexcept
+  {
+    if(this != &other)
+    {
+      Close();
+      mData   = other.mData;
+      mSize   = other.mSize;
+      mMapped = other.mMapped;
+      mBuffer = std::move(other.mBuffer);
+
+      other.mData   = nullptr;
+      other.mSize   = 0u;
+      other.mMapped = false;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Replaces the current view with a view of the file at @p path.
+   *
+   * @param[in] path The path of the file.
+   * @return true if the file was opened and is not empty.
+   */
+  bool Open(const std::string& path)
+  {
+    Close();
+
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd >= 0)
+    {
+      struct stat status;
+      if(fstat(fd, &status) == 0 && status.st_size > 0)
+      {
+        void* mapping = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapping != MAP_FAILED)
+        {
+          mData   = static_cast<const uint8_t*>(mapping);
+          mSize   = static_cast<size_t>(status.st_size);
+          mMapped = true;
+        }
+      }
+      close(fd);
+
+      if(mMapped)
+      {
+        return true;
+      }
+    }
+#endif
+
+    Dali::FileStream fileStream(path, Dali::FileStream::READ | Dali::FileStream::BINARY);
+    FILE*            file = fileStream.GetFile();
+    if(file && fseek(file, 0, SEEK_END) == 0)
+    {
+      const long size = ftell(file);
+      if(size > 0 && fseek(file, 0, SEEK_SET) == 0)
+      {
+        mBuffer.resize(static_cast<size_t>(size));
+        if(fread(mBuffer.data(), 1u, mBuffer.size(), file) == mBuffer.size())
+        {
+          mData = mBuffer.data();
+          mSize = mBuffer.size();
+        }
+        else
+        {
+          mBuffer.clear();
+        }
+      }
+    }
+
+    return !IsEmpty();
+  }
+
+  /**
+   * @brief Releases the view; any pointer previously returned by GetData() becomes invalid.
+   */
+  void Close()
+  {
+#ifndef _WIN32
+    if(mMapped)
+    {
+      munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+#endif
+    mBuffer.clear();
+    mData   = nullptr;
+    mSize   = 0u;
+    mMapped = false;
+  }
+
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+  bool IsEmpty() const
+  {
+    return mSize == 0u;
+  }
+
+  /**
+   * @brief Whether the view refers to a memory mapping rather than to a copy of the file.
+   */
+  bool IsMapped() const
+  {
+    return mMapped;
+  }
+
+private:
+  const uint8_t*       mData{nullptr};
+  size_t               mSize{0u};
+  bool                 mMapped{false};
+  std::vector<uint8_t> mBuffer;
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_MAPPED_FILE_H
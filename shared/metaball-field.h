@@ -0,0 +1,120 @@
+#ifndef DALI_DEMO_METABALL_FIELD_H
+#define DALI_DEMO_METABALL_FIELD_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/animation/constraint.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/object/handle.h>
+#include <stdint.h>
+#include <sstream>
+#include <string>
+
+namespace DemoHelper
+{
+/**
+ * @brief Evaluates the field of all the metaballs in a single pass of one actor, instead of drawing an actor per ball
+ * and adding up their fields by blending.
+ *
+ * Every ball keeps the properties its animations drive on a Handle of its own, as it would on its actor: its position,
+ * the variation of its position, its gravity vector, its radius and the variation of its radius. A constraint adds
+ * them up into the element of the METABALLS_UNIFORM_NAME array of the field actor for the ball: its position in xy and
+ * its radius in z. The fragment shader of the field actor loops over that array, its size defined as METABALL_COUNT
+ * by the prefix returned by GetShaderPrefix():
+ *
+ * @code
+ * uniform vec4 uMetaballs[METABALL_COUNT];
+ * @endcode
+ *
+ * Each ball takes a uniform vector of the fragment shader, so their number is bounded by what the GPU allows; the
+ * GPU isn't queried from the event thread, so it's bounded by MAXIMUM_BALL_COUNT instead.
+ */
+namespace MetaballField
+{
+const char* const METABALLS_UNIFORM_NAME("uMetaballs");
+
+/**
+ * @brief The most balls in a field: OpenGL ES 3.0 guarantees 224 uniform vectors to a fragment shader, less a few
+ * kept for the other uniforms of the shader.
+ */
+constexpr uint32_t MAXIMUM_BALL_COUNT = 220u;
+
+/**
+ * @brief The indices of the properties of a ball, on its handle.
+ */
+struct BallProperties
+{
+  Dali::Property::Index position;
+  Dali::Property::Index positionVar;
+  Dali::Property::Index gravity;
+  Dali::Property::Index radius;
+  Dali::Property::Index radiusVar;
+};
+
+/**
+ * @brief Defines METABALL_COUNT, to prepend to the fragment shader of the field actor.
+ * @param[in] ballCount The number of balls, up to MAXIMUM_BALL_COUNT
+ */
+inline std::string GetShaderPrefix(uint32_t ballCount)
+{
+  std::ostringstream oss;
+  oss << "#define METABALL_COUNT " << ballCount << "\n";
+  return oss.str();
+}
+
+/**
+ * @brief Packs the properties of a ball, read in the order of BallProperties, into its element of the array.
+ */
+inline void PackBall(Dali::Vector4& current, const Dali::PropertyInputContainer& inputs)
+{
+  const Dali::Vector2 position = inputs[0]->GetVector2() + inputs[1]->GetVector2() + inputs[2]->GetVector2();
+  current.x                    = position.x;
+  current.y                    = position.y;
+  current.z                    = inputs[3]->GetFloat() + inputs[4]->GetFloat();
+}
+
+/**
+ * @brief Registers the element of the array for a ball on the field actor and constrains it to the properties of the ball.
+ * @param[in] field The actor evaluating the field
+ * @param[in] ball The index of the ball in the array
+ * @param[in] handle The handle holding the properties of the ball
+ * @param[in] properties The indices of the properties on @p handle
+ */
+inline void AddBall(Dali::Actor field, uint32_t ball, Dali::Handle handle, const BallProperties& properties)
+{
+  std::ostringstream oss;
+  oss << METABALLS_UNIFORM_NAME << "[" << ball << "]";
+  const Dali::Property::Index index = field.RegisterProperty(oss.str(), Dali::Vector4::ZERO);
+
+  Dali::Constraint constraint = Dali::Constraint::New<Dali::Vector4>(field, index, &PackBall);
+  constraint.AddSource(Dali::Source(handle, properties.position));
+  constraint.AddSource(Dali::Source(handle, properties.positionVar));
+  constraint.AddSource(Dali::Source(handle, properties.gravity));
+  constraint.AddSource(Dali::Source(handle, properties.radius));
+  constraint.AddSource(Dali::Source(handle, properties.radiusVar));
+  constraint.Apply();
+}
+
+} // namespace MetaballField
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_METABALL_FIELD_H
@@ -0,0 +1,201 @@
+#ifndef DALI_DEMO_TEXTURE_ATLAS_H
+#define DALI_DEMO_TEXTURE_ATLAS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/rendering/texture-set.h>
+#include <dali/public-api/rendering/texture.h>
+#include <algorithm>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief Packs images into as few textures as possible, so that the renderers drawing them can share one texture set.
+ *
+ * Images are shrunk to fit the given size and packed in rows, tallest first, into atlases of the same pixel format,
+ * with a pixel of padding between them. A renderer reads its image through the rectangle given by GetTextureRect(),
+ * registered as the TEXTURE_RECT_UNIFORM_NAME uniform and applied in its vertex shader:
+ * @code
+ * vTexCoord = uTextureRect.xy + aTexCoord * uTextureRect.zw;
+ * @endcode
+ */
+class TextureAtlas
+{
+public:
+  static constexpr const char* TEXTURE_RECT_UNIFORM_NAME = "uTextureRect";
+
+  /**
+   * @brief Loads and packs the images.
+   * @param[in] imagePaths The paths of the images
+   * @param[in] imageCount The number of images
+   * @param[in] imageSize The size every image is shrunk to fit, keeping its aspect ratio
+   * @param[in] atlasSize The maximum width and height of an atlas, at least the image size
+   * @return false if an image couldn't be loaded; it is then left empty in the atlas
+   */
+  bool Load(const char* const* imagePaths, unsigned int imageCount, Dali::ImageDimensions imageSize, unsigned int atlasSize = 2048u)
+  {
+    std::vector<Dali::Devel::PixelBuffer> pixelBuffers(imageCount);
+    bool                                  loaded = true;
+    for(unsigned int i = 0u; i < imageCount; ++i)
+    {
+      pixelBuffers[i] = Dali::LoadImageFromFile(imagePaths[i], imageSize, Dali::FittingMode::SHRINK_TO_FIT, Dali::SamplingMode::BOX_THEN_LINEAR);
+      loaded          = loaded && pixelBuffers[i];
+    }
+
+    // Rows are less wasteful when their images are of similar heights
+    std::vector<unsigned int> order;
+    for(unsigned int i = 0u; i < imageCount; ++i)
+    {
+      if(pixelBuffers[i])
+      {
+        order.push_back(i);
+      }
+    }
+    std::stable_sort(order.begin(), order.end(), [&pixelBuffers](unsigned int lhs, unsigned int rhs) {
+      return pixelBuffers[lhs].GetHeight() > pixelBuffers[rhs].GetHeight();
+    });
+
+    struct Placement
+    {
+      unsigned int page;
+      unsigned int x;
+      unsigned int y;
+    };
+    std::vector<Placement> placements(imageCount, Placement{0u, 0u, 0u});
+    std::vector<Page>      pages;
+    for(unsigned int i : order)
+    {
+      const Dali::Pixel::Format format = pixelBuffers[i].GetPixelFormat();
+      const unsigned int        width  = pixelBuffers[i].GetWidth();
+      const unsigned int        height = pixelBuffers[i].GetHeight();
+
+      // Images only go into the last page of their format, as the earlier ones had no room left for a taller image
+      auto page = std::find_if(pages.rbegin(), pages.rend(), [format](const Page& page) { return page.format == format; });
+      if(page != pages.rend() && page->rowX + width > atlasSize)
+      {
+        page->rowY += page->rowHeight + PADDING;
+        page->rowX      = 0u;
+        page->rowHeight = 0u;
+      }
+      if(page == pages.rend() || page->rowY + height > atlasSize)
+      {
+        pages.push_back(Page{format, 0u, 0u, 0u, 0u, 0u});
+        page = pages.rbegin();
+      }
+
+      placements[i] = Placement{static_cast<unsigned int>(pages.rend() - page - 1), page->rowX, page->rowY};
+      page->rowX += width + PADDING;
+      page->rowHeight = std::max(page->rowHeight, height);
+      page->width     = std::max(page->width, page->rowX - PADDING);
+      page->height    = std::max(page->height, page->rowY + height);
+    }
+
+    mTextureSets.clear();
+    for(const Page& page : pages)
+    {
+      Dali::TextureSet textureSet = Dali::TextureSet::New();
+      textureSet.SetTexture(0u, Dali::Texture::New(Dali::TextureType::TEXTURE_2D, page.format, page.width, page.height));
+      mTextureSets.push_back(textureSet);
+    }
+
+    mImages.assign(imageCount, Image{0u, Dali::Vector4::ZERO});
+    for(unsigned int i : order)
+    {
+      const Placement&    placement = placements[i];
+      const Page&         page      = pages[placement.page];
+      const unsigned int  width     = pixelBuffers[i].GetWidth();
+      const unsigned int  height    = pixelBuffers[i].GetHeight();
+      const Dali::Vector2 texelSize(1.0f / page.width, 1.0f / page.height);
+      Dali::PixelData     pixelData = Dali::Devel::PixelBuffer::Convert(pixelBuffers[i]);
+      mTextureSets[placement.page].GetTexture(0u).Upload(pixelData, 0u, 0u, placement.x, placement.y, width, height);
+
+      // Inset by half a texel, so that linear filtering doesn't blend in the neighbouring images
+      mImages[i] = Image{placement.page,
+                         Dali::Vector4((placement.x + 0.5f) * texelSize.x,
+                                       (placement.y + 0.5f) * texelSize.y,
+                                       (width - 1.0f) * texelSize.x,
+                                       (height - 1.0f) * texelSize.y)};
+    }
+    return loaded;
+  }
+
+  /**
+   * @brief The number of atlas textures the images were packed into.
+   */
+  unsigned int GetTextureCount() const
+  {
+    return static_cast<unsigned int>(mTextureSets.size());
+  }
+
+  /**
+   * @brief The index of the atlas holding an image, from 0 to GetTextureCount() - 1.
+   */
+  unsigned int GetTextureIndex(unsigned int image) const
+  {
+    return mImages[image].page;
+  }
+
+  /**
+   * @brief The texture set of the atlas holding an image; images that failed to load get the first one, with an empty rectangle.
+   */
+  Dali::TextureSet GetTextureSet(unsigned int image) const
+  {
+    return mTextureSets.empty() ? Dali::TextureSet() : mTextureSets[mImages[image].page];
+  }
+
+  /**
+   * @brief The rectangle of an image within its atlas, in texture coordinates: offset in xy and size in zw.
+   */
+  Dali::Vector4 GetTextureRect(unsigned int image) const
+  {
+    return mImages[image].rect;
+  }
+
+private:
+  static constexpr unsigned int PADDING = 1u; ///< Pixels between images
+
+  struct Page
+  {
+    Dali::Pixel::Format format;
+    unsigned int        width;
+    unsigned int        height;
+    unsigned int        rowX;      ///< Where the next image of the current row goes
+    unsigned int        rowY;      ///< Top of the current row
+    unsigned int        rowHeight; ///< Height of the tallest image in the current row
+  };
+
+  struct Image
+  {
+    unsigned int  page;
+    Dali::Vector4 rect;
+  };
+
+  std::vector<Dali::TextureSet> mTextureSets;
+  std::vector<Image>            mImages;
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_TEXTURE_ATLAS_H
@@ -0,0 +1,302 @@
+#ifndef DALI_DEMO_TOUCH_TRACE_H
+#define DALI_DEMO_TOUCH_TRACE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/events/point-state.h>
+#include <dali/public-api/events/touch-event.h>
+#include <dali/public-api/events/touch-point.h>
+#include <dali/public-api/math/vector2.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <dali/public-api/signals/dali-signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace DemoHelper
+{
+/**
+ * @brief Records the touches of a live session to a trace file, and replays such a trace through the adaptor, so
+ * that a benchmark can be driven by the gestures of real users.
+ *
+ * A trace is a text file with one touch point per line: its time in milliseconds from the start of the trace, the
+ * id of the touch, its state (down, motion, up or interrupted) and its screen position. A line "segment <name>",
+ * the name without spaces, starts a segment of the trace, e.g. to report the frame times of every gesture apart.
+ * Lines starting with '#' are comments.
+ *
+ * @code
+ * segment flick-left
+ * 0 0 down 600 400
+ * 16 0 motion 540 402
+ * 33 0 up 420 405
+ * @endcode
+ *
+ * The recording starts a new segment, named "gesture-<n>", whenever a touch goes down while no other is held.
+ */
+class TouchTrace : public Dali::ConnectionTracker
+{
+public:
+  struct Point
+  {
+    uint32_t               time; ///< In milliseconds from the start of the trace
+    int32_t                id;
+    Dali::PointState::Type state;
+    Dali::Vector2          position; ///< In screen coordinates
+  };
+
+  struct Segment
+  {
+    std::string name;
+    size_t      firstPoint;
+  };
+
+  typedef Dali::Signal<void(const std::string&)> SegmentSignalType;
+  typedef Dali::Signal<void()>                   FinishedSignalType;
+
+  /**
+   * @brief Reads a trace.
+   * @return false if the file couldn't be read or a line is invalid
+   */
+  bool Load(const std::string& path)
+  {
+    FILE* file = fopen(path.c_str(), "r");
+    if(!file)
+    {
+      return false;
+    }
+
+    mPoints.clear();
+    mSegments.clear();
+    bool valid = true;
+    char line[256];
+    while(valid && fgets(line, sizeof(line), file))
+    {
+      char                   name[128];
+      char                   stateName[16];
+      unsigned long          time  = 0u;
+      int                    id    = 0;
+      Dali::PointState::Type state = Dali::PointState::MOTION;
+      Dali::Vector2          position;
+      if(line[0] == '#' || strspn(line, " \t\r\n") == strlen(line))
+      {
+        continue;
+      }
+      else if(sscanf(line, "segment %127s", name) == 1)
+      {
+        mSegments.push_back(Segment{name, mPoints.size()});
+      }
+      else if(sscanf(line, "%lu %d %15s %f %f", &time, &id, stateName, &position.x, &position.y) == 5 && ParseState(stateName, state) &&
+              (mPoints.empty() || time >= mPoints.back().time))
+      {
+        mPoints.push_back(Point{static_cast<uint32_t>(time), id, state, position});
+      }
+      else
+      {
+        valid = false;
+      }
+    }
+    fclose(file);
+    return valid;
+  }
+
+  /**
+   * @brief Writes the trace.
+   * @return false if the file couldn't be written
+   */
+  bool Save(const std::string& path) const
+  {
+    FILE* file = fopen(path.c_str(), "w");
+    if(!file)
+    {
+      return false;
+    }
+
+    fprintf(file, "# time(ms) id state x y\n");
+    size_t segment = 0u;
+    for(size_t i = 0u; i <= mPoints.size(); ++i)
+    {
+      for(; segment < mSegments.size() && mSegments[segment].firstPoint == i; ++segment)
+      {
+        fprintf(file, "segment %s\n", mSegments[segment].name.c_str());
+      }
+      if(i < mPoints.size())
+      {
+        const Point& point = mPoints[i];
+        fprintf(file, "%u %d %s %.1f %.1f\n", point.time, point.id, GetStateName(point.state), point.position.x, point.position.y);
+      }
+    }
+    return fclose(file) == 0;
+  }
+
+  const std::vector<Point>& GetPoints() const
+  {
+    return mPoints;
+  }
+
+  const std::vector<Segment>& GetSegments() const
+  {
+    return mSegments;
+  }
+
+  /**
+   * @brief Records the touches of the window, from now on.
+   */
+  void StartRecording(Dali::Window window)
+  {
+    mPoints.clear();
+    mSegments.clear();
+    mHeldTouchCount = 0u;
+    window.TouchedSignal().Connect(this, &TouchTrace::OnTouch);
+  }
+
+  /**
+   * @brief Feeds the points of the trace to the adaptor at the times they were recorded.
+   *
+   * SegmentStartedSignal() is emitted as each segment starts and FinishedSignal() once the last point is fed.
+   */
+  void StartReplay()
+  {
+    mNextPoint     = 0u;
+    mNextSegment   = 0u;
+    mReplayStart   = std::chrono::steady_clock::now();
+    mTimeStampBase = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(mReplayStart.time_since_epoch()).count());
+    mReplayTimer   = Dali::Timer::New(REPLAY_INTERVAL);
+    mReplayTimer.TickSignal().Connect(this, &TouchTrace::OnReplayTick);
+    mReplayTimer.Start();
+    OnReplayTick();
+  }
+
+  SegmentSignalType& SegmentStartedSignal()
+  {
+    return mSegmentStartedSignal;
+  }
+
+  FinishedSignalType& FinishedSignal()
+  {
+    return mFinishedSignal;
+  }
+
+private:
+  static constexpr unsigned int REPLAY_INTERVAL = 4u; ///< Milliseconds between the checks for points to feed
+
+  static const char* GetStateName(Dali::PointState::Type state)
+  {
+    switch(state)
+    {
+      case Dali::PointState::DOWN:
+        return "down";
+      case Dali::PointState::UP:
+        return "up";
+      case Dali::PointState::INTERRUPTED:
+        return "interrupted";
+      default:
+        return "motion";
+    }
+  }
+
+  static bool ParseState(const char* name, Dali::PointState::Type& state)
+  {
+    for(Dali::PointState::Type candidate : {Dali::PointState::DOWN, Dali::PointState::UP, Dali::PointState::INTERRUPTED, Dali::PointState::MOTION})
+    {
+      if(strcmp(name, GetStateName(candidate)) == 0)
+      {
+        state = candidate;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void OnTouch(const Dali::TouchEvent& event)
+  {
+    if(mPoints.empty())
+    {
+      mRecordStart = event.GetTime();
+    }
+
+    for(size_t i = 0u; i < event.GetPointCount(); ++i)
+    {
+      const Dali::PointState::Type state = event.GetState(i);
+      if(state == Dali::PointState::DOWN)
+      {
+        if(mHeldTouchCount++ == 0u)
+        {
+          mSegments.push_back(Segment{"gesture-" + std::to_string(mSegments.size() + 1u), mPoints.size()});
+        }
+      }
+      else if(state == Dali::PointState::UP || state == Dali::PointState::INTERRUPTED)
+      {
+        mHeldTouchCount -= mHeldTouchCount > 0u ? 1u : 0u;
+      }
+      else if(state != Dali::PointState::MOTION)
+      {
+        // stationary points repeat the previous ones, and leaving the window ends nothing
+        continue;
+      }
+      mPoints.push_back(Point{static_cast<uint32_t>(event.GetTime() - mRecordStart), event.GetDeviceId(i), state, event.GetScreenPosition(i)});
+    }
+  }
+
+  bool OnReplayTick()
+  {
+    const uint32_t time = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mReplayStart).count());
+    for(; mNextPoint < mPoints.size() && mPoints[mNextPoint].time <= time; ++mNextPoint)
+    {
+      for(; mNextSegment < mSegments.size() && mSegments[mNextSegment].firstPoint <= mNextPoint; ++mNextSegment)
+      {
+        mSegmentStartedSignal.Emit(mSegments[mNextSegment].name);
+      }
+
+      const Point&     point = mPoints[mNextPoint];
+      Dali::TouchPoint touchPoint(point.id, point.state, point.position.x, point.position.y);
+      Dali::Adaptor::Get().FeedTouchPoint(touchPoint, static_cast<int>(mTimeStampBase + point.time));
+    }
+
+    if(mNextPoint == mPoints.size())
+    {
+      mReplayTimer.Stop();
+      mFinishedSignal.Emit();
+      return false;
+    }
+    return true;
+  }
+
+private:
+  std::vector<Point>                    mPoints;
+  std::vector<Segment>                  mSegments;
+  unsigned long                         mRecordStart{0u};
+  unsigned int                          mHeldTouchCount{0u};
+  Dali::Timer                           mReplayTimer;
+  std::chrono::steady_clock::time_point mReplayStart;
+  uint32_t                              mTimeStampBase{0u}; ///< Added to the times of the points, as the adaptor expects times of the system
+  size_t                                mNextPoint{0u};
+  size_t                                mNextSegment{0u};
+  SegmentSignalType                     mSegmentStartedSignal;
+  FinishedSignalType                    mFinishedSignal;
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_TOUCH_TRACE_H
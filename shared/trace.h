@@ -0,0 +1,381 @@
+#ifndef DALI_DEMO_TRACE_H
+#define DALI_DEMO_TRACE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/events/key-event.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Traces the time spent until the end of the enclosing scope, e.g. DEMO_TRACE_SCOPE("Create");
+ */
+#define DEMO_TRACE_SCOPE(name) DemoHelper::TraceScope DEMO_TRACE_CONCATENATE(demoTraceScope, __LINE__)(name)
+
+/**
+ * @brief Traces a point in time, e.g. DEMO_TRACE_INSTANT("ResourceReady");
+ */
+#define DEMO_TRACE_INSTANT(name) DemoHelper::Tracer::Get().AddEvent(name, DemoHelper::Tracer::INSTANT, 0)
+
+/**
+ * @brief Traces the value of a counter, drawn as a graph over time.
+ */
+#define DEMO_TRACE_COUNTER(name, value) DemoHelper::Tracer::Get().AddEvent(name, DemoHelper::Tracer::COUNTER, static_cast<int64_t>(value))
+
+/**
+ * @brief Traces the begin and the end of a span, which may end on another thread; spans of the same name are told apart by their id.
+ */
+#define DEMO_TRACE_ASYNC_BEGIN(name, id) DemoHelper::Tracer::Get().AddEvent(name, DemoHelper::Tracer::ASYNC_BEGIN, static_cast<int64_t>(id))
+#define DEMO_TRACE_ASYNC_END(name, id) DemoHelper::Tracer::Get().AddEvent(name, DemoHelper::Tracer::ASYNC_END, static_cast<int64_t>(id))
+
+#define DEMO_TRACE_CONCATENATE(prefix, line) DEMO_TRACE_CONCATENATE_EXPANDED(prefix, line)
+#define DEMO_TRACE_CONCATENATE_EXPANDED(prefix, line) prefix##line
+
+namespace DemoHelper
+{
+/**
+ * @brief Records events in the Chrome trace format, to see in a trace viewer (chrome://tracing, Perfetto) what the
+ * event and update threads of an example do over time.
+ *
+ * Tracing is enabled by naming the file to write in the DALI_DEMO_TRACE environment variable. The file is written
+ * when the process exits and whenever F12 is pressed, once the example has called StartExample(). Without the variable,
+ * tracing an event costs one test.
+ *
+ * Every thread records into its own ring buffer, which it alone writes to, so recording takes no lock; once a buffer
+ * is full the oldest events are overwritten. The buffers may be written out while their threads record, see Slot.
+ * Event names must be string literals, as only their address is recorded.
+ */
+class Tracer : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @brief The phases of the Chrome trace format used.
+   */
+  enum Phase : char
+  {
+    COMPLETE    = 'X',
+    INSTANT     = 'i',
+    COUNTER     = 'C',
+    ASYNC_BEGIN = 'b',
+    ASYNC_END   = 'e'
+  };
+
+  static Tracer& Get()
+  {
+    // Never destroyed, as the trace is written at exit
+    static Tracer* tracer = new Tracer;
+    return *tracer;
+  }
+
+  bool IsEnabled() const
+  {
+    return mEnabled;
+  }
+
+  /**
+   * @brief Names the event thread and writes the trace when F12 is pressed; called by StartExample() and the launchers.
+   */
+  void Start(Dali::Application& application)
+  {
+    if(mEnabled && !mStarted)
+    {
+      SetThreadName("Event thread");
+      application.GetWindow().KeyEventSignal().Connect(this, &Tracer::OnKeyEvent);
+      mStarted = true;
+    }
+  }
+
+  /**
+   * @brief Names the calling thread in the trace, e.g. "Update thread" from a FrameCallbackInterface.
+   * @param[in] name A string literal
+   */
+  void SetThreadName(const char* name)
+  {
+    if(mEnabled)
+    {
+      GetThreadBuffer().name.store(name, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Records an event of the calling thread; see the DEMO_TRACE macros.
+   */
+  void AddEvent(const char* name, Phase phase, int64_t value)
+  {
+    if(mEnabled)
+    {
+      GetThreadBuffer().Push(Event{name, GetTime(), 0u, value, phase});
+    }
+  }
+
+  /**
+   * @brief Records an event that started at @p startTime and ends now.
+   */
+  void AddCompleteEvent(const char* name, uint64_t startTime)
+  {
+    GetThreadBuffer().Push(Event{name, startTime, GetTime() - startTime, 0, COMPLETE});
+  }
+
+  /**
+   * @brief The time since tracing started, in microseconds.
+   */
+  uint64_t GetTime() const
+  {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mStartTime).count());
+  }
+
+  /**
+   * @brief Writes the events of every thread still in their buffers.
+   * @return false if tracing isn't enabled or the file couldn't be written
+   */
+  bool Write()
+  {
+    if(!mEnabled)
+    {
+      return false;
+    }
+
+    FILE* file = fopen(mPath.c_str(), "w");
+    if(!file)
+    {
+      std::cerr << "Failed to write the trace to " << mPath << std::endl;
+      return false;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+    const char* separator = "\n";
+
+    std::lock_guard<std::mutex> lock(mBuffersMutex);
+    for(size_t thread = 0u; thread < mBuffers.size(); ++thread)
+    {
+      ThreadBuffer& buffer   = *mBuffers[thread];
+      const int     threadId = static_cast<int>(thread) + 1;
+      const char*   name     = buffer.name.load(std::memory_order_relaxed);
+      if(name)
+      {
+        fprintf(file, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"%s\"}}", separator, threadId, name);
+        separator = ",\n";
+      }
+
+      std::vector<Event> events;
+      buffer.Read(events);
+      for(const Event& event : events)
+      {
+        fprintf(file, "%s{\"name\": \"%s\", \"ph\": \"%c\", \"pid\": 1, \"tid\": %d, \"ts\": %llu", separator, event.name, event.phase, threadId, static_cast<unsigned long long>(event.time));
+        switch(event.phase)
+        {
+          case COMPLETE:
+            fprintf(file, ", \"dur\": %llu}", static_cast<unsigned long long>(event.duration));
+            break;
+          case INSTANT:
+            fprintf(file, ", \"s\": \"t\"}");
+            break;
+          case COUNTER:
+            fprintf(file, ", \"args\": {\"value\": %lld}}", static_cast<long long>(event.value));
+            break;
+          case ASYNC_BEGIN:
+          case ASYNC_END:
+            fprintf(file, ", \"cat\": \"async\", \"id\": \"0x%llx\"}", static_cast<unsigned long long>(event.value));
+            break;
+        }
+        separator = ",\n";
+      }
+    }
+    fprintf(file, "\n]}\n");
+
+    if(fclose(file) != 0)
+    {
+      std::cerr << "Failed to write the trace to " << mPath << std::endl;
+      return false;
+    }
+    std::cout << "Trace written to " << mPath << std::endl;
+    return true;
+  }
+
+private:
+  static constexpr uint32_t BUFFER_CAPACITY = 1u << 16; ///< Events kept per thread, a power of two
+
+  struct Event
+  {
+    const char* name;
+    uint64_t    time;     ///< In microseconds
+    uint64_t    duration; ///< In microseconds, for complete events
+    int64_t     value;    ///< The value of a counter or the id of an async span
+    Phase       phase;
+  };
+
+  /**
+   * @brief An event in a ring buffer. Its members are atomic, so that another thread may copy it while it's overwritten.
+   *
+   * The sequence is odd while the event is written, then 2 * (index + 1) for the index-th event of the thread; a copy
+   * is only kept if the sequence was the expected one before and after it was made.
+   */
+  struct Slot
+  {
+    std::atomic<uint64_t>    sequence{0u};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t>    time{0u};
+    std::atomic<uint64_t>    duration{0u};
+    std::atomic<int64_t>     value{0};
+    std::atomic<char>        phase{0};
+  };
+
+  /**
+   * @brief The events of one thread; only that thread pushes, any thread may read.
+   */
+  struct ThreadBuffer
+  {
+    ThreadBuffer()
+    : slots(new Slot[BUFFER_CAPACITY]),
+      count(0u),
+      name(nullptr)
+    {
+    }
+
+    void Push(const Event& event)
+    {
+      const uint64_t index = count.load(std::memory_order_relaxed);
+      Slot&          slot  = slots[index % BUFFER_CAPACITY];
+      slot.sequence.store(index * 2u + 1u, std::memory_order_relaxed);
+      // released, so a reader which sees any of them then sees the odd sequence
+      slot.name.store(event.name, std::memory_order_release);
+      slot.time.store(event.time, std::memory_order_release);
+      slot.duration.store(event.duration, std::memory_order_release);
+      slot.value.store(event.value, std::memory_order_release);
+      slot.phase.store(event.phase, std::memory_order_release);
+      slot.sequence.store(index * 2u + 2u, std::memory_order_release);
+      count.store(index + 1u, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies the events in the buffer, leaving out those the thread overwrote while they were copied.
+     */
+    void Read(std::vector<Event>& copy) const
+    {
+      const uint64_t end   = count.load(std::memory_order_acquire);
+      const uint64_t begin = end > BUFFER_CAPACITY ? end - BUFFER_CAPACITY : 0u;
+      for(uint64_t i = begin; i < end; ++i)
+      {
+        const Slot&    slot     = slots[i % BUFFER_CAPACITY];
+        const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const Event    event{slot.name.load(std::memory_order_acquire),
+                          slot.time.load(std::memory_order_acquire),
+                          slot.duration.load(std::memory_order_acquire),
+                          slot.value.load(std::memory_order_acquire),
+                          static_cast<Phase>(slot.phase.load(std::memory_order_acquire))};
+        if(sequence == i * 2u + 2u && slot.sequence.load(std::memory_order_relaxed) == sequence)
+        {
+          copy.push_back(event);
+        }
+      }
+    }
+
+    std::unique_ptr<Slot[]>  slots;
+    std::atomic<uint64_t>    count;
+    std::atomic<const char*> name;
+  };
+
+  Tracer()
+  : mStartTime(std::chrono::steady_clock::now()),
+    mEnabled(false),
+    mStarted(false)
+  {
+    const char* path = getenv("DALI_DEMO_TRACE");
+    if(path && *path)
+    {
+      mPath    = path;
+      mEnabled = true;
+      atexit([]() { Tracer::Get().Write(); });
+    }
+  }
+
+  ThreadBuffer& GetThreadBuffer()
+  {
+    // The buffers outlive their threads, so that the events of threads that have exited are written too
+    thread_local ThreadBuffer* threadBuffer = nullptr;
+    if(!threadBuffer)
+    {
+      std::lock_guard<std::mutex> lock(mBuffersMutex);
+      mBuffers.emplace_back(new ThreadBuffer);
+      threadBuffer = mBuffers.back().get();
+    }
+    return *threadBuffer;
+  }
+
+  void OnKeyEvent(const Dali::KeyEvent& event)
+  {
+    if(event.GetState() == Dali::KeyEvent::DOWN && event.GetKeyName() == "F12")
+    {
+      Write();
+    }
+  }
+
+private:
+  std::chrono::steady_clock::time_point      mStartTime;
+  std::string                                mPath;
+  std::vector<std::unique_ptr<ThreadBuffer>> mBuffers; ///< In the order the threads first traced, their ids in the trace
+  std::mutex                                 mBuffersMutex;
+  bool                                       mEnabled;
+  bool                                       mStarted;
+};
+
+/**
+ * @brief Traces the time spent from its construction to its destruction; see DEMO_TRACE_SCOPE.
+ */
+class TraceScope
+{
+public:
+  explicit TraceScope(const char* name)
+  : mName(Tracer::Get().IsEnabled() ? name : nullptr),
+    mStartTime(mName ? Tracer::Get().GetTime() : 0u)
+  {
+  }
+
+  ~TraceScope()
+  {
+    if(mName)
+    {
+      Tracer::Get().AddCompleteEvent(mName, mStartTime);
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+  const char* mName;
+  uint64_t    mStartTime;
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_TRACE_H
@@ -0,0 +1,199 @@
+#ifndef DALI_DEMO_WORKER_POOL_H
+#define DALI_DEMO_WORKER_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include "shared/trace.h"
+
+namespace DemoHelper
+{
+/**
+ * @brief Persistent threads splitting a loop over a range between them, e.g. from a frame callback on the update
+ * thread, which takes part in the work and returns once the whole range is done.
+ *
+ * The range is cut in chunks and every worker starts on its own contiguous share of them, so that each mostly works
+ * on memory of its own. A worker done with its share steals the chunks left in the shares of the others, so that a
+ * worker descheduled for a while doesn't hold up the loop.
+ *
+ * The threads wait for work on a condition variable, so waking them costs some microseconds: a loop too short to be
+ * worth it is better run on the calling thread alone.
+ */
+class WorkerPool
+{
+public:
+  /**
+   * @brief Processes the elements from @p begin to @p end, excluded.
+   */
+  typedef std::function<void(uint32_t begin, uint32_t end)> Task;
+
+  /**
+   * @brief Constructor.
+   * @param[in] workerCount The number of threads working on a loop, including the one calling Run()
+   */
+  explicit WorkerPool(uint32_t workerCount)
+  : mShares(new Share[std::max(workerCount, 1u)]),
+    mWorkerCount(std::max(workerCount, 1u))
+  {
+    for(uint32_t worker = 1u; worker < mWorkerCount; ++worker)
+    {
+      mThreads.emplace_back(&WorkerPool::Work, this, worker);
+    }
+  }
+
+  ~WorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStopping = true;
+    }
+    mStartCondition.notify_all();
+    for(std::thread& thread : mThreads)
+    {
+      thread.join();
+    }
+  }
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  uint32_t GetWorkerCount() const
+  {
+    return mWorkerCount;
+  }
+
+  /**
+   * @brief Runs the task over the range from 0 to @p count, a chunk at a time, and returns once it is all done.
+   * @param[in] count The number of elements
+   * @param[in] chunkSize The number of elements the task processes at a time
+   * @param[in] task The task, which may run on any of the workers at once
+   */
+  void Run(uint32_t count, uint32_t chunkSize, const Task& task)
+  {
+    chunkSize                 = std::max(chunkSize, 1u);
+    const uint32_t chunkCount = (count + chunkSize - 1u) / chunkSize;
+    if(mWorkerCount == 1u || chunkCount <= 1u)
+    {
+      task(0u, count);
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      for(uint32_t worker = 0u; worker < mWorkerCount; ++worker)
+      {
+        mShares[worker].next.store(worker * chunkCount / mWorkerCount, std::memory_order_relaxed);
+        mShares[worker].end = (worker + 1u) * chunkCount / mWorkerCount;
+      }
+      mTask      = &task;
+      mCount     = count;
+      mChunkSize = chunkSize;
+      mBusyCount = mWorkerCount - 1u;
+      ++mGeneration;
+    }
+    mStartCondition.notify_all();
+
+    RunChunks(0u);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDoneCondition.wait(lock, [this]() { return mBusyCount == 0u; });
+    mTask = nullptr;
+  }
+
+private:
+  /**
+   * @brief The chunks a worker starts with; aligned so that the workers don't share the cache line they claim from.
+   */
+  struct alignas(64) Share
+  {
+    std::atomic<uint32_t> next{0u};
+    uint32_t              end{0u};
+  };
+
+  void Work(uint32_t worker)
+  {
+    Tracer::Get().SetThreadName("Worker thread");
+    uint64_t generation = 0u;
+    while(true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mStartCondition.wait(lock, [this, generation]() { return mStopping || mGeneration != generation; });
+        if(mStopping)
+        {
+          return;
+        }
+        generation = mGeneration;
+      }
+
+      RunChunks(worker);
+
+      std::lock_guard<std::mutex> lock(mMutex);
+      if(--mBusyCount == 0u)
+      {
+        mDoneCondition.notify_one();
+      }
+    }
+  }
+
+  /**
+   * @brief Runs the chunks of the worker's share, then those left in the shares of the others.
+   */
+  void RunChunks(uint32_t worker)
+  {
+    DEMO_TRACE_SCOPE("WorkerPool::Run");
+    for(uint32_t i = 0u; i < mWorkerCount; ++i)
+    {
+      Share& share = mShares[(worker + i) % mWorkerCount];
+      for(uint32_t chunk = share.next.fetch_add(1u, std::memory_order_relaxed); chunk < share.end; chunk = share.next.fetch_add(1u, std::memory_order_relaxed))
+      {
+        const uint32_t begin = chunk * mChunkSize;
+        (*mTask)(begin, std::min(begin + mChunkSize, mCount));
+      }
+    }
+  }
+
+private:
+  std::unique_ptr<Share[]> mShares;
+  std::vector<std::thread> mThreads;
+  std::mutex               mMutex;
+  std::condition_variable  mStartCondition;
+  std::condition_variable  mDoneCondition;
+  const Task*              mTask{nullptr};
+  uint32_t                 mWorkerCount;
+  uint32_t                 mCount{0u};
+  uint32_t                 mChunkSize{1u};
+  uint32_t                 mBusyCount{0u};  ///< Threads still working on the current loop
+  uint64_t                 mGeneration{0u}; ///< Incremented for every loop, to wake the threads
+  bool                     mStopping{false};
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_WORKER_POOL_H
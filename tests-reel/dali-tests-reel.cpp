@@ -21,6 +21,7 @@
 // INTERNAL INCLUDES
 #include "shared/dali-demo-strings.h"
 #include "shared/dali-table-view.h"
+#include "shared/execute-process.h"
 
 using namespace Dali;
 
@@ -32,10 +33,14 @@ int DALI_EXPORT_API main(int argc, char** argv)
   textdomain(DALI_DEMO_DOMAIN_LOCAL);
   setlocale(LC_ALL, DEMO_LANG);
 #endif
+  // The zygote is forked before the application is created, as a process that has started threads can't be forked safely
+  StartExampleZygote(argc, argv);
+
   Application app = Application::New(&argc, &argv, DEMO_STYLE_DIR "/tests-theme.json");
 
   // Create the demo launcher
   DaliTableView demo(app);
+  demo.ParseArguments(argc, argv);
 
   demo.AddExample(Example("benchmark.example", DALI_DEMO_STR_TITLE_BENCHMARK));
   demo.AddExample(Example("compressed-texture-formats.example", DALI_DEMO_STR_TITLE_COMPRESSED_TEXTURE_FORMATS));
@@ -62,5 +67,5 @@ int DALI_EXPORT_API main(int argc, char** argv)
   // Start the event loop
   app.MainLoop();
 
-  return 0;
+  return demo.GetExitCode();
 }